@@ -33,37 +33,67 @@ std::vector<uint8_t> doubleDabble(const omw::uint128_t& value);
 
 //! \name Levenshtein Distance
 /// @{
+/**
+ * Generic implementation with a single row of `min(aCount, bCount) + 1` entries. The `char` overload uses the faster
+ * bit-parallel algorithm.
+ *
+ * @return The edit distance, `SIZE_MAX` if a pointer is `NULL`
+ */
 template <typename T> inline size_t levenshteinDistance(const T* a, size_t aCount, const T* b, size_t bCount)
 {
     size_t r;
 
     if (a && b)
     {
-        std::vector<std::vector<size_t>> m(aCount + 1, std::vector<size_t>(bCount + 1, 0));
+        // common prefix and suffix do not change the distance
+        while ((aCount > 0) && (bCount > 0) && (*a == *b))
+        {
+            ++a;
+            ++b;
+            --aCount;
+            --bCount;
+        }
+        while ((aCount > 0) && (bCount > 0) && (*(a + aCount - 1) == *(b + bCount - 1)))
+        {
+            --aCount;
+            --bCount;
+        }
 
-        for (size_t j = 1; j < m[0].size(); ++j) m[0][j] = j;
+        if (aCount < bCount)
+        {
+            std::swap(a, b);
+            std::swap(aCount, bCount);
+        }
 
-        for (size_t i = 1; i < m.size(); ++i)
+        std::vector<size_t> row(bCount + 1);
+        for (size_t j = 0; j < row.size(); ++j) row[j] = j;
+
+        for (size_t i = 1; i <= aCount; ++i)
         {
-            m[i][0] = i;
+            size_t diag = row[0]; // row[i - 1][j - 1]
+            row[0] = i;
 
-            for (size_t j = 1; j < m[i].size(); ++j)
+            for (size_t j = 1; j <= bCount; ++j)
             {
-                const size_t sub = m[i - 1][j - 1] + (*(a + i - 1) == *(b + j - 1) ? 0 : 1); // substitution
-                const size_t ins = m[i][j - 1] + 1;                                          // insertion
-                const size_t del = m[i - 1][j] + 1;                                          // deletion
+                const size_t up = row[j];
+                const size_t sub = diag + (*(a + i - 1) == *(b + j - 1) ? 0 : 1); // substitution
+                const size_t ins = row[j - 1] + 1;                                // insertion
+                const size_t del = up + 1;                                        // deletion
 
-                m[i][j] = std::min(std::min(sub, ins), del);
+                row[j] = std::min(std::min(sub, ins), del);
+                diag = up;
             }
         }
 
-        r = m[aCount][bCount];
+        r = row[bCount];
     }
     else r = SIZE_MAX;
 
     return r;
 }
 
+size_t levenshteinDistance(const char* a, size_t aCount, const char* b, size_t bCount);
+
 static inline size_t levenshteinDistance(const char* a, const char* b)
 {
     size_t r;
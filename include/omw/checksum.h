@@ -9,11 +9,11 @@ copyright       MIT - Copyright (c) 2022 Oliver Blaser
 
 #include <cstddef>
 #include <cstdint>
+#include <stdexcept>
 #include <vector>
 
-
-// #define OMWi_CHECKSUM_CRC_PREVIEW (1) // def/undef
-
+#include "../omw/defs.h"
+#include "../omw/internal/crcEngine.h"
 
 namespace omw {
 
@@ -21,7 +21,6 @@ namespace omw {
  * @{
  */
 
-#ifdef OMWi_CHECKSUM_CRC_PREVIEW
 template <class UI> class CrcParameter
 {
 public:
@@ -43,13 +42,184 @@ private:
     UI m_xorOut;
 };
 
+#if (OMW_CPPSTD >= OMW_CPPSTD_14) || defined(OMWi_DOXYGEN_PREDEFINE)
+
+template <class P> class Crc : public omw::internal::CrcEngine<P>
+{
+public:
+    using value_type = typename omw::internal::CrcEngine<P>::value_type;
+
+    static constexpr omw::CrcParameter<value_type> parameter() { return P::parameter(); }
+
+    static value_type calc(const uint8_t* data, size_t count)
+    {
+        value_type crc = Crc::begin();
+        if (data) crc = update(crc, data, count);
+        return Crc::finalize(crc);
+    }
+
+    //! \name Register Level
+    /// @{
+    static value_type update(value_type crc, const uint8_t* data, size_t count) { return Crc::updateSlicing(crc, data, count); }
+    /// @}
+};
+
+template <class P> class CrcState
+{
+public:
+    using crc_type = omw::Crc<P>;
+    using value_type = typename crc_type::value_type;
+
+public:
+    CrcState()
+        : m_reg(crc_type::begin()), m_length(0)
+    {}
+
+    void reset()
+    {
+        m_reg = crc_type::begin();
+        m_length = 0;
+    }
+
+    void update(const uint8_t* data, size_t count)
+    {
+        if (data)
+        {
+            m_reg = crc_type::update(m_reg, data, count);
+            m_length += count;
+        }
+    }
+
+    void update(const std::vector<uint8_t>& data, std::vector<uint8_t>::size_type pos = 0, std::vector<uint8_t>::size_type count = -1)
+    {
+        if (((data.size() - pos) < count) || (pos > data.size())) throw std::invalid_argument("omw::CrcState::update");
+        update(data.data() + pos, count);
+    }
+
+    void append(const CrcState& other)
+    {
+        m_reg = static_cast<value_type>(shift(static_cast<value_type>(m_reg ^ crc_type::begin()), other.m_length) ^ other.m_reg);
+        m_length += other.m_length;
+    }
+
+    value_type finalize() const { return crc_type::finalize(m_reg); }
+    uint64_t length() const { return m_length; }
+
+    static value_type combine(value_type crcA, value_type crcB, uint64_t lengthB);
+
+private:
+    value_type m_reg;
+    uint64_t m_length;
+
+    static value_type unfinalize(value_type crc);
+    static value_type shift(value_type reg, uint64_t count);
+    static value_type gf2MatrixTimes(const value_type* mat, value_type vec);
+    static void gf2MatrixSquare(value_type* square, const value_type* mat);
+};
+
+template <class P> typename omw::CrcState<P>::value_type omw::CrcState<P>::combine(value_type crcA, value_type crcB, uint64_t lengthB)
+{
+    // reg(A|B) = shift(reg(A) ^ init, len(B)) ^ reg(B), because the register is linear in GF(2)
+    const value_type regA = unfinalize(crcA);
+    const value_type regB = unfinalize(crcB);
+    return crc_type::finalize(static_cast<value_type>(shift(static_cast<value_type>(regA ^ crc_type::begin()), lengthB) ^ regB));
+}
+
+template <class P> typename omw::CrcState<P>::value_type omw::CrcState<P>::unfinalize(value_type crc)
+{
+    crc = static_cast<value_type>(crc ^ crc_type::parameter().xorOut());
+    return ((crc_type::parameter().refIn() != crc_type::parameter().refOut()) ? crc_type::reflect(crc) : crc);
+}
+
+// feeds `count` zero bytes into the register, see zlib's crc32_combine()
+template <class P> typename omw::CrcState<P>::value_type omw::CrcState<P>::shift(value_type reg, uint64_t count)
+{
+    constexpr unsigned width = crc_type::width();
+
+    value_type even[width]; // even power of two zeros operator
+    value_type odd[width];  // odd power of two zeros operator
+
+    if ((count == 0) || (reg == 0)) return reg;
+
+    // operator for one zero bit
+    if (crc_type::parameter().refIn())
+    {
+        odd[0] = crc_type::reflect(crc_type::parameter().poly());
+        for (unsigned i = 1; i < width; ++i) odd[i] = static_cast<value_type>(static_cast<value_type>(1) << (i - 1));
+    }
+    else
+    {
+        for (unsigned i = 0; i < (width - 1); ++i) odd[i] = static_cast<value_type>(static_cast<value_type>(1) << (i + 1));
+        odd[width - 1] = crc_type::parameter().poly();
+    }
+
+    gf2MatrixSquare(even, odd); // two zero bits
+    gf2MatrixSquare(odd, even); // four zero bits
+
+    // apply count zero bytes, the first square puts the operator for one zero byte in even
+    do
+    {
+        gf2MatrixSquare(even, odd);
+        if (count & 1) reg = gf2MatrixTimes(even, reg);
+        count >>= 1;
+
+        if (count == 0) break;
+
+        gf2MatrixSquare(odd, even);
+        if (count & 1) reg = gf2MatrixTimes(odd, reg);
+        count >>= 1;
+    }
+    while (count != 0);
+
+    return reg;
+}
+
+template <class P> typename omw::CrcState<P>::value_type omw::CrcState<P>::gf2MatrixTimes(const value_type* mat, value_type vec)
+{
+    value_type sum = 0;
+
+    while (vec)
+    {
+        if (vec & 1) sum ^= *mat;
+        vec = static_cast<value_type>(vec >> 1);
+        ++mat;
+    }
+
+    return sum;
+}
+
+template <class P> void omw::CrcState<P>::gf2MatrixSquare(value_type* square, const value_type* mat)
+{
+    for (unsigned i = 0; i < crc_type::width(); ++i) square[i] = gf2MatrixTimes(mat, mat[i]);
+}
+
+#endif // C++14
+
+namespace crc8 {
+    struct Smbus
+    {
+        static constexpr omw::CrcParameter<uint8_t> parameter() { return omw::CrcParameter<uint8_t>(0x00, 0x07, false, false, 0x00); }
+    };
+
+    constexpr omw::CrcParameter<uint8_t> smbusParam = omw::crc8::Smbus::parameter();
+
+    uint8_t smbus(const uint8_t* data, size_t count);
+    uint8_t smbus(const std::vector<uint8_t>& data, std::vector<uint8_t>::size_type pos = 0, std::vector<uint8_t>::size_type count = -1);
+} // namespace crc8
+
 namespace crc16 {
-    constexpr omw::CrcParameter<uint16_t> kermitParam(0x0000, 0x1021, true, true, 0x0000);
-    constexpr omw::CrcParameter<uint16_t> modbusParam(0xFFFF, 0x8005, true, true, 0x0000);
+    struct Kermit
+    {
+        static constexpr omw::CrcParameter<uint16_t> parameter() { return omw::CrcParameter<uint16_t>(0x0000, 0x1021, true, true, 0x0000); }
+    };
+
+    struct Modbus
+    {
+        static constexpr omw::CrcParameter<uint16_t> parameter() { return omw::CrcParameter<uint16_t>(0xFFFF, 0x8005, true, true, 0x0000); }
+    };
 
-    constexpr size_t tableSize = 256;
-    extern const uint16_t tableKermit[tableSize];
-    extern const uint16_t tableModbus[tableSize];
+    constexpr omw::CrcParameter<uint16_t> kermitParam = omw::crc16::Kermit::parameter();
+    constexpr omw::CrcParameter<uint16_t> modbusParam = omw::crc16::Modbus::parameter();
 
     uint16_t kermit(const uint8_t* data, size_t count);
     uint16_t kermit(const std::vector<uint8_t>& data, std::vector<uint8_t>::size_type pos = 0, std::vector<uint8_t>::size_type count = -1);
@@ -58,13 +228,251 @@ namespace crc16 {
     uint16_t modbus(const std::vector<uint8_t>& data, std::vector<uint8_t>::size_type pos = 0, std::vector<uint8_t>::size_type count = -1);
 } // namespace crc16
 
-#endif // OMWi_CHECKSUM_CRC_PREVIEW
+namespace crc32 {
+    struct Ieee
+    {
+        static constexpr omw::CrcParameter<uint32_t> parameter() { return omw::CrcParameter<uint32_t>(0xFFFFFFFF, 0x04C11DB7, true, true, 0xFFFFFFFF); }
+    };
+
+    struct Castagnoli
+    {
+        static constexpr omw::CrcParameter<uint32_t> parameter() { return omw::CrcParameter<uint32_t>(0xFFFFFFFF, 0x1EDC6F41, true, true, 0xFFFFFFFF); }
+    };
+
+    constexpr omw::CrcParameter<uint32_t> ieeeParam = omw::crc32::Ieee::parameter();
+    constexpr omw::CrcParameter<uint32_t> castagnoliParam = omw::crc32::Castagnoli::parameter();
+
+    uint32_t ieee(const uint8_t* data, size_t count);
+    uint32_t ieee(const std::vector<uint8_t>& data, std::vector<uint8_t>::size_type pos = 0, std::vector<uint8_t>::size_type count = -1);
+
+    uint32_t castagnoli(const uint8_t* data, size_t count);
+    uint32_t castagnoli(const std::vector<uint8_t>& data, std::vector<uint8_t>::size_type pos = 0, std::vector<uint8_t>::size_type count = -1);
+} // namespace crc32
+
+#if (OMW_CPPSTD >= OMW_CPPSTD_14) || defined(OMWi_DOXYGEN_PREDEFINE)
+template <> uint32_t omw::Crc<omw::crc32::Ieee>::update(uint32_t crc, const uint8_t* data, size_t count);
+template <> uint32_t omw::Crc<omw::crc32::Castagnoli>::update(uint32_t crc, const uint8_t* data, size_t count);
+#endif
+
+namespace crc64 {
+    struct Ecma
+    {
+        static constexpr omw::CrcParameter<uint64_t> parameter()
+        {
+            return omw::CrcParameter<uint64_t>(0x0000000000000000, 0x42F0E1EBA9EA3693, false, false, 0x0000000000000000);
+        }
+    };
+
+    struct Xz
+    {
+        static constexpr omw::CrcParameter<uint64_t> parameter()
+        {
+            return omw::CrcParameter<uint64_t>(0xFFFFFFFFFFFFFFFF, 0x42F0E1EBA9EA3693, true, true, 0xFFFFFFFFFFFFFFFF);
+        }
+    };
+
+    constexpr omw::CrcParameter<uint64_t> ecmaParam = omw::crc64::Ecma::parameter();
+    constexpr omw::CrcParameter<uint64_t> xzParam = omw::crc64::Xz::parameter();
+
+    uint64_t ecma(const uint8_t* data, size_t count);
+    uint64_t ecma(const std::vector<uint8_t>& data, std::vector<uint8_t>::size_type pos = 0, std::vector<uint8_t>::size_type count = -1);
+
+    uint64_t xz(const uint8_t* data, size_t count);
+    uint64_t xz(const std::vector<uint8_t>& data, std::vector<uint8_t>::size_type pos = 0, std::vector<uint8_t>::size_type count = -1);
+} // namespace crc64
 
 uint8_t parityWord(const uint8_t* data, size_t count);
 // uint8_t parityWord(const uint8_t* data, size_t count, uint8_t init);
 uint8_t parityWord(const std::vector<uint8_t>& data, std::vector<uint8_t>::size_type pos = 0, std::vector<uint8_t>::size_type count = -1);
 // uint8_t parityWord(const std::vector<uint8_t>& data, std::vector<uint8_t>::size_type pos = 0, std::vector<uint8_t>::size_type count = -1, uint8_t init);
 
+uint16_t parityWord16(const uint8_t* data, size_t count);
+uint16_t parityWord16(const std::vector<uint8_t>& data, std::vector<uint8_t>::size_type pos = 0, std::vector<uint8_t>::size_type count = -1);
+
+uint32_t parityWord32(const uint8_t* data, size_t count);
+uint32_t parityWord32(const std::vector<uint8_t>& data, std::vector<uint8_t>::size_type pos = 0, std::vector<uint8_t>::size_type count = -1);
+
+
+
+uint32_t adler32(const uint8_t* data, size_t count);
+uint32_t adler32(const std::vector<uint8_t>& data, std::vector<uint8_t>::size_type pos = 0, std::vector<uint8_t>::size_type count = -1);
+
+uint16_t fletcher16(const uint8_t* data, size_t count);
+uint16_t fletcher16(const std::vector<uint8_t>& data, std::vector<uint8_t>::size_type pos = 0, std::vector<uint8_t>::size_type count = -1);
+
+uint32_t fletcher32(const uint8_t* data, size_t count);
+uint32_t fletcher32(const std::vector<uint8_t>& data, std::vector<uint8_t>::size_type pos = 0, std::vector<uint8_t>::size_type count = -1);
+
+uint32_t fnv1a32(const uint8_t* data, size_t count);
+uint32_t fnv1a32(const std::vector<uint8_t>& data, std::vector<uint8_t>::size_type pos = 0, std::vector<uint8_t>::size_type count = -1);
+
+uint64_t fnv1a64(const uint8_t* data, size_t count);
+uint64_t fnv1a64(const std::vector<uint8_t>& data, std::vector<uint8_t>::size_type pos = 0, std::vector<uint8_t>::size_type count = -1);
+
+#if (OMW_CPPSTD >= OMW_CPPSTD_14) || defined(OMWi_DOXYGEN_PREDEFINE)
+constexpr uint32_t fnv1a32(const char* str, size_t count)
+{
+    uint32_t h = 0x811C9DC5;
+    for (size_t i = 0; i < count; ++i) h = (h ^ static_cast<uint8_t>(str[i])) * 0x01000193;
+    return h;
+}
+
+constexpr uint32_t fnv1a32(const char* str)
+{
+    uint32_t h = 0x811C9DC5;
+    while (*str) h = (h ^ static_cast<uint8_t>(*(str++))) * 0x01000193;
+    return h;
+}
+
+constexpr uint64_t fnv1a64(const char* str, size_t count)
+{
+    uint64_t h = 0xCBF29CE484222325;
+    for (size_t i = 0; i < count; ++i) h = (h ^ static_cast<uint8_t>(str[i])) * 0x00000100000001B3;
+    return h;
+}
+
+constexpr uint64_t fnv1a64(const char* str)
+{
+    uint64_t h = 0xCBF29CE484222325;
+    while (*str) h = (h ^ static_cast<uint8_t>(*(str++))) * 0x00000100000001B3;
+    return h;
+}
+#endif // C++14
+
+uint64_t xxh64(const uint8_t* data, size_t count, uint64_t seed = 0);
+uint64_t xxh64(const std::vector<uint8_t>& data, std::vector<uint8_t>::size_type pos = 0, std::vector<uint8_t>::size_type count = -1, uint64_t seed = 0);
+
+uint64_t xxh3(const uint8_t* data, size_t count, uint64_t seed = 0);
+uint64_t xxh3(const std::vector<uint8_t>& data, std::vector<uint8_t>::size_type pos = 0, std::vector<uint8_t>::size_type count = -1, uint64_t seed = 0);
+
+class Adler32State
+{
+public:
+    Adler32State();
+    virtual ~Adler32State() {}
+
+    void reset();
+    void update(const uint8_t* data, size_t count);
+    void update(const std::vector<uint8_t>& data, std::vector<uint8_t>::size_type pos = 0, std::vector<uint8_t>::size_type count = -1);
+    uint32_t finalize() const;
+
+private:
+    uint32_t m_a;
+    uint32_t m_b;
+};
+
+class Fletcher16State
+{
+public:
+    Fletcher16State();
+    virtual ~Fletcher16State() {}
+
+    void reset();
+    void update(const uint8_t* data, size_t count);
+    void update(const std::vector<uint8_t>& data, std::vector<uint8_t>::size_type pos = 0, std::vector<uint8_t>::size_type count = -1);
+    uint16_t finalize() const;
+
+private:
+    uint32_t m_sum1;
+    uint32_t m_sum2;
+};
+
+class Fletcher32State
+{
+public:
+    Fletcher32State();
+    virtual ~Fletcher32State() {}
+
+    void reset();
+    void update(const uint8_t* data, size_t count);
+    void update(const std::vector<uint8_t>& data, std::vector<uint8_t>::size_type pos = 0, std::vector<uint8_t>::size_type count = -1);
+    uint32_t finalize() const;
+
+private:
+    uint32_t m_sum1;
+    uint32_t m_sum2;
+    bool m_odd;       // a byte of an incomplete word is pending
+    uint8_t m_lowByte; // the pending byte
+};
+
+class Fnv1a32State
+{
+public:
+    Fnv1a32State();
+    virtual ~Fnv1a32State() {}
+
+    void reset();
+    void update(const uint8_t* data, size_t count);
+    void update(const std::vector<uint8_t>& data, std::vector<uint8_t>::size_type pos = 0, std::vector<uint8_t>::size_type count = -1);
+    uint32_t finalize() const { return m_hash; }
+
+private:
+    uint32_t m_hash;
+};
+
+class Fnv1a64State
+{
+public:
+    Fnv1a64State();
+    virtual ~Fnv1a64State() {}
+
+    void reset();
+    void update(const uint8_t* data, size_t count);
+    void update(const std::vector<uint8_t>& data, std::vector<uint8_t>::size_type pos = 0, std::vector<uint8_t>::size_type count = -1);
+    uint64_t finalize() const { return m_hash; }
+
+private:
+    uint64_t m_hash;
+};
+
+class Xxh64State
+{
+public:
+    Xxh64State();
+    explicit Xxh64State(uint64_t seed);
+    virtual ~Xxh64State() {}
+
+    void reset();
+    void reset(uint64_t seed);
+    void update(const uint8_t* data, size_t count);
+    void update(const std::vector<uint8_t>& data, std::vector<uint8_t>::size_type pos = 0, std::vector<uint8_t>::size_type count = -1);
+    uint64_t finalize() const;
+
+private:
+    uint64_t m_seed;
+    uint64_t m_acc[4];
+    uint64_t m_length;
+    uint8_t m_buffer[32];
+    size_t m_bufferSize;
+};
+
+class Xxh3State
+{
+public:
+    static constexpr size_t bufferSize = 256;
+    static constexpr size_t secretSize = 192;
+
+public:
+    Xxh3State();
+    explicit Xxh3State(uint64_t seed);
+    virtual ~Xxh3State() {}
+
+    void reset();
+    void reset(uint64_t seed);
+    void update(const uint8_t* data, size_t count);
+    void update(const std::vector<uint8_t>& data, std::vector<uint8_t>::size_type pos = 0, std::vector<uint8_t>::size_type count = -1);
+    uint64_t finalize() const;
+
+private:
+    uint64_t m_seed;
+    uint64_t m_acc[8];
+    uint64_t m_length;
+    size_t m_stripes; // number of stripes processed in the current block
+    uint8_t m_buffer[bufferSize];
+    size_t m_bufferSize;
+    uint8_t m_secret[secretSize];
+};
+
 /*! @} */
 
 namespace preview {
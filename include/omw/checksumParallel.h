@@ -0,0 +1,141 @@
+/*
+author          Oliver Blaser
+date            18.10.2026
+copyright       MIT - Copyright (c) 2026 Oliver Blaser
+*/
+
+#ifndef IG_OMW_CHECKSUMPARALLEL_H
+#define IG_OMW_CHECKSUMPARALLEL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <future>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../omw/checksum.h"
+#include "../omw/defs.h"
+#include "../omw/io/file.h"
+
+namespace omw {
+
+/*! \addtogroup grp_checksumLib
+ * @{
+ */
+
+#if (OMW_CPPSTD >= OMW_CPPSTD_14) || defined(OMWi_DOXYGEN_PREDEFINE)
+
+namespace internal {
+
+    // minimal number of bytes per worker, smaller inputs are not worth the thread overhead
+    constexpr uint64_t crcParallelMinChunk = 1024 * 1024;
+
+    // block size of the file reads of each worker
+    constexpr size_t crcParallelFileBlock = 1024 * 1024;
+
+    inline unsigned crcParallelWorkers(uint64_t count, unsigned threads)
+    {
+        if (threads == 0) threads = std::thread::hardware_concurrency();
+        if (threads == 0) threads = 1;
+
+        const uint64_t maxWorkers = count / crcParallelMinChunk;
+        if (maxWorkers < threads) threads = static_cast<unsigned>(maxWorkers > 0 ? maxWorkers : 1);
+
+        return threads;
+    }
+
+    template <class P> omw::CrcState<P> crcFileChunk(const std::string& filename, std::streamoff pos, std::streamoff count)
+    {
+        std::ifstream ifs;
+        ifs.exceptions(std::ios::badbit | std::ios::eofbit | std::ios::failbit);
+        ifs.open(filename, std::ios::in | std::ios::binary);
+        ifs.seekg(pos, std::ios::beg);
+
+        const std::streamoff block = static_cast<std::streamoff>(crcParallelFileBlock);
+        std::vector<uint8_t> buffer(static_cast<size_t>(count < block ? count : block));
+        omw::CrcState<P> state;
+
+        while (count > 0)
+        {
+            const std::streamoff n = (count < block ? count : block);
+            ifs.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(n));
+            state.update(buffer.data(), static_cast<size_t>(n));
+            count -= n;
+        }
+
+        return state;
+    }
+
+} // namespace internal
+
+template <class P> typename omw::Crc<P>::value_type crcParallel(const uint8_t* data, size_t count, unsigned threads = 0)
+{
+    const unsigned workers = omw::internal::crcParallelWorkers(count, threads);
+
+    if (!data || (workers <= 1)) return omw::Crc<P>::calc(data, count);
+
+    const size_t chunk = count / workers;
+    std::vector<std::future<omw::CrcState<P>>> futures;
+    futures.reserve(workers);
+
+    for (unsigned i = 0; i < workers; ++i)
+    {
+        const uint8_t* const p = data + (chunk * i);
+        const size_t n = (i == (workers - 1)) ? (count - (chunk * i)) : chunk;
+
+        futures.push_back(std::async(std::launch::async, [p, n]() {
+            omw::CrcState<P> state;
+            state.update(p, n);
+            return state;
+        }));
+    }
+
+    omw::CrcState<P> state = futures[0].get();
+    for (unsigned i = 1; i < workers; ++i) state.append(futures[i].get());
+
+    return state.finalize();
+}
+
+template <class P> typename omw::Crc<P>::value_type crcParallel(const omw::io::BinFileInterface& file, unsigned threads = 0)
+{
+    std::ifstream ifs;
+    ifs.exceptions(std::ios::badbit | std::ios::failbit);
+    ifs.open(file.filename(), std::ios::in | std::ios::binary);
+    ifs.seekg(0, std::ios::end);
+    const std::streamoff size = static_cast<std::streamoff>(ifs.tellg());
+    ifs.close();
+
+    if (size < 0) throw std::runtime_error("omw::crcParallel");
+
+    const unsigned workers = omw::internal::crcParallelWorkers(static_cast<uint64_t>(size), threads);
+    const std::streamoff chunk = size / workers;
+
+    // all chunks are read by their own stream, the calling thread processes the last one
+    std::vector<std::future<omw::CrcState<P>>> futures;
+    futures.reserve(workers - 1);
+
+    for (unsigned i = 0; i < (workers - 1); ++i)
+    {
+        futures.push_back(std::async(std::launch::async, omw::internal::crcFileChunk<P>, file.filename(), chunk * i, chunk));
+    }
+
+    const omw::CrcState<P> last = omw::internal::crcFileChunk<P>(file.filename(), chunk * (workers - 1), size - (chunk * (workers - 1)));
+
+    omw::CrcState<P> state;
+    for (auto& f : futures) state.append(f.get());
+    state.append(last);
+
+    return state.finalize();
+}
+
+#endif // C++14
+
+/*! @} */
+
+} // namespace omw
+
+
+#endif // IG_OMW_CHECKSUMPARALLEL_H
@@ -197,6 +197,33 @@ copyright       MIT - Copyright (c) 2022 Oliver Blaser
 
 
 
+//! \name Byte Order
+//!
+//! `#include <omw/defs.h>`
+//!
+//! Only one is defined, depending on the byte order of the target. None is defined if the byte order is unknown.
+//!
+/// @{
+
+#ifndef OMWi_DOXYGEN_PREDEFINE
+
+#if defined(OMW_CXX_MSVC)
+#define OMW_BYTE_ORDER_LITTLE (1)
+#elif defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#define OMW_BYTE_ORDER_LITTLE (1)
+#elif defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+#define OMW_BYTE_ORDER_BIG (1)
+#endif
+
+#else // OMWi_DOXYGEN_PREDEFINE
+#define OMW_BYTE_ORDER_LITTLE (1)
+#define OMW_BYTE_ORDER_BIG    (1)
+#endif // OMWi_DOXYGEN_PREDEFINE
+
+/// @}
+
+
+
 //! \name C++ Standard Version
 //! `#include <omw/defs.h>`
 /// @{
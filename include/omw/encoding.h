@@ -8,7 +8,10 @@ copyright       MIT - Copyright (c) 2024 Oliver Blaser
 
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include "../omw/defs.h"
@@ -21,26 +24,153 @@ namespace omw {
  * @{
  */
 
-// namespace bcd
-//{
-//     uint8_t decode8(const uint8_t* data, size_t count);
-//     uint16_t decode16(const uint8_t* data, size_t count);
-//     uint32_t decode32(const uint8_t* data, size_t count);
-//     uint64_t decode64(const uint8_t* data, size_t count);
-//     omw::uint128_t decode128(const uint8_t* data, size_t count);
-//
-//     void encode(uint8_t* buffer, size_t bufferSize, uint64_t value);
-//     void encode(uint8_t* buffer, size_t bufferSize, const omw::uint128_t& value);
-// }
+namespace bcd {
+
+    uint8_t decode8(const uint8_t* data, size_t count);
+    uint16_t decode16(const uint8_t* data, size_t count);
+    uint32_t decode32(const uint8_t* data, size_t count);
+    uint64_t decode64(const uint8_t* data, size_t count);
+    omw::uint128_t decode128(const uint8_t* data, size_t count);
+
+    void encode(uint8_t* buffer, size_t bufferSize, uint64_t value);
+    void encode(uint8_t* buffer, size_t bufferSize, const omw::uint128_t& value);
+
+} // namespace bcd
+
+namespace internal {
+
+    // fixed width big endian load, a plain copy plus a byte swap on little endian hosts, compilers translate this into a single (movbe/bswap) load
+    template <typename T> inline T loadBE(const uint8_t* p)
+    {
+        using U = typename std::make_unsigned<T>::type;
+        U r;
+#if defined(OMW_BYTE_ORDER_LITTLE)
+        std::memcpy(&r, p, sizeof(U));
+        r = omw::internal::bit::bswap(r);
+#elif defined(OMW_BYTE_ORDER_BIG)
+        std::memcpy(&r, p, sizeof(U));
+#else
+        r = 0;
+        for (size_t i = 0; i < sizeof(U); ++i) r = static_cast<U>((static_cast<uint64_t>(r) << 8) | p[i]);
+#endif
+        return static_cast<T>(r);
+    }
+
+    // fixed width little endian load, a plain copy plus a byte swap on big endian hosts
+    template <typename T> inline T loadLE(const uint8_t* p)
+    {
+        using U = typename std::make_unsigned<T>::type;
+        U r;
+#if defined(OMW_BYTE_ORDER_LITTLE)
+        std::memcpy(&r, p, sizeof(U));
+#elif defined(OMW_BYTE_ORDER_BIG)
+        std::memcpy(&r, p, sizeof(U));
+        r = omw::internal::bit::bswap(r);
+#else
+        r = 0;
+        for (size_t i = sizeof(U); i > 0; --i) r = static_cast<U>((static_cast<uint64_t>(r) << 8) | p[i - 1]);
+#endif
+        return static_cast<T>(r);
+    }
+
+    // fixed width big endian store, the counterpart of `loadBE()`
+    template <typename T> inline void storeBE(uint8_t* p, T value)
+    {
+        using U = typename std::make_unsigned<T>::type;
+        U v = static_cast<U>(value);
+#if defined(OMW_BYTE_ORDER_LITTLE)
+        v = omw::internal::bit::bswap(v);
+        std::memcpy(p, &v, sizeof(U));
+#elif defined(OMW_BYTE_ORDER_BIG)
+        std::memcpy(p, &v, sizeof(U));
+#else
+        for (size_t i = 0; i < sizeof(U); ++i) p[i] = static_cast<uint8_t>(static_cast<uint64_t>(v) >> (8 * (sizeof(U) - 1 - i)));
+#endif
+    }
+
+    // fixed width little endian store, the counterpart of `loadLE()`
+    template <typename T> inline void storeLE(uint8_t* p, T value)
+    {
+        using U = typename std::make_unsigned<T>::type;
+        U v = static_cast<U>(value);
+#if defined(OMW_BYTE_ORDER_LITTLE)
+        std::memcpy(p, &v, sizeof(U));
+#elif defined(OMW_BYTE_ORDER_BIG)
+        v = omw::internal::bit::bswap(v);
+        std::memcpy(p, &v, sizeof(U));
+#else
+        for (size_t i = 0; i < sizeof(U); ++i) p[i] = static_cast<uint8_t>(static_cast<uint64_t>(v) >> (8 * i));
+#endif
+    }
+
+    // checked decode of `count` bytes, out of line, only called for the partial width case
+    template <typename T> T bigEndian_decode(const uint8_t* data, size_t count, const char* fnName);
+    template <typename T> T littleEndian_decode(const uint8_t* data, size_t count, const char* fnName);
+
+    template <typename T> inline T bigEndian_decodeFixed(const uint8_t* data, size_t count, const char* fnName)
+    {
+        if (data && (count == sizeof(T))) return omw::internal::loadBE<T>(data);
+        return omw::internal::bigEndian_decode<T>(data, count, fnName);
+    }
+
+    template <typename T> inline T littleEndian_decodeFixed(const uint8_t* data, size_t count, const char* fnName)
+    {
+        if (data && (count == sizeof(T))) return omw::internal::loadLE<T>(data);
+        return omw::internal::littleEndian_decode<T>(data, count, fnName);
+    }
+
+} // namespace internal
 
 namespace bigEndian {
 
-    int16_t decode_i16(const uint8_t* data, size_t count = 2);
-    uint16_t decode_ui16(const uint8_t* data, size_t count = 2);
-    int32_t decode_i32(const uint8_t* data, size_t count = 4);
-    uint32_t decode_ui32(const uint8_t* data, size_t count = 4);
-    int64_t decode_i64(const uint8_t* data, size_t count = 8);
-    uint64_t decode_ui64(const uint8_t* data, size_t count = 8);
+    //!
+    //! See \ref ns_omw_bigEndian_section_decodeFn.
+    //!
+    inline int16_t decode_i16(const uint8_t* data, size_t count = 2)
+    {
+        return omw::internal::bigEndian_decodeFixed<int16_t>(data, count, "omw::bigEndian::decode_i16");
+    }
+
+    //!
+    //! See \ref ns_omw_bigEndian_section_decodeFn.
+    //!
+    inline uint16_t decode_ui16(const uint8_t* data, size_t count = 2)
+    {
+        return omw::internal::bigEndian_decodeFixed<uint16_t>(data, count, "omw::bigEndian::decode_ui16");
+    }
+
+    //!
+    //! See \ref ns_omw_bigEndian_section_decodeFn.
+    //!
+    inline int32_t decode_i32(const uint8_t* data, size_t count = 4)
+    {
+        return omw::internal::bigEndian_decodeFixed<int32_t>(data, count, "omw::bigEndian::decode_i32");
+    }
+
+    //!
+    //! See \ref ns_omw_bigEndian_section_decodeFn.
+    //!
+    inline uint32_t decode_ui32(const uint8_t* data, size_t count = 4)
+    {
+        return omw::internal::bigEndian_decodeFixed<uint32_t>(data, count, "omw::bigEndian::decode_ui32");
+    }
+
+    //!
+    //! See \ref ns_omw_bigEndian_section_decodeFn.
+    //!
+    inline int64_t decode_i64(const uint8_t* data, size_t count = 8)
+    {
+        return omw::internal::bigEndian_decodeFixed<int64_t>(data, count, "omw::bigEndian::decode_i64");
+    }
+
+    //!
+    //! See \ref ns_omw_bigEndian_section_decodeFn.
+    //!
+    inline uint64_t decode_ui64(const uint8_t* data, size_t count = 8)
+    {
+        return omw::internal::bigEndian_decodeFixed<uint64_t>(data, count, "omw::bigEndian::decode_ui64");
+    }
+
     omw::int128_t decode_i128(const uint8_t* data, size_t count = 16);
     omw::uint128_t decode_ui128(const uint8_t* data, size_t count = 16);
 
@@ -52,8 +182,356 @@ namespace bigEndian {
     void encode_64(uint8_t* buffer, uint64_t value);
     void encode_128(uint8_t* buffer, const omw::Base_Int128& value);
 
+    void decode_i16(const uint8_t* src, int16_t* dst, size_t n);
+    void decode_ui16(const uint8_t* src, uint16_t* dst, size_t n);
+    void decode_i32(const uint8_t* src, int32_t* dst, size_t n);
+    void decode_ui32(const uint8_t* src, uint32_t* dst, size_t n);
+    void decode_i64(const uint8_t* src, int64_t* dst, size_t n);
+    void decode_ui64(const uint8_t* src, uint64_t* dst, size_t n);
+
+    void encode_16(uint8_t* dst, const int16_t* src, size_t n);
+    void encode_16(uint8_t* dst, const uint16_t* src, size_t n);
+    void encode_32(uint8_t* dst, const int32_t* src, size_t n);
+    void encode_32(uint8_t* dst, const uint32_t* src, size_t n);
+    void encode_64(uint8_t* dst, const int64_t* src, size_t n);
+    void encode_64(uint8_t* dst, const uint64_t* src, size_t n);
+
 } // namespace bigEndian
 
+namespace littleEndian {
+
+    //!
+    //! See \ref ns_omw_littleEndian_section_decodeFn.
+    //!
+    inline int16_t decode_i16(const uint8_t* data, size_t count = 2)
+    {
+        return omw::internal::littleEndian_decodeFixed<int16_t>(data, count, "omw::littleEndian::decode_i16");
+    }
+
+    //!
+    //! See \ref ns_omw_littleEndian_section_decodeFn.
+    //!
+    inline uint16_t decode_ui16(const uint8_t* data, size_t count = 2)
+    {
+        return omw::internal::littleEndian_decodeFixed<uint16_t>(data, count, "omw::littleEndian::decode_ui16");
+    }
+
+    //!
+    //! See \ref ns_omw_littleEndian_section_decodeFn.
+    //!
+    inline int32_t decode_i32(const uint8_t* data, size_t count = 4)
+    {
+        return omw::internal::littleEndian_decodeFixed<int32_t>(data, count, "omw::littleEndian::decode_i32");
+    }
+
+    //!
+    //! See \ref ns_omw_littleEndian_section_decodeFn.
+    //!
+    inline uint32_t decode_ui32(const uint8_t* data, size_t count = 4)
+    {
+        return omw::internal::littleEndian_decodeFixed<uint32_t>(data, count, "omw::littleEndian::decode_ui32");
+    }
+
+    //!
+    //! See \ref ns_omw_littleEndian_section_decodeFn.
+    //!
+    inline int64_t decode_i64(const uint8_t* data, size_t count = 8)
+    {
+        return omw::internal::littleEndian_decodeFixed<int64_t>(data, count, "omw::littleEndian::decode_i64");
+    }
+
+    //!
+    //! See \ref ns_omw_littleEndian_section_decodeFn.
+    //!
+    inline uint64_t decode_ui64(const uint8_t* data, size_t count = 8)
+    {
+        return omw::internal::littleEndian_decodeFixed<uint64_t>(data, count, "omw::littleEndian::decode_ui64");
+    }
+
+    omw::int128_t decode_i128(const uint8_t* data, size_t count = 16);
+    omw::uint128_t decode_ui128(const uint8_t* data, size_t count = 16);
+
+    void encode_16(uint8_t* buffer, int16_t value);
+    void encode_16(uint8_t* buffer, uint16_t value);
+    void encode_32(uint8_t* buffer, int32_t value);
+    void encode_32(uint8_t* buffer, uint32_t value);
+    void encode_64(uint8_t* buffer, int64_t value);
+    void encode_64(uint8_t* buffer, uint64_t value);
+    void encode_128(uint8_t* buffer, const omw::Base_Int128& value);
+
+    void decode_i16(const uint8_t* src, int16_t* dst, size_t n);
+    void decode_ui16(const uint8_t* src, uint16_t* dst, size_t n);
+    void decode_i32(const uint8_t* src, int32_t* dst, size_t n);
+    void decode_ui32(const uint8_t* src, uint32_t* dst, size_t n);
+    void decode_i64(const uint8_t* src, int64_t* dst, size_t n);
+    void decode_ui64(const uint8_t* src, uint64_t* dst, size_t n);
+
+    void encode_16(uint8_t* dst, const int16_t* src, size_t n);
+    void encode_16(uint8_t* dst, const uint16_t* src, size_t n);
+    void encode_32(uint8_t* dst, const int32_t* src, size_t n);
+    void encode_32(uint8_t* dst, const uint32_t* src, size_t n);
+    void encode_64(uint8_t* dst, const int64_t* src, size_t n);
+    void encode_64(uint8_t* dst, const uint64_t* src, size_t n);
+
+} // namespace littleEndian
+
+#if defined(OMW_BYTE_ORDER_LITTLE) || defined(OMWi_DOXYGEN_PREDEFINE)
+namespace nativeEndian = omw::littleEndian;
+#elif defined(OMW_BYTE_ORDER_BIG)
+namespace nativeEndian = omw::bigEndian;
+#endif
+
+namespace varint {
+
+    constexpr size_t maxSize32 = 5;
+    constexpr size_t maxSize64 = 10;
+    constexpr size_t maxSize128 = 19;
+
+    constexpr uint32_t zigzagEncode(int32_t value) { return ((value < 0) ? ~(static_cast<uint32_t>(value) << 1) : (static_cast<uint32_t>(value) << 1)); }
+    constexpr uint64_t zigzagEncode(int64_t value) { return ((value < 0) ? ~(static_cast<uint64_t>(value) << 1) : (static_cast<uint64_t>(value) << 1)); }
+    constexpr int32_t zigzagDecode(uint32_t value) { return static_cast<int32_t>((value & 1) ? ~(value >> 1) : (value >> 1)); }
+    constexpr int64_t zigzagDecode(uint64_t value) { return static_cast<int64_t>((value & 1) ? ~(value >> 1) : (value >> 1)); }
+    omw::uint128_t zigzagEncode(const omw::int128_t& value);
+    omw::int128_t zigzagDecode(const omw::uint128_t& value);
+
+    uint32_t decode_ui32(const uint8_t* data, size_t count, size_t* length = nullptr);
+    uint64_t decode_ui64(const uint8_t* data, size_t count, size_t* length = nullptr);
+    omw::uint128_t decode_ui128(const uint8_t* data, size_t count, size_t* length = nullptr);
+    int32_t decodeZigzag_i32(const uint8_t* data, size_t count, size_t* length = nullptr);
+    int64_t decodeZigzag_i64(const uint8_t* data, size_t count, size_t* length = nullptr);
+    omw::int128_t decodeZigzag_i128(const uint8_t* data, size_t count, size_t* length = nullptr);
+
+    size_t encode_32(uint8_t* buffer, uint32_t value);
+    size_t encode_64(uint8_t* buffer, uint64_t value);
+    size_t encode_128(uint8_t* buffer, const omw::uint128_t& value);
+    size_t encodeZigzag_32(uint8_t* buffer, int32_t value);
+    size_t encodeZigzag_64(uint8_t* buffer, int64_t value);
+    size_t encodeZigzag_128(uint8_t* buffer, const omw::int128_t& value);
+
+    size_t decode_ui32(const uint8_t* src, size_t count, uint32_t* dst, size_t n);
+    size_t decode_ui64(const uint8_t* src, size_t count, uint64_t* dst, size_t n);
+    size_t decodeZigzag_i32(const uint8_t* src, size_t count, int32_t* dst, size_t n);
+    size_t decodeZigzag_i64(const uint8_t* src, size_t count, int64_t* dst, size_t n);
+
+} // namespace varint
+
+namespace internal {
+
+    // fixed width codec of the types supported by `omw::ByteReader` and `omw::ByteWriter`
+    template <typename T> struct ByteCodec
+    {
+        static_assert(std::is_integral<T>::value && !std::is_same<T, bool>::value, "invalid type");
+
+        static constexpr size_t size = sizeof(T);
+
+        static T loadBE(const uint8_t* p) { return omw::internal::loadBE<T>(p); }
+        static T loadLE(const uint8_t* p) { return omw::internal::loadLE<T>(p); }
+        static void storeBE(uint8_t* p, T value) { omw::internal::storeBE<T>(p, value); }
+        static void storeLE(uint8_t* p, T value) { omw::internal::storeLE<T>(p, value); }
+    };
+
+    template <typename T> struct ByteCodec128
+    {
+        static constexpr size_t size = 16;
+
+        static T loadBE(const uint8_t* p) { return T(omw::internal::loadBE<uint64_t>(p), omw::internal::loadBE<uint64_t>(p + 8)); }
+        static T loadLE(const uint8_t* p) { return T(omw::internal::loadLE<uint64_t>(p + 8), omw::internal::loadLE<uint64_t>(p)); }
+
+        static void storeBE(uint8_t* p, const T& value)
+        {
+            omw::internal::storeBE<uint64_t>(p, value.hi());
+            omw::internal::storeBE<uint64_t>(p + 8, value.lo());
+        }
+
+        static void storeLE(uint8_t* p, const T& value)
+        {
+            omw::internal::storeLE<uint64_t>(p, value.lo());
+            omw::internal::storeLE<uint64_t>(p + 8, value.hi());
+        }
+    };
+
+    template <> struct ByteCodec<omw::int128_t> : public ByteCodec128<omw::int128_t>
+    {};
+
+    template <> struct ByteCodec<omw::uint128_t> : public ByteCodec128<omw::uint128_t>
+    {};
+
+    template <typename... Ts> struct ByteCodecSize;
+    template <> struct ByteCodecSize<>
+    {
+        static constexpr size_t value = 0;
+    };
+    template <typename T, typename... Ts> struct ByteCodecSize<T, Ts...>
+    {
+        static constexpr size_t value = ByteCodec<T>::size + ByteCodecSize<Ts...>::value;
+    };
+
+} // namespace internal
+
+class ByteReader
+{
+public:
+    ByteReader();
+    ByteReader(const uint8_t* data, size_t size);
+    explicit ByteReader(const std::vector<uint8_t>& data);
+    virtual ~ByteReader() {}
+
+    const uint8_t* data() const { return m_data; }
+    size_t size() const { return m_size; }
+    size_t pos() const { return m_pos; }
+    size_t remaining() const { return (m_size - m_pos); }
+    bool atEnd() const { return (m_pos >= m_size); }
+
+    void seek(size_t pos);
+    void skip(size_t count);
+
+    template <typename T> T getBE() { return omw::internal::ByteCodec<T>::loadBE(m_take(omw::internal::ByteCodec<T>::size, "omw::ByteReader::getBE")); }
+    template <typename T> T getLE() { return omw::internal::ByteCodec<T>::loadLE(m_take(omw::internal::ByteCodec<T>::size, "omw::ByteReader::getLE")); }
+
+    template <typename T, typename... Ts> void getBE(T& value, Ts&... values)
+    {
+        m_loadBE(m_take(omw::internal::ByteCodecSize<T, Ts...>::value, "omw::ByteReader::getBE"), value, values...);
+    }
+
+    template <typename T, typename... Ts> void getLE(T& value, Ts&... values)
+    {
+        m_loadLE(m_take(omw::internal::ByteCodecSize<T, Ts...>::value, "omw::ByteReader::getLE"), value, values...);
+    }
+
+    const uint8_t* getBytes(size_t count);
+    omw::ByteReader getReader(size_t count);
+    std::string getString(size_t count);
+    template <typename L> std::string getStringBE()
+    {
+        const size_t start = m_pos;
+        return m_getString(start, m_length(getBE<L>()), "omw::ByteReader::getStringBE");
+    }
+
+    template <typename L> std::string getStringLE()
+    {
+        const size_t start = m_pos;
+        return m_getString(start, m_length(getLE<L>()), "omw::ByteReader::getStringLE");
+    }
+
+    std::string getStringVarint();
+    uint64_t getVarint();
+
+private:
+    const uint8_t* m_data;
+    size_t m_size;
+    size_t m_pos;
+
+    const uint8_t* m_take(size_t count, const char* fnName)
+    {
+        if (count > remaining()) throw std::out_of_range(fnName);
+
+        const uint8_t* const p = m_data + m_pos;
+        m_pos += count;
+        return p;
+    }
+
+    std::string m_getString(size_t start, uint64_t count, const char* fnName);
+
+    template <typename L> static uint64_t m_length(L length)
+    {
+        static_assert(std::is_unsigned<L>::value, "the length prefix has to be unsigned");
+        return length;
+    }
+
+    static void m_loadBE(const uint8_t*) {}
+    static void m_loadLE(const uint8_t*) {}
+
+    template <typename T, typename... Ts> static void m_loadBE(const uint8_t* p, T& value, Ts&... values)
+    {
+        value = omw::internal::ByteCodec<T>::loadBE(p);
+        m_loadBE(p + omw::internal::ByteCodec<T>::size, values...);
+    }
+
+    template <typename T, typename... Ts> static void m_loadLE(const uint8_t* p, T& value, Ts&... values)
+    {
+        value = omw::internal::ByteCodec<T>::loadLE(p);
+        m_loadLE(p + omw::internal::ByteCodec<T>::size, values...);
+    }
+};
+
+class ByteWriter
+{
+public:
+    ByteWriter();
+    ByteWriter(uint8_t* data, size_t size);
+    explicit ByteWriter(std::vector<uint8_t>& data);
+    virtual ~ByteWriter() {}
+
+    uint8_t* data() const { return m_data; }
+    size_t size() const { return m_size; }
+    size_t pos() const { return m_pos; }
+    size_t remaining() const { return (m_size - m_pos); }
+    bool atEnd() const { return (m_pos >= m_size); }
+
+    void seek(size_t pos);
+    void skip(size_t count);
+
+    template <typename T, typename... Ts> void putBE(const T& value, const Ts&... values)
+    {
+        m_storeBE(m_take(omw::internal::ByteCodecSize<T, Ts...>::value, "omw::ByteWriter::putBE"), value, values...);
+    }
+
+    template <typename T, typename... Ts> void putLE(const T& value, const Ts&... values)
+    {
+        m_storeLE(m_take(omw::internal::ByteCodecSize<T, Ts...>::value, "omw::ByteWriter::putLE"), value, values...);
+    }
+
+    void putBytes(const uint8_t* data, size_t count);
+    void putString(const std::string& str);
+    template <typename L> void putStringBE(const std::string& str) { m_putString<L>(str, true); }
+    template <typename L> void putStringLE(const std::string& str) { m_putString<L>(str, false); }
+    void putStringVarint(const std::string& str);
+    void putVarint(uint64_t value);
+
+private:
+    uint8_t* m_data;
+    size_t m_size;
+    size_t m_pos;
+
+    uint8_t* m_take(size_t count, const char* fnName)
+    {
+        if (count > remaining()) throw std::out_of_range(fnName);
+
+        uint8_t* const p = m_data + m_pos;
+        m_pos += count;
+        return p;
+    }
+
+    template <typename L> void m_putString(const std::string& str, bool bigEndian)
+    {
+        static_assert(std::is_unsigned<L>::value, "the length prefix has to be unsigned");
+
+        const char* const fnName = (bigEndian ? "omw::ByteWriter::putStringBE" : "omw::ByteWriter::putStringLE");
+        const uint64_t maxLength = static_cast<L>(-1);
+        if (str.length() > maxLength) throw std::overflow_error(fnName);
+
+        uint8_t* const p = m_take(omw::internal::ByteCodec<L>::size + str.length(), fnName);
+        if (bigEndian) omw::internal::ByteCodec<L>::storeBE(p, static_cast<L>(str.length()));
+        else omw::internal::ByteCodec<L>::storeLE(p, static_cast<L>(str.length()));
+        for (size_t i = 0; i < str.length(); ++i) p[omw::internal::ByteCodec<L>::size + i] = static_cast<uint8_t>(str[i]);
+    }
+
+    static void m_storeBE(uint8_t*) {}
+    static void m_storeLE(uint8_t*) {}
+
+    template <typename T, typename... Ts> static void m_storeBE(uint8_t* p, const T& value, const Ts&... values)
+    {
+        omw::internal::ByteCodec<T>::storeBE(p, value);
+        m_storeBE(p + omw::internal::ByteCodec<T>::size, values...);
+    }
+
+    template <typename T, typename... Ts> static void m_storeLE(uint8_t* p, const T& value, const Ts&... values)
+    {
+        omw::internal::ByteCodec<T>::storeLE(p, value);
+        m_storeLE(p + omw::internal::ByteCodec<T>::size, values...);
+    }
+};
+
 /*! @} */
 
 } // namespace omw
@@ -10,8 +10,16 @@ copyright       MIT - Copyright (c) 2022 Oliver Blaser
 #include <cstddef>
 #include <cstdint>
 
+#include "../omw/defs.h"
 #include "../omw/intdef.h"
 
+#include <stdexcept>
+#include <type_traits>
+
+#if defined(OMW_CXX_MSVC) && defined(OMW_PARCH_x86_64)
+#include <intrin.h>
+#endif
+
 
 /*! \addtogroup grp_utility_langSupport_typeSupport
  * @{
@@ -29,6 +37,370 @@ copyright       MIT - Copyright (c) 2022 Oliver Blaser
 
 // #define OMWi_INT_RIGHTSHIFT_DEBUG (1) // def/undef
 
+/*! \addtogroup grp_utility_langSupport_typeSupport
+ * @{
+ */
+
+/**
+ * Defined if the 128-bit integer operations are implemented with the compilers native `__int128` type (GCC and Clang on 64-bit targets).
+ * Otherwise the portable implementation on two 64-bit halves is used. The memory layout of the types is the same for both.
+ */
+#if (defined(__SIZEOF_INT128__) && (defined(OMW_CXX_GCC) || defined(OMW_CXX_CLANG))) || defined(OMWi_DOXYGEN_PREDEFINE)
+#define OMW_INT128_NATIVE (1)
+#endif
+
+/*! @} */
+
+#if (OMW_CPPSTD >= OMW_CPPSTD_14)
+#define OMWi_INT128_CONSTEXPR constexpr
+#else
+#define OMWi_INT128_CONSTEXPR
+#endif
+
+
+namespace omw {
+namespace internal {
+    namespace bit {
+
+        // Bit primitives on 64-bit words, `constexpr` since C++11. The compiler builtins are used on GCC and Clang.
+
+        template <typename T>
+        using EnableIfUInt = std::enable_if<std::is_integral<T>::value && std::is_unsigned<T>::value && !std::is_same<typename std::remove_cv<T>::type, bool>::value>;
+
+        // Without the popcnt instruction enabled at compile time, `__builtin_popcountll()` is a library call, the SWAR variant is faster.
+#if (defined(OMW_CXX_GCC) || defined(OMW_CXX_CLANG)) && defined(__POPCNT__) && !defined(OMWi_DOXYGEN_PREDEFINE)
+        constexpr unsigned int popcount64(uint64_t value) { return static_cast<unsigned int>(__builtin_popcountll(value)); }
+#else
+        constexpr uint64_t popcount_2(uint64_t v) { return (v - ((v >> 1) & 0x5555555555555555)); }
+        constexpr uint64_t popcount_4(uint64_t v) { return ((v & 0x3333333333333333) + ((v >> 2) & 0x3333333333333333)); }
+        constexpr uint64_t popcount_8(uint64_t v) { return ((v + (v >> 4)) & 0x0F0F0F0F0F0F0F0F); }
+        constexpr unsigned int popcount64(uint64_t value) { return static_cast<unsigned int>((popcount_8(popcount_4(popcount_2(value))) * 0x0101010101010101) >> 56); }
+#endif
+
+#if (defined(OMW_CXX_GCC) || defined(OMW_CXX_CLANG)) && !defined(OMWi_DOXYGEN_PREDEFINE)
+
+        constexpr unsigned int clz64(uint64_t value) { return (value ? static_cast<unsigned int>(__builtin_clzll(value)) : 64); }
+        constexpr unsigned int ctz64(uint64_t value) { return (value ? static_cast<unsigned int>(__builtin_ctzll(value)) : 64); }
+        constexpr uint16_t bswap16(uint16_t value) { return __builtin_bswap16(value); }
+        constexpr uint32_t bswap32(uint32_t value) { return __builtin_bswap32(value); }
+        constexpr uint64_t bswap64(uint64_t value) { return __builtin_bswap64(value); }
+
+#else
+
+        // binary search, `value` must not be 0
+        constexpr unsigned int clz64_step(uint64_t value, unsigned int s)
+        {
+            return ((s == 0) ? 0 : (((value >> (64 - s)) == 0) ? (s + clz64_step(value << s, s / 2)) : clz64_step(value, s / 2)));
+        }
+
+        constexpr unsigned int clz64(uint64_t value) { return (value ? clz64_step(value, 32) : 64); }
+        constexpr unsigned int ctz64(uint64_t value) { return popcount64((value & (0 - value)) - 1); }
+
+        constexpr uint16_t bswap16(uint16_t value) { return static_cast<uint16_t>((value << 8) | (value >> 8)); }
+        constexpr uint32_t bswap32(uint32_t value)
+        {
+            return (((value & 0x000000FF) << 24) | ((value & 0x0000FF00) << 8) | ((value >> 8) & 0x0000FF00) | (value >> 24));
+        }
+        constexpr uint64_t bswap64(uint64_t value) { return ((static_cast<uint64_t>(bswap32(static_cast<uint32_t>(value))) << 32) | bswap32(static_cast<uint32_t>(value >> 32))); }
+
+#endif
+
+        template <typename T> constexpr T rotl(T value, unsigned int n)
+        {
+            using W = typename std::conditional<(sizeof(T) > sizeof(uint32_t)), uint64_t, uint32_t>::type;
+            return static_cast<T>((static_cast<W>(value) << (n & (sizeof(T) * 8 - 1))) | (static_cast<W>(value) >> ((0u - n) & (sizeof(T) * 8 - 1))));
+        }
+
+        template <typename T> constexpr T bswap(T value)
+        {
+            return ((sizeof(T) == 8)   ? static_cast<T>(bswap64(static_cast<uint64_t>(value)))
+                    : (sizeof(T) == 4) ? static_cast<T>(bswap32(static_cast<uint32_t>(value)))
+                    : (sizeof(T) == 2) ? static_cast<T>(bswap16(static_cast<uint16_t>(value)))
+                                       : value);
+        }
+
+    } // namespace bit
+
+    namespace int128 {
+
+        // Operations on the high and low halves of a 128-bit integer, implemented with __int128 if available.
+
+        constexpr uint64_t allBits = OMW_64BIT_ALL;
+
+#if defined(OMW_INT128_NATIVE) && !defined(OMWi_DOXYGEN_PREDEFINE)
+
+        __extension__ typedef unsigned __int128 native_u128;
+        __extension__ typedef __int128 native_i128;
+
+        OMWi_INT128_CONSTEXPR inline native_u128 join(uint64_t h, uint64_t l) { return ((static_cast<native_u128>(h) << 64) | l); }
+
+        OMWi_INT128_CONSTEXPR inline void split(native_u128 value, uint64_t& h, uint64_t& l)
+        {
+            h = static_cast<uint64_t>(value >> 64);
+            l = static_cast<uint64_t>(value);
+        }
+
+        OMWi_INT128_CONSTEXPR inline void add(uint64_t& h, uint64_t& l, uint64_t bh, uint64_t bl) { split(join(h, l) + join(bh, bl), h, l); }
+        OMWi_INT128_CONSTEXPR inline void sub(uint64_t& h, uint64_t& l, uint64_t bh, uint64_t bl) { split(join(h, l) - join(bh, bl), h, l); }
+
+        OMWi_INT128_CONSTEXPR inline void shl(uint64_t& h, uint64_t& l, unsigned int count)
+        {
+            if (count < 128) split(join(h, l) << count, h, l);
+            else h = l = 0;
+        }
+
+        OMWi_INT128_CONSTEXPR inline void shr(uint64_t& h, uint64_t& l, unsigned int count)
+        {
+            if (count < 128) split(join(h, l) >> count, h, l);
+            else h = l = 0;
+        }
+
+        OMWi_INT128_CONSTEXPR inline void sar(uint64_t& h, uint64_t& l, unsigned int count)
+        {
+            if (count > 127) count = 127;
+            split(static_cast<native_u128>(static_cast<native_i128>(join(h, l)) >> count), h, l);
+        }
+
+        OMWi_INT128_CONSTEXPR inline void cmul64(uint64_t a, uint64_t b, uint64_t& h, uint64_t& l) { split(static_cast<native_u128>(a) * b, h, l); }
+        OMWi_INT128_CONSTEXPR inline void cmul(uint64_t& h, uint64_t& l, uint64_t bh, uint64_t bl) { split(join(h, l) * join(bh, bl), h, l); }
+        inline void mul64(uint64_t a, uint64_t b, uint64_t& h, uint64_t& l) { cmul64(a, b, h, l); }
+        inline void mul(uint64_t& h, uint64_t& l, uint64_t bh, uint64_t bl) { cmul(h, l, bh, bl); }
+
+        OMWi_INT128_CONSTEXPR inline bool lessU(uint64_t ah, uint64_t al, uint64_t bh, uint64_t bl) { return (join(ah, al) < join(bh, bl)); }
+        OMWi_INT128_CONSTEXPR inline bool lessS(uint64_t ah, uint64_t al, uint64_t bh, uint64_t bl)
+        {
+            return (static_cast<native_i128>(join(ah, al)) < static_cast<native_i128>(join(bh, bl)));
+        }
+
+#else // OMW_INT128_NATIVE
+
+        OMWi_INT128_CONSTEXPR inline void add(uint64_t& h, uint64_t& l, uint64_t bh, uint64_t bl)
+        {
+            const uint64_t l_old = l;
+            h += bh;
+            l += bl;
+            if (l < l_old) { ++h; }
+        }
+
+        OMWi_INT128_CONSTEXPR inline void sub(uint64_t& h, uint64_t& l, uint64_t bh, uint64_t bl)
+        {
+            if (l < bl) { --h; }
+            h -= bh;
+            l -= bl;
+        }
+
+        OMWi_INT128_CONSTEXPR inline void shl(uint64_t& h, uint64_t& l, unsigned int count)
+        {
+            if (count == 0) {}
+            else if (count < 64)
+            {
+                h = (h << count) | (l >> (64 - count));
+                l <<= count;
+            }
+            else if (count < 128)
+            {
+                h = (l << (count - 64));
+                l = 0;
+            }
+            else h = l = 0;
+        }
+
+        OMWi_INT128_CONSTEXPR inline void shr(uint64_t& h, uint64_t& l, unsigned int count)
+        {
+            if (count == 0) {}
+            else if (count < 64)
+            {
+                l = (l >> count) | (h << (64 - count));
+                h >>= count;
+            }
+            else if (count < 128)
+            {
+                l = (h >> (count - 64));
+                h = 0;
+            }
+            else h = l = 0;
+        }
+
+        OMWi_INT128_CONSTEXPR inline void sar(uint64_t& h, uint64_t& l, unsigned int count)
+        {
+            const uint64_t fill = ((h & OMW_64BIT_MSB) ? allBits : 0);
+
+            if (count == 0) {}
+            else if (count < 64)
+            {
+                l = (l >> count) | (h << (64 - count));
+                h = (h >> count) | (fill << (64 - count));
+            }
+            else if (count == 64)
+            {
+                l = h;
+                h = fill;
+            }
+            else if (count < 128)
+            {
+                l = (h >> (count - 64)) | (fill << (128 - count));
+                h = fill;
+            }
+            else h = l = fill;
+        }
+
+        // constexpr multiplication, `_umul128()` can't be used during constant evaluation
+        OMWi_INT128_CONSTEXPR inline void cmul64(uint64_t a, uint64_t b, uint64_t& h, uint64_t& l)
+        {
+#if defined(OMW_CXX_MSVC) && defined(OMW_PARCH_x86_64) && (OMW_CPPSTD >= OMW_CPPSTD_20)
+            if (!std::is_constant_evaluated())
+            {
+                l = _umul128(a, b, &h);
+                return;
+            }
+#endif
+
+            const uint64_t aL = (a & 0xFFFFFFFF);
+            const uint64_t aH = (a >> 32);
+            const uint64_t bL = (b & 0xFFFFFFFF);
+            const uint64_t bH = (b >> 32);
+
+            const uint64_t ll = aL * bL;
+            const uint64_t lh = aL * bH;
+            const uint64_t hl = aH * bL;
+            const uint64_t mid = (ll >> 32) + (lh & 0xFFFFFFFF) + (hl & 0xFFFFFFFF);
+
+            l = (mid << 32) | (ll & 0xFFFFFFFF);
+            h = (aH * bH) + (lh >> 32) + (hl >> 32) + (mid >> 32);
+        }
+
+        OMWi_INT128_CONSTEXPR inline void cmul(uint64_t& h, uint64_t& l, uint64_t bh, uint64_t bl)
+        {
+            uint64_t rh = 0;
+            uint64_t rl = 0;
+            cmul64(l, bl, rh, rl);
+            h = rh + (h * bl) + (l * bh);
+            l = rl;
+        }
+
+        inline void mul64(uint64_t a, uint64_t b, uint64_t& h, uint64_t& l)
+        {
+#if defined(OMW_CXX_MSVC) && defined(OMW_PARCH_x86_64)
+            l = _umul128(a, b, &h);
+#else
+            cmul64(a, b, h, l);
+#endif
+        }
+
+        inline void mul(uint64_t& h, uint64_t& l, uint64_t bh, uint64_t bl)
+        {
+            uint64_t rh, rl;
+            mul64(l, bl, rh, rl);
+            h = rh + (h * bl) + (l * bh);
+            l = rl;
+        }
+
+        OMWi_INT128_CONSTEXPR inline bool lessU(uint64_t ah, uint64_t al, uint64_t bh, uint64_t bl) { return ((ah < bh) || ((ah == bh) && (al < bl))); }
+        OMWi_INT128_CONSTEXPR inline bool lessS(uint64_t ah, uint64_t al, uint64_t bh, uint64_t bl)
+        {
+            return lessU(ah ^ OMW_64BIT_MSB, al, bh ^ OMW_64BIT_MSB, bl);
+        }
+
+        // 128 by 64 bit division with 32-bit digits (Knuth algorithm D, Hacker's Delight `divlu`), `u1` has to be less than `v`
+        OMWi_INT128_CONSTEXPR inline uint64_t divlu(uint64_t u1, uint64_t u0, uint64_t v, uint64_t& r)
+        {
+            constexpr uint64_t b = 0x100000000;
+            constexpr uint64_t digitMask = 0xFFFFFFFF;
+
+            const unsigned int s = omw::internal::bit::clz64(v);
+            v <<= s;
+            const uint64_t vn1 = (v >> 32);
+            const uint64_t vn0 = (v & digitMask);
+
+            const uint64_t un32 = (u1 << s) | ((s == 0) ? 0 : (u0 >> (64 - s)));
+            const uint64_t un10 = (u0 << s);
+            const uint64_t un1 = (un10 >> 32);
+            const uint64_t un0 = (un10 & digitMask);
+
+            uint64_t q1 = un32 / vn1;
+            uint64_t rhat = un32 - q1 * vn1;
+            while ((q1 >= b) || ((q1 * vn0) > ((rhat << 32) + un1)))
+            {
+                --q1;
+                rhat += vn1;
+                if (rhat >= b) break;
+            }
+
+            const uint64_t un21 = (un32 << 32) + un1 - q1 * v;
+
+            uint64_t q0 = un21 / vn1;
+            rhat = un21 - q0 * vn1;
+            while ((q0 >= b) || ((q0 * vn0) > ((rhat << 32) + un0)))
+            {
+                --q0;
+                rhat += vn1;
+                if (rhat >= b) break;
+            }
+
+            r = (((un21 << 32) + un0 - q0 * v) >> s);
+            return ((q1 << 32) + q0);
+        }
+
+#endif // OMW_INT128_NATIVE
+
+
+        // `b` must not be 0
+        OMWi_INT128_CONSTEXPR inline void udivmod(uint64_t ah, uint64_t al, uint64_t bh, uint64_t bl, uint64_t& qh, uint64_t& ql, uint64_t& rh, uint64_t& rl)
+        {
+#if defined(OMW_INT128_NATIVE) && !defined(OMWi_DOXYGEN_PREDEFINE)
+            const native_u128 a = join(ah, al);
+            const native_u128 b = join(bh, bl);
+            const native_u128 q = a / b;
+            split(q, qh, ql);
+            split(a - q * b, rh, rl);
+#else
+            if (bh == 0)
+            {
+                if (ah < bl) qh = 0;
+                else
+                {
+                    qh = ah / bl;
+                    ah %= bl;
+                }
+
+                ql = divlu(ah, al, bl, rl);
+                rh = 0;
+            }
+            else
+            {
+                // the quotient fits into 64 bits
+                const unsigned int n = omw::internal::bit::clz64(bh);
+                const uint64_t v1 = (bh << n) | ((n == 0) ? 0 : (bl >> (64 - n)));
+
+                uint64_t unused = 0;
+                uint64_t q0 = (divlu(ah >> 1, (ah << 63) | (al >> 1), v1, unused) >> (63 - n));
+                if (q0 != 0) --q0;
+
+                uint64_t ph = 0;
+                uint64_t pl = 0;
+                cmul64(q0, bl, ph, pl);
+                ph += q0 * bh;
+
+                rh = ah;
+                rl = al;
+                sub(rh, rl, ph, pl);
+
+                if (!lessU(rh, rl, bh, bl))
+                {
+                    ++q0;
+                    sub(rh, rl, bh, bl);
+                }
+
+                qh = 0;
+                ql = q0;
+            }
+#endif
+        }
+
+    } // namespace int128
+} // namespace internal
+} // namespace omw
+
 
 namespace omw {
 
@@ -79,6 +451,7 @@ public:
     omw::Base_Int128& operator=(const omw::Base_Int128& b) { return m_copy(b); }
     omw::Base_Int128& operator+=(const omw::Base_Int128& b);
     omw::Base_Int128& operator-=(const omw::Base_Int128& b);
+    omw::Base_Int128& operator*=(const omw::Base_Int128& b);
     omw::Base_Int128& operator&=(const omw::Base_Int128& b);
     omw::Base_Int128& operator|=(const omw::Base_Int128& b);
     omw::Base_Int128& operator^=(const omw::Base_Int128& b);
@@ -109,6 +482,8 @@ public:
     //! \name Operators
     /// @{
     omw::SignedInt128& operator=(const omw::SignedInt128& b);
+    omw::SignedInt128& operator/=(const omw::Base_Int128& b);
+    omw::SignedInt128& operator%=(const omw::Base_Int128& b);
     omw::SignedInt128& operator>>=(unsigned int count); ///< See \ref grp_utility_langSupport_section_bitShiftOp in \ref grp_utility_langSupport.
     /// @}
 
@@ -133,6 +508,8 @@ public:
     //! \name Operators
     /// @{
     omw::UnsignedInt128& operator=(const omw::UnsignedInt128& b);
+    omw::UnsignedInt128& operator/=(const omw::Base_Int128& b);
+    omw::UnsignedInt128& operator%=(const omw::Base_Int128& b);
     omw::UnsignedInt128& operator>>=(unsigned int count); ///< See \ref grp_utility_langSupport_section_bitShiftOp in \ref grp_utility_langSupport.
     /// @}
 };
@@ -140,58 +517,67 @@ public:
 
 //! \name Operators
 /// @{
-omw::SignedInt128 operator+(const omw::SignedInt128& a);
-omw::UnsignedInt128 operator+(const omw::UnsignedInt128& a);
+inline omw::SignedInt128 operator+(const omw::SignedInt128& a);
+inline omw::UnsignedInt128 operator+(const omw::UnsignedInt128& a);
 
-omw::SignedInt128 operator-(const omw::SignedInt128& a);
-omw::UnsignedInt128 operator-(const omw::UnsignedInt128& a);
+inline omw::SignedInt128 operator-(const omw::SignedInt128& a);
+inline omw::UnsignedInt128 operator-(const omw::UnsignedInt128& a);
 
-omw::SignedInt128 operator+(const omw::SignedInt128& a, const omw::Base_Int128& b);
-omw::UnsignedInt128 operator+(const omw::UnsignedInt128& a, const omw::Base_Int128& b);
+inline omw::SignedInt128 operator+(const omw::SignedInt128& a, const omw::Base_Int128& b);
+inline omw::UnsignedInt128 operator+(const omw::UnsignedInt128& a, const omw::Base_Int128& b);
 
-omw::SignedInt128 operator-(const omw::SignedInt128& a, const omw::Base_Int128& b);
-omw::UnsignedInt128 operator-(const omw::UnsignedInt128& a, const omw::Base_Int128& b);
+inline omw::SignedInt128 operator-(const omw::SignedInt128& a, const omw::Base_Int128& b);
+inline omw::UnsignedInt128 operator-(const omw::UnsignedInt128& a, const omw::Base_Int128& b);
 
-omw::SignedInt128 operator~(const omw::SignedInt128& a);
-omw::UnsignedInt128 operator~(const omw::UnsignedInt128& a);
+inline omw::SignedInt128 operator*(const omw::SignedInt128& a, const omw::Base_Int128& b);
+inline omw::UnsignedInt128 operator*(const omw::UnsignedInt128& a, const omw::Base_Int128& b);
 
-omw::SignedInt128 operator&(const omw::SignedInt128& a, const omw::Base_Int128& b);
-omw::UnsignedInt128 operator&(const omw::UnsignedInt128& a, const omw::Base_Int128& b);
+omw::SignedInt128 operator/(const omw::SignedInt128& a, const omw::Base_Int128& b);
+omw::UnsignedInt128 operator/(const omw::UnsignedInt128& a, const omw::Base_Int128& b);
 
-omw::SignedInt128 operator|(const omw::SignedInt128& a, const omw::Base_Int128& b);
-omw::UnsignedInt128 operator|(const omw::UnsignedInt128& a, const omw::Base_Int128& b);
+omw::SignedInt128 operator%(const omw::SignedInt128& a, const omw::Base_Int128& b);
+omw::UnsignedInt128 operator%(const omw::UnsignedInt128& a, const omw::Base_Int128& b);
 
-omw::SignedInt128 operator^(const omw::SignedInt128& a, const omw::Base_Int128& b);
-omw::UnsignedInt128 operator^(const omw::UnsignedInt128& a, const omw::Base_Int128& b);
+inline omw::SignedInt128 operator~(const omw::SignedInt128& a);
+inline omw::UnsignedInt128 operator~(const omw::UnsignedInt128& a);
+
+inline omw::SignedInt128 operator&(const omw::SignedInt128& a, const omw::Base_Int128& b);
+inline omw::UnsignedInt128 operator&(const omw::UnsignedInt128& a, const omw::Base_Int128& b);
+
+inline omw::SignedInt128 operator|(const omw::SignedInt128& a, const omw::Base_Int128& b);
+inline omw::UnsignedInt128 operator|(const omw::UnsignedInt128& a, const omw::Base_Int128& b);
+
+inline omw::SignedInt128 operator^(const omw::SignedInt128& a, const omw::Base_Int128& b);
+inline omw::UnsignedInt128 operator^(const omw::UnsignedInt128& a, const omw::Base_Int128& b);
 
 /**
  * See \ref grp_utility_langSupport_section_bitShiftOp in \ref grp_utility_langSupport.
  */
-omw::SignedInt128 operator<<(const omw::SignedInt128& a, unsigned int count);
+inline omw::SignedInt128 operator<<(const omw::SignedInt128& a, unsigned int count);
 
 /**
  * See \ref grp_utility_langSupport_section_bitShiftOp in \ref grp_utility_langSupport.
  */
-omw::UnsignedInt128 operator<<(const omw::UnsignedInt128& a, unsigned int count);
+inline omw::UnsignedInt128 operator<<(const omw::UnsignedInt128& a, unsigned int count);
 
 /**
  * See \ref grp_utility_langSupport_section_bitShiftOp in \ref grp_utility_langSupport.
  */
 
-omw::SignedInt128 operator>>(const omw::SignedInt128& a, unsigned int count);
+inline omw::SignedInt128 operator>>(const omw::SignedInt128& a, unsigned int count);
 
 /**
  * See \ref grp_utility_langSupport_section_bitShiftOp in \ref grp_utility_langSupport.
  */
-omw::UnsignedInt128 operator>>(const omw::UnsignedInt128& a, unsigned int count);
+inline omw::UnsignedInt128 operator>>(const omw::UnsignedInt128& a, unsigned int count);
 
 // All combinations of the comparison operators are needed to achieve sign awareness.
-bool operator==(const omw::SignedInt128& a, const omw::SignedInt128& b);
-bool operator!=(const omw::SignedInt128& a, const omw::SignedInt128& b);
-bool operator<(const omw::SignedInt128& a, const omw::SignedInt128& b);
-bool operator>(const omw::SignedInt128& a, const omw::SignedInt128& b);
-bool operator<=(const omw::SignedInt128& a, const omw::SignedInt128& b);
-bool operator>=(const omw::SignedInt128& a, const omw::SignedInt128& b);
+inline bool operator==(const omw::SignedInt128& a, const omw::SignedInt128& b);
+inline bool operator!=(const omw::SignedInt128& a, const omw::SignedInt128& b);
+inline bool operator<(const omw::SignedInt128& a, const omw::SignedInt128& b);
+inline bool operator>(const omw::SignedInt128& a, const omw::SignedInt128& b);
+inline bool operator<=(const omw::SignedInt128& a, const omw::SignedInt128& b);
+inline bool operator>=(const omw::SignedInt128& a, const omw::SignedInt128& b);
 
 
 /**
@@ -199,34 +585,415 @@ bool operator>=(const omw::SignedInt128& a, const omw::SignedInt128& b);
  * integers grater than the maximal signed value compare always greater than signed integers. Signed and unsigned
  * integers only compare equal if their represented value is the same.
  */
-bool operator==(const omw::SignedInt128& a, const omw::UnsignedInt128& b);
+inline bool operator==(const omw::SignedInt128& a, const omw::UnsignedInt128& b);
 
 // clang-format off
-bool operator!=(const omw::SignedInt128& a, const omw::UnsignedInt128& b); /*!< Sign aware, see `omw::operator==(const omw::SignedInt128&, const omw::UnsignedInt128&)`. */
-bool operator<(const omw::SignedInt128& a, const omw::UnsignedInt128& b); /*!< Sign aware, see `omw::operator==(const omw::SignedInt128&, const omw::UnsignedInt128&)`. */
-bool operator>(const omw::SignedInt128& a, const omw::UnsignedInt128& b); /*!< Sign aware, see `omw::operator==(const omw::SignedInt128&, const omw::UnsignedInt128&)`. */
-bool operator<=(const omw::SignedInt128& a, const omw::UnsignedInt128& b); /*!< Sign aware, see `omw::operator==(const omw::SignedInt128&, const omw::UnsignedInt128&)`. */
-bool operator>=(const omw::SignedInt128& a, const omw::UnsignedInt128& b); /*!< Sign aware, see `omw::operator==(const omw::SignedInt128&, const omw::UnsignedInt128&)`. */
-
-bool operator==(const omw::UnsignedInt128& a, const omw::SignedInt128& b); /*!< Sign aware, see `omw::operator==(const omw::SignedInt128&, const omw::UnsignedInt128&)`. */
-bool operator!=(const omw::UnsignedInt128& a, const omw::SignedInt128& b); /*!< Sign aware, see `omw::operator==(const omw::SignedInt128&, const omw::UnsignedInt128&)`. */
-bool operator<(const omw::UnsignedInt128& a, const omw::SignedInt128& b); /*!< Sign aware, see `omw::operator==(const omw::SignedInt128&, const omw::UnsignedInt128&)`. */
-bool operator>(const omw::UnsignedInt128& a, const omw::SignedInt128& b); /*!< Sign aware, see `omw::operator==(const omw::SignedInt128&, const omw::UnsignedInt128&)`. */
-bool operator<=(const omw::UnsignedInt128& a, const omw::SignedInt128& b); /*!< Sign aware, see `omw::operator==(const omw::SignedInt128&, const omw::UnsignedInt128&)`. */
-bool operator>=(const omw::UnsignedInt128& a, const omw::SignedInt128& b); /*!< Sign aware, see `omw::operator==(const omw::SignedInt128&, const omw::UnsignedInt128&)`. */
+inline bool operator!=(const omw::SignedInt128& a, const omw::UnsignedInt128& b); /*!< Sign aware, see `omw::operator==(const omw::SignedInt128&, const omw::UnsignedInt128&)`. */
+inline bool operator<(const omw::SignedInt128& a, const omw::UnsignedInt128& b); /*!< Sign aware, see `omw::operator==(const omw::SignedInt128&, const omw::UnsignedInt128&)`. */
+inline bool operator>(const omw::SignedInt128& a, const omw::UnsignedInt128& b); /*!< Sign aware, see `omw::operator==(const omw::SignedInt128&, const omw::UnsignedInt128&)`. */
+inline bool operator<=(const omw::SignedInt128& a, const omw::UnsignedInt128& b); /*!< Sign aware, see `omw::operator==(const omw::SignedInt128&, const omw::UnsignedInt128&)`. */
+inline bool operator>=(const omw::SignedInt128& a, const omw::UnsignedInt128& b); /*!< Sign aware, see `omw::operator==(const omw::SignedInt128&, const omw::UnsignedInt128&)`. */
+
+inline bool operator==(const omw::UnsignedInt128& a, const omw::SignedInt128& b); /*!< Sign aware, see `omw::operator==(const omw::SignedInt128&, const omw::UnsignedInt128&)`. */
+inline bool operator!=(const omw::UnsignedInt128& a, const omw::SignedInt128& b); /*!< Sign aware, see `omw::operator==(const omw::SignedInt128&, const omw::UnsignedInt128&)`. */
+inline bool operator<(const omw::UnsignedInt128& a, const omw::SignedInt128& b); /*!< Sign aware, see `omw::operator==(const omw::SignedInt128&, const omw::UnsignedInt128&)`. */
+inline bool operator>(const omw::UnsignedInt128& a, const omw::SignedInt128& b); /*!< Sign aware, see `omw::operator==(const omw::SignedInt128&, const omw::UnsignedInt128&)`. */
+inline bool operator<=(const omw::UnsignedInt128& a, const omw::SignedInt128& b); /*!< Sign aware, see `omw::operator==(const omw::SignedInt128&, const omw::UnsignedInt128&)`. */
+inline bool operator>=(const omw::UnsignedInt128& a, const omw::SignedInt128& b); /*!< Sign aware, see `omw::operator==(const omw::SignedInt128&, const omw::UnsignedInt128&)`. */
 // clang-format on
 
-bool operator==(const omw::UnsignedInt128& a, const omw::UnsignedInt128& b);
-bool operator!=(const omw::UnsignedInt128& a, const omw::UnsignedInt128& b);
-bool operator<(const omw::UnsignedInt128& a, const omw::UnsignedInt128& b);
-bool operator>(const omw::UnsignedInt128& a, const omw::UnsignedInt128& b);
-bool operator<=(const omw::UnsignedInt128& a, const omw::UnsignedInt128& b);
-bool operator>=(const omw::UnsignedInt128& a, const omw::UnsignedInt128& b);
+inline bool operator==(const omw::UnsignedInt128& a, const omw::UnsignedInt128& b);
+inline bool operator!=(const omw::UnsignedInt128& a, const omw::UnsignedInt128& b);
+inline bool operator<(const omw::UnsignedInt128& a, const omw::UnsignedInt128& b);
+inline bool operator>(const omw::UnsignedInt128& a, const omw::UnsignedInt128& b);
+inline bool operator<=(const omw::UnsignedInt128& a, const omw::UnsignedInt128& b);
+inline bool operator>=(const omw::UnsignedInt128& a, const omw::UnsignedInt128& b);
 /// @}
 
 using int128_t = omw::SignedInt128;    /*!< Signed 128-bit integer type (`omw::SignedInt128`) */
 using uint128_t = omw::UnsignedInt128; /*!< Unsigned 128-bit integer type (`omw::UnsignedInt128`) */
 
+/**
+ * Result of `omw::divmod()`.
+ */
+template <class T> struct DivModResult
+{
+    T quot; ///< Quotient
+    T rem;  ///< Remainder
+};
+
+omw::DivModResult<omw::int128_t> divmod(const omw::int128_t& a, const omw::int128_t& b);
+omw::DivModResult<omw::uint128_t> divmod(const omw::uint128_t& a, const omw::uint128_t& b);
+
+inline omw::uint128_t mul64x64(uint64_t a, uint64_t b);
+omw::uint128_t div128by64(const omw::uint128_t& a, uint64_t b, uint64_t* remainder = nullptr);
+
+//! \name Overflow Checked Arithmetic
+/// @{
+bool addOverflow(const omw::int128_t& a, const omw::int128_t& b, omw::int128_t& result);
+bool addOverflow(const omw::uint128_t& a, const omw::uint128_t& b, omw::uint128_t& result);
+bool subOverflow(const omw::int128_t& a, const omw::int128_t& b, omw::int128_t& result);
+bool subOverflow(const omw::uint128_t& a, const omw::uint128_t& b, omw::uint128_t& result);
+bool mulOverflow(const omw::int128_t& a, const omw::int128_t& b, omw::int128_t& result);
+bool mulOverflow(const omw::uint128_t& a, const omw::uint128_t& b, omw::uint128_t& result);
+bool divOverflow(const omw::int128_t& a, const omw::int128_t& b, omw::int128_t& result);
+/// @}
+
+//! \name Bit Manipulation
+/// @{
+
+/**
+ * @return Number of set bits
+ */
+template <typename T, typename internal::bit::EnableIfUInt<T>::type* = nullptr> constexpr unsigned int popCount(T value)
+{
+    return omw::internal::bit::popcount64(value);
+}
+
+/**
+ * @return Number of consecutive 0 bits starting at the most significant bit, the number of bits of `T` if `value` is 0
+ */
+template <typename T, typename internal::bit::EnableIfUInt<T>::type* = nullptr> constexpr unsigned int countLeadingZeros(T value)
+{
+    return (omw::internal::bit::clz64(value) - (64 - static_cast<unsigned int>(sizeof(T) * 8)));
+}
+
+/**
+ * @return Number of consecutive 0 bits starting at the least significant bit, the number of bits of `T` if `value` is 0
+ */
+template <typename T, typename internal::bit::EnableIfUInt<T>::type* = nullptr> constexpr unsigned int countTrailingZeros(T value)
+{
+    return (value ? omw::internal::bit::ctz64(value) : static_cast<unsigned int>(sizeof(T) * 8));
+}
+
+/**
+ * The rotate count is taken modulo the number of bits of `T`.
+ */
+template <typename T, typename internal::bit::EnableIfUInt<T>::type* = nullptr> constexpr T rotateLeft(T value, unsigned int n)
+{
+    return omw::internal::bit::rotl(value, n);
+}
+
+/**
+ * The rotate count is taken modulo the number of bits of `T`.
+ */
+template <typename T, typename internal::bit::EnableIfUInt<T>::type* = nullptr> constexpr T rotateRight(T value, unsigned int n)
+{
+    return omw::internal::bit::rotl(value, 0u - n);
+}
+
+/**
+ * @return `value` with the byte order reversed
+ */
+template <typename T, typename internal::bit::EnableIfUInt<T>::type* = nullptr> constexpr T byteSwap(T value) { return omw::internal::bit::bswap(value); }
+
+uint32_t bitExtract(uint32_t value, uint32_t mask);
+uint64_t bitExtract(uint64_t value, uint64_t mask);
+uint32_t bitDeposit(uint32_t value, uint32_t mask);
+uint64_t bitDeposit(uint64_t value, uint64_t mask);
+
+inline unsigned int popCount(const omw::uint128_t& value);
+inline unsigned int countLeadingZeros(const omw::uint128_t& value);
+inline unsigned int countTrailingZeros(const omw::uint128_t& value);
+inline omw::uint128_t rotateLeft(const omw::uint128_t& value, unsigned int n);
+inline omw::uint128_t rotateRight(const omw::uint128_t& value, unsigned int n);
+inline omw::uint128_t byteSwap(const omw::uint128_t& value);
+
+/// @}
+
+
+
+#if (OMW_CPPSTD >= OMW_CPPSTD_14) || defined(OMWi_DOXYGEN_PREDEFINE)
+
+#if defined(OMW_BYTE_ORDER_BIG) && !defined(OMWi_DOXYGEN_PREDEFINE)
+#define OMWi_INT128_MEMBER_INIT(_h, _l) m_h(_h), m_l(_l)
+#else
+#define OMWi_INT128_MEMBER_INIT(_h, _l) m_l(_l), m_h(_h)
+#endif
+
+/**
+ * @brief Trivially copyable 128-bit integer.
+ *
+ * Use the aliases `omw::i128` and `omw::u128`.
+ *
+ * In contrast to `omw::SignedInt128` and `omw::UnsignedInt128` this is a literal type without virtual functions, all
+ * operations are `constexpr`. It has standard layout and consists of two `uint64_t` in the byte order of the target, so
+ * arrays of it are dense (16 bytes per value) and can be copied with `memcpy()` or mapped from a file.
+ *
+ * Like the built in integer types, a default constructed object is uninitialized. Arithmetic wraps around, shift
+ * counts greater than 127 shift out all bits. Signed and unsigned values are not implicitly converted into each other.
+ *
+ * Requires C++14.
+ */
+template <bool isSigned> class BasicInt128
+{
+public:
+    BasicInt128() = default;
+
+    constexpr BasicInt128(uint64_t valueH, uint64_t valueL)
+        : OMWi_INT128_MEMBER_INIT(valueH, valueL)
+    {}
+
+    /**
+     * Signed integers are sign extended.
+     */
+    template <typename T, typename std::enable_if<std::is_integral<T>::value && (sizeof(T) <= 8), int>::type = 0>
+    constexpr BasicInt128(T value)
+        : OMWi_INT128_MEMBER_INIT(m_signFill(value, std::is_signed<T>()), static_cast<uint64_t>(value))
+    {}
+
+    template <bool otherSigned, typename std::enable_if<otherSigned != isSigned, int>::type = 0>
+    explicit constexpr BasicInt128(const omw::BasicInt128<otherSigned>& other)
+        : OMWi_INT128_MEMBER_INIT(other.hi(), other.lo())
+    {}
+
+    explicit BasicInt128(const omw::Base_Int128& other)
+        : OMWi_INT128_MEMBER_INIT(other.hi(), other.lo())
+    {}
+
+    static constexpr BasicInt128 min() { return (isSigned ? BasicInt128(OMW_64BIT_MSB, 0) : BasicInt128(0, 0)); }
+    static constexpr BasicInt128 max() { return (isSigned ? BasicInt128(~OMW_64BIT_MSB, OMW_64BIT_ALL) : BasicInt128(OMW_64BIT_ALL, OMW_64BIT_ALL)); }
+
+    constexpr uint64_t hi() const { return m_h; }
+    constexpr uint64_t lo() const { return m_l; }
+
+    constexpr bool isNegative() const { return (isSigned && ((m_h & OMW_64BIT_MSB) != 0)); }
+
+    explicit constexpr operator bool() const { return ((m_h | m_l) != 0); }
+
+    /**
+     * Truncates the value to `T`.
+     */
+    template <typename T, typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value, int>::type = 0>
+    explicit constexpr operator T() const
+    {
+        return static_cast<T>(m_l);
+    }
+
+    explicit operator omw::SignedInt128() const { return omw::SignedInt128(m_h, m_l); }
+    explicit operator omw::UnsignedInt128() const { return omw::UnsignedInt128(m_h, m_l); }
+
+private:
+#if defined(OMW_BYTE_ORDER_BIG) && !defined(OMWi_DOXYGEN_PREDEFINE)
+    uint64_t m_h;
+    uint64_t m_l;
+#else
+    uint64_t m_l;
+    uint64_t m_h;
+#endif
+
+    template <typename T> static constexpr uint64_t m_signFill(T value, std::true_type) { return ((value < 0) ? OMW_64BIT_ALL : 0); }
+    template <typename T> static constexpr uint64_t m_signFill(T, std::false_type) { return 0; }
+
+    // `b` must not be 0, truncates towards zero, the remainder has the sign of `a`
+    static constexpr void m_divmod(const BasicInt128& a, const BasicInt128& b, BasicInt128& quot, BasicInt128& rem)
+    {
+        const bool negA = a.isNegative();
+        const bool negB = b.isNegative();
+        const BasicInt128 ua = (negA ? -a : a);
+        const BasicInt128 ub = (negB ? -b : b);
+
+        uint64_t qh = 0, ql = 0, rh = 0, rl = 0;
+        omw::internal::int128::udivmod(ua.m_h, ua.m_l, ub.m_h, ub.m_l, qh, ql, rh, rl);
+
+        quot = BasicInt128(qh, ql);
+        rem = BasicInt128(rh, rl);
+        if (negA != negB) quot = -quot;
+        if (negA) rem = -rem;
+    }
+
+public:
+    //! \name Operators
+    /// @{
+    constexpr BasicInt128& operator+=(const BasicInt128& b)
+    {
+        omw::internal::int128::add(m_h, m_l, b.m_h, b.m_l);
+        return *this;
+    }
+
+    constexpr BasicInt128& operator-=(const BasicInt128& b)
+    {
+        omw::internal::int128::sub(m_h, m_l, b.m_h, b.m_l);
+        return *this;
+    }
+
+    constexpr BasicInt128& operator*=(const BasicInt128& b)
+    {
+        omw::internal::int128::cmul(m_h, m_l, b.m_h, b.m_l);
+        return *this;
+    }
+
+    /**
+     * \b Exceptions
+     * - `std::domain_error` if `b` is 0
+     */
+    constexpr BasicInt128& operator/=(const BasicInt128& b)
+    {
+        if (!b) throw std::domain_error("omw::BasicInt128::operator/=");
+        BasicInt128 rem(0, 0);
+        m_divmod(*this, b, *this, rem);
+        return *this;
+    }
+
+    /**
+     * \b Exceptions
+     * - `std::domain_error` if `b` is 0
+     */
+    constexpr BasicInt128& operator%=(const BasicInt128& b)
+    {
+        if (!b) throw std::domain_error("omw::BasicInt128::operator%=");
+        BasicInt128 quot(0, 0);
+        m_divmod(*this, b, quot, *this);
+        return *this;
+    }
+
+    constexpr BasicInt128& operator&=(const BasicInt128& b)
+    {
+        m_h &= b.m_h;
+        m_l &= b.m_l;
+        return *this;
+    }
+
+    constexpr BasicInt128& operator|=(const BasicInt128& b)
+    {
+        m_h |= b.m_h;
+        m_l |= b.m_l;
+        return *this;
+    }
+
+    constexpr BasicInt128& operator^=(const BasicInt128& b)
+    {
+        m_h ^= b.m_h;
+        m_l ^= b.m_l;
+        return *this;
+    }
+
+    constexpr BasicInt128& operator<<=(unsigned int count)
+    {
+        omw::internal::int128::shl(m_h, m_l, count);
+        return *this;
+    }
+
+    /**
+     * Arithmetic shift if signed, logical shift if unsigned.
+     */
+    constexpr BasicInt128& operator>>=(unsigned int count)
+    {
+        if (isSigned) omw::internal::int128::sar(m_h, m_l, count);
+        else omw::internal::int128::shr(m_h, m_l, count);
+        return *this;
+    }
+
+    constexpr BasicInt128& operator++() { return (*this += BasicInt128(0, 1)); }
+    constexpr BasicInt128& operator--() { return (*this -= BasicInt128(0, 1)); }
+
+    constexpr BasicInt128 operator++(int)
+    {
+        const BasicInt128 tmp = *this;
+        *this += BasicInt128(0, 1);
+        return tmp;
+    }
+
+    constexpr BasicInt128 operator--(int)
+    {
+        const BasicInt128 tmp = *this;
+        *this -= BasicInt128(0, 1);
+        return tmp;
+    }
+
+    friend constexpr BasicInt128 operator+(const BasicInt128& a) { return a; }
+    friend constexpr BasicInt128 operator-(const BasicInt128& a) { return (BasicInt128(0, 0) -= a); }
+    friend constexpr BasicInt128 operator~(const BasicInt128& a) { return BasicInt128(~a.m_h, ~a.m_l); }
+
+    friend constexpr BasicInt128 operator+(BasicInt128 a, const BasicInt128& b) { return (a += b); }
+    friend constexpr BasicInt128 operator-(BasicInt128 a, const BasicInt128& b) { return (a -= b); }
+    friend constexpr BasicInt128 operator*(BasicInt128 a, const BasicInt128& b) { return (a *= b); }
+    friend constexpr BasicInt128 operator/(BasicInt128 a, const BasicInt128& b) { return (a /= b); }
+    friend constexpr BasicInt128 operator%(BasicInt128 a, const BasicInt128& b) { return (a %= b); }
+    friend constexpr BasicInt128 operator&(BasicInt128 a, const BasicInt128& b) { return (a &= b); }
+    friend constexpr BasicInt128 operator|(BasicInt128 a, const BasicInt128& b) { return (a |= b); }
+    friend constexpr BasicInt128 operator^(BasicInt128 a, const BasicInt128& b) { return (a ^= b); }
+    friend constexpr BasicInt128 operator<<(BasicInt128 a, unsigned int count) { return (a <<= count); }
+    friend constexpr BasicInt128 operator>>(BasicInt128 a, unsigned int count) { return (a >>= count); }
+
+    friend constexpr bool operator==(const BasicInt128& a, const BasicInt128& b) { return ((a.m_h == b.m_h) && (a.m_l == b.m_l)); }
+    friend constexpr bool operator!=(const BasicInt128& a, const BasicInt128& b) { return !(a == b); }
+    friend constexpr bool operator<(const BasicInt128& a, const BasicInt128& b)
+    {
+        return (isSigned ? omw::internal::int128::lessS(a.m_h, a.m_l, b.m_h, b.m_l) : omw::internal::int128::lessU(a.m_h, a.m_l, b.m_h, b.m_l));
+    }
+    friend constexpr bool operator>(const BasicInt128& a, const BasicInt128& b) { return (b < a); }
+    friend constexpr bool operator<=(const BasicInt128& a, const BasicInt128& b) { return !(b < a); }
+    friend constexpr bool operator>=(const BasicInt128& a, const BasicInt128& b) { return !(a < b); }
+    /// @}
+
+    template <bool s>
+    friend constexpr omw::DivModResult<omw::BasicInt128<s>> divmod(const omw::BasicInt128<s>& a, const omw::BasicInt128<s>& b);
+};
+
+/**
+ * Calculates the quotient and the remainder with a single division. The quotient is truncated towards zero, the
+ * remainder has the sign of `a`.
+ *
+ * \b Exceptions
+ * - `std::domain_error` if `b` is 0
+ */
+template <bool isSigned>
+constexpr omw::DivModResult<omw::BasicInt128<isSigned>> divmod(const omw::BasicInt128<isSigned>& a, const omw::BasicInt128<isSigned>& b)
+{
+    if (!b) throw std::domain_error("omw::divmod");
+    omw::DivModResult<omw::BasicInt128<isSigned>> r = { omw::BasicInt128<isSigned>(0, 0), omw::BasicInt128<isSigned>(0, 0) };
+    omw::BasicInt128<isSigned>::m_divmod(a, b, r.quot, r.rem);
+    return r;
+}
+
+#undef OMWi_INT128_MEMBER_INIT
+
+using i128 = omw::BasicInt128<true>;  /*!< Trivially copyable signed 128-bit integer type (`omw::BasicInt128`) */
+using u128 = omw::BasicInt128<false>; /*!< Trivially copyable unsigned 128-bit integer type (`omw::BasicInt128`) */
+
+//! \name Bit Manipulation
+/// @{
+constexpr unsigned int popCount(const omw::u128& value) { return (omw::internal::bit::popcount64(value.hi()) + omw::internal::bit::popcount64(value.lo())); }
+constexpr unsigned int countLeadingZeros(const omw::u128& value)
+{
+    return (value.hi() ? omw::internal::bit::clz64(value.hi()) : (64 + omw::internal::bit::clz64(value.lo())));
+}
+constexpr unsigned int countTrailingZeros(const omw::u128& value)
+{
+    return (value.lo() ? omw::internal::bit::ctz64(value.lo()) : (64 + omw::internal::bit::ctz64(value.hi())));
+}
+constexpr omw::u128 rotateLeft(const omw::u128& value, unsigned int n) { return ((value << (n & 127)) | (value >> ((0u - n) & 127))); }
+constexpr omw::u128 rotateRight(const omw::u128& value, unsigned int n) { return omw::rotateLeft(value, 0u - n); }
+constexpr omw::u128 byteSwap(const omw::u128& value)
+{
+    return omw::u128(omw::internal::bit::bswap64(value.lo()), omw::internal::bit::bswap64(value.hi()));
+}
+/// @}
+
+namespace bulk {
+
+    void add(omw::i128* dst, const omw::i128* a, const omw::i128* b, size_t n);
+    void add(omw::u128* dst, const omw::u128* a, const omw::u128* b, size_t n);
+    void sub(omw::i128* dst, const omw::i128* a, const omw::i128* b, size_t n);
+    void sub(omw::u128* dst, const omw::u128* a, const omw::u128* b, size_t n);
+
+    void compare(int8_t* dst, const omw::i128* a, const omw::i128* b, size_t n);
+    void compare(int8_t* dst, const omw::u128* a, const omw::u128* b, size_t n);
+    omw::i128 min(const omw::i128* data, size_t n);
+    omw::u128 min(const omw::u128* data, size_t n);
+    omw::i128 max(const omw::i128* data, size_t n);
+    omw::u128 max(const omw::u128* data, size_t n);
+
+    omw::i128 sum(const omw::i128* data, size_t n);
+    omw::u128 sum(const omw::u128* data, size_t n);
+    void prefixSum(omw::i128* dst, const omw::i128* src, size_t n);
+    void prefixSum(omw::u128* dst, const omw::u128* src, size_t n);
+
+} // namespace bulk
+
+#endif // C++14
+
 /*! @} */
 
 // move to bitset.h
@@ -242,4 +1009,437 @@ using uint128_t = omw::UnsignedInt128; /*!< Unsigned 128-bit integer type (`omw:
 } // namespace omw
 
 
+
+/*
+ * Operator Implementation Philosophy
+ *
+ * Operators declared inside a class do not use any other overloaded
+ * operators. Operators declared outside a class do not use each
+ * other (except comparsion operators), but can use operators declared
+ * inside a class.
+ *
+ * The arithmetic is done by the `omw::internal::int128` functions, see
+ * `OMW_INT128_NATIVE`.
+ */
+
+inline omw::Base_Int128::Base_Int128()
+    : m_h(0), m_l(0)
+{}
+
+inline omw::Base_Int128::Base_Int128(const omw::Base_Int128& other)
+    : m_h(other.m_h), m_l(other.m_l)
+{}
+
+//!
+//! Uses `omw::Base_Int128::sets(int64_t)` to initialize.
+//!
+inline omw::Base_Int128::Base_Int128(int64_t value)
+    : m_h(0), m_l(0)
+{
+    sets(value);
+}
+
+inline omw::Base_Int128::Base_Int128(uint64_t valueH, uint64_t valueL)
+    : m_h(valueH), m_l(valueL)
+{}
+
+inline void omw::Base_Int128::set(uint64_t valueH, uint64_t valueL)
+{
+    m_h = valueH;
+    m_l = valueL;
+}
+
+//!
+//! Extends the sign bit.
+//!
+inline void omw::Base_Int128::sets(int64_t value)
+{
+    m_l = static_cast<uint64_t>(value);
+    m_h = ((value < 0) ? omw::internal::int128::allBits : 0);
+}
+
+inline void omw::Base_Int128::sets(int64_t valueH, uint64_t valueL)
+{
+    m_h = static_cast<uint64_t>(valueH);
+    m_l = valueL;
+}
+
+//!
+//! Does not extend the sign bit.
+//!
+inline void omw::Base_Int128::setu(uint64_t value)
+{
+    m_h = 0;
+    m_l = value;
+}
+
+inline omw::Base_Int128& omw::Base_Int128::m_copy(const omw::Base_Int128& other)
+{
+    m_h = other.m_h;
+    m_l = other.m_l;
+    return *this;
+}
+
+inline omw::Base_Int128& omw::Base_Int128::operator+=(const omw::Base_Int128& b)
+{
+    omw::internal::int128::add(m_h, m_l, b.m_h, b.m_l);
+    return *this;
+}
+
+inline omw::Base_Int128& omw::Base_Int128::operator-=(const omw::Base_Int128& b)
+{
+    omw::internal::int128::sub(m_h, m_l, b.m_h, b.m_l);
+    return *this;
+}
+
+inline omw::Base_Int128& omw::Base_Int128::operator*=(const omw::Base_Int128& b)
+{
+    omw::internal::int128::mul(m_h, m_l, b.m_h, b.m_l);
+    return *this;
+}
+
+inline omw::Base_Int128& omw::Base_Int128::operator&=(const omw::Base_Int128& b)
+{
+    m_h &= b.m_h;
+    m_l &= b.m_l;
+    return *this;
+}
+
+inline omw::Base_Int128& omw::Base_Int128::operator|=(const omw::Base_Int128& b)
+{
+    m_h |= b.m_h;
+    m_l |= b.m_l;
+    return *this;
+}
+
+inline omw::Base_Int128& omw::Base_Int128::operator^=(const omw::Base_Int128& b)
+{
+    m_h ^= b.m_h;
+    m_l ^= b.m_l;
+    return *this;
+}
+
+inline omw::Base_Int128& omw::Base_Int128::operator<<=(unsigned int count)
+{
+    omw::internal::int128::shl(m_h, m_l, count);
+    return *this;
+}
+
+inline omw::Base_Int128& omw::Base_Int128::operator++()
+{
+    omw::internal::int128::add(m_h, m_l, 0, 1);
+    return *this;
+}
+
+inline omw::Base_Int128& omw::Base_Int128::operator--()
+{
+    omw::internal::int128::sub(m_h, m_l, 0, 1);
+    return *this;
+}
+
+inline omw::Base_Int128 omw::Base_Int128::operator++(int)
+{
+    const omw::Base_Int128 tmp(*this);
+    omw::internal::int128::add(m_h, m_l, 0, 1);
+    return tmp;
+}
+
+inline omw::Base_Int128 omw::Base_Int128::operator--(int)
+{
+    const omw::Base_Int128 tmp(*this);
+    omw::internal::int128::sub(m_h, m_l, 0, 1);
+    return tmp;
+}
+
+
+
+inline omw::SignedInt128::SignedInt128()
+    : omw::Base_Int128()
+{}
+
+inline omw::SignedInt128::SignedInt128(const omw::SignedInt128& other)
+    : omw::Base_Int128(other)
+{}
+
+//!
+//! Uses `omw::Base_Int128::sets(int64_t)` to initialize.
+//!
+inline omw::SignedInt128::SignedInt128(int64_t value)
+    : omw::Base_Int128(value)
+{}
+
+inline omw::SignedInt128::SignedInt128(uint64_t valueH, uint64_t valueL)
+    : omw::Base_Int128(valueH, valueL)
+{}
+
+inline omw::SignedInt128::SignedInt128(const omw::Base_Int128& other)
+    : omw::Base_Int128(other)
+{}
+
+inline bool omw::SignedInt128::isNegative() const { return ((m_h & OMW_64BIT_MSB) != 0); }
+
+inline omw::SignedInt128& omw::SignedInt128::operator=(const omw::SignedInt128& b)
+{
+    m_copy(b);
+    return *this;
+}
+
+inline omw::SignedInt128& omw::SignedInt128::operator>>=(unsigned int count)
+{
+#ifdef OMWi_INT_RIGHTSHIFT_DEBUG
+    oldValue_h = m_h;
+    oldValue_l = m_l;
+    lastMask_h = m_h;
+    lastMask_l = m_l;
+    omw::internal::int128::shr(lastMask_h, lastMask_l, count);
+#endif
+
+    omw::internal::int128::sar(m_h, m_l, count);
+
+#ifdef OMWi_INT_RIGHTSHIFT_DEBUG
+    lastMask_h ^= m_h;
+    lastMask_l ^= m_l;
+#endif
+
+    return *this;
+}
+
+
+
+inline omw::UnsignedInt128::UnsignedInt128()
+    : omw::Base_Int128()
+{}
+
+inline omw::UnsignedInt128::UnsignedInt128(const omw::UnsignedInt128& other)
+    : omw::Base_Int128(other)
+{}
+
+//!
+//! Uses `omw::Base_Int128::sets(int64_t)` to initialize.
+//!
+inline omw::UnsignedInt128::UnsignedInt128(int64_t value)
+    : omw::Base_Int128(value)
+{}
+
+inline omw::UnsignedInt128::UnsignedInt128(uint64_t valueH, uint64_t valueL)
+    : omw::Base_Int128(valueH, valueL)
+{}
+
+inline omw::UnsignedInt128::UnsignedInt128(const omw::Base_Int128& other)
+    : omw::Base_Int128(other)
+{}
+
+inline omw::UnsignedInt128& omw::UnsignedInt128::operator=(const omw::UnsignedInt128& b)
+{
+    m_copy(b);
+    return *this;
+}
+
+inline omw::UnsignedInt128& omw::UnsignedInt128::operator>>=(unsigned int count)
+{
+    omw::internal::int128::shr(m_h, m_l, count);
+    return *this;
+}
+
+
+
+//!
+//! Does nothing else than returning `a`.
+//!
+inline omw::SignedInt128 omw::operator+(const omw::SignedInt128& a) { return a; }
+
+//!
+//! Does nothing else than returning `a`.
+//!
+inline omw::UnsignedInt128 omw::operator+(const omw::UnsignedInt128& a) { return a; }
+
+//!
+//! Returns the two's complement of `a`.
+//!
+inline omw::SignedInt128 omw::operator-(const omw::SignedInt128& a)
+{
+    omw::SignedInt128 r(0, 0);
+    r -= a;
+    return r;
+}
+
+//!
+//! Returns the two's complement of `a`.
+//!
+inline omw::UnsignedInt128 omw::operator-(const omw::UnsignedInt128& a)
+{
+    omw::UnsignedInt128 r(0, 0);
+    r -= a;
+    return r;
+}
+
+inline omw::SignedInt128 omw::operator+(const omw::SignedInt128& a, const omw::Base_Int128& b)
+{
+    omw::SignedInt128 r(a);
+    r += b;
+    return r;
+}
+
+inline omw::UnsignedInt128 omw::operator+(const omw::UnsignedInt128& a, const omw::Base_Int128& b)
+{
+    omw::UnsignedInt128 r(a);
+    r += b;
+    return r;
+}
+
+inline omw::SignedInt128 omw::operator-(const omw::SignedInt128& a, const omw::Base_Int128& b)
+{
+    omw::SignedInt128 r(a);
+    r -= b;
+    return r;
+}
+
+inline omw::UnsignedInt128 omw::operator-(const omw::UnsignedInt128& a, const omw::Base_Int128& b)
+{
+    omw::UnsignedInt128 r(a);
+    r -= b;
+    return r;
+}
+
+//!
+//! The result is truncated to 128 bits, the same for signed and unsigned operands.
+//!
+inline omw::SignedInt128 omw::operator*(const omw::SignedInt128& a, const omw::Base_Int128& b)
+{
+    omw::SignedInt128 r(a);
+    r *= b;
+    return r;
+}
+
+//!
+//! The result is truncated to 128 bits, the same for signed and unsigned operands.
+//!
+inline omw::UnsignedInt128 omw::operator*(const omw::UnsignedInt128& a, const omw::Base_Int128& b)
+{
+    omw::UnsignedInt128 r(a);
+    r *= b;
+    return r;
+}
+
+inline omw::SignedInt128 omw::operator~(const omw::SignedInt128& a) { return omw::SignedInt128(~a.hi(), ~a.lo()); }
+inline omw::UnsignedInt128 omw::operator~(const omw::UnsignedInt128& a) { return omw::UnsignedInt128(~a.hi(), ~a.lo()); }
+
+inline omw::SignedInt128 omw::operator&(const omw::SignedInt128& a, const omw::Base_Int128& b) { return omw::SignedInt128(a.hi() & b.hi(), a.lo() & b.lo()); }
+inline omw::UnsignedInt128 omw::operator&(const omw::UnsignedInt128& a, const omw::Base_Int128& b) { return omw::UnsignedInt128(a.hi() & b.hi(), a.lo() & b.lo()); }
+
+inline omw::SignedInt128 omw::operator|(const omw::SignedInt128& a, const omw::Base_Int128& b) { return omw::SignedInt128(a.hi() | b.hi(), a.lo() | b.lo()); }
+inline omw::UnsignedInt128 omw::operator|(const omw::UnsignedInt128& a, const omw::Base_Int128& b) { return omw::UnsignedInt128(a.hi() | b.hi(), a.lo() | b.lo()); }
+
+inline omw::SignedInt128 omw::operator^(const omw::SignedInt128& a, const omw::Base_Int128& b) { return omw::SignedInt128(a.hi() ^ b.hi(), a.lo() ^ b.lo()); }
+inline omw::UnsignedInt128 omw::operator^(const omw::UnsignedInt128& a, const omw::Base_Int128& b) { return omw::UnsignedInt128(a.hi() ^ b.hi(), a.lo() ^ b.lo()); }
+
+inline omw::SignedInt128 omw::operator<<(const omw::SignedInt128& a, unsigned int count)
+{
+    omw::SignedInt128 r(a);
+    r <<= count;
+    return r;
+}
+
+inline omw::UnsignedInt128 omw::operator<<(const omw::UnsignedInt128& a, unsigned int count)
+{
+    omw::UnsignedInt128 r(a);
+    r <<= count;
+    return r;
+}
+
+inline omw::SignedInt128 omw::operator>>(const omw::SignedInt128& a, unsigned int count)
+{
+    omw::SignedInt128 r(a);
+    r >>= count;
+    return r;
+}
+
+inline omw::UnsignedInt128 omw::operator>>(const omw::UnsignedInt128& a, unsigned int count)
+{
+    omw::UnsignedInt128 r(a);
+    r >>= count;
+    return r;
+}
+
+
+
+inline bool omw::operator==(const omw::SignedInt128& a, const omw::SignedInt128& b) { return ((a.hi() == b.hi()) && (a.lo() == b.lo())); }
+inline bool omw::operator<(const omw::SignedInt128& a, const omw::SignedInt128& b) { return omw::internal::int128::lessS(a.hi(), a.lo(), b.hi(), b.lo()); }
+
+inline bool omw::operator==(const omw::SignedInt128& a, const omw::UnsignedInt128& b) { return (!a.isNegative() && (a.hi() == b.hi()) && (a.lo() == b.lo())); }
+inline bool omw::operator<(const omw::SignedInt128& a, const omw::UnsignedInt128& b)
+{
+    return (a.isNegative() || (b.hi() & OMW_64BIT_MSB) || omw::internal::int128::lessU(a.hi(), a.lo(), b.hi(), b.lo()));
+}
+
+inline bool omw::operator==(const omw::UnsignedInt128& a, const omw::SignedInt128& b) { return (b == a); }
+inline bool omw::operator<(const omw::UnsignedInt128& a, const omw::SignedInt128& b)
+{
+    return (!(a.hi() & OMW_64BIT_MSB) && !b.isNegative() && omw::internal::int128::lessU(a.hi(), a.lo(), b.hi(), b.lo()));
+}
+
+inline bool omw::operator==(const omw::UnsignedInt128& a, const omw::UnsignedInt128& b) { return ((a.hi() == b.hi()) && (a.lo() == b.lo())); }
+inline bool omw::operator<(const omw::UnsignedInt128& a, const omw::UnsignedInt128& b) { return omw::internal::int128::lessU(a.hi(), a.lo(), b.hi(), b.lo()); }
+
+#define OMWi_DEFINE_DEPENDENT_COMPARSION_OPERATORS(Ta, Tb)                      \
+    inline bool omw::operator!=(const Ta& a, const Tb& b) { return !(a == b); } \
+    inline bool omw::operator>(const Ta& a, const Tb& b) { return (b < a); }    \
+    inline bool omw::operator<=(const Ta& a, const Tb& b) { return !(a > b); }  \
+    inline bool omw::operator>=(const Ta& a, const Tb& b) { return !(a < b); }
+
+// clang-format off
+OMWi_DEFINE_DEPENDENT_COMPARSION_OPERATORS(omw::SignedInt128, omw::SignedInt128)
+OMWi_DEFINE_DEPENDENT_COMPARSION_OPERATORS(omw::SignedInt128, omw::UnsignedInt128)
+OMWi_DEFINE_DEPENDENT_COMPARSION_OPERATORS(omw::UnsignedInt128, omw::SignedInt128)
+OMWi_DEFINE_DEPENDENT_COMPARSION_OPERATORS(omw::UnsignedInt128, omw::UnsignedInt128)
+// clang-format on
+
+#undef OMWi_DEFINE_DEPENDENT_COMPARSION_OPERATORS
+
+
+
+//!
+//! Full 64 x 64 -> 128-bit multiplication.
+//!
+inline omw::uint128_t omw::mul64x64(uint64_t a, uint64_t b)
+{
+    uint64_t h, l;
+    omw::internal::int128::mul64(a, b, h, l);
+    return omw::uint128_t(h, l);
+}
+
+inline unsigned int omw::popCount(const omw::uint128_t& value)
+{
+    return (omw::internal::bit::popcount64(value.hi()) + omw::internal::bit::popcount64(value.lo()));
+}
+
+inline unsigned int omw::countLeadingZeros(const omw::uint128_t& value)
+{
+    return (value.hi() ? omw::internal::bit::clz64(value.hi()) : (64 + omw::internal::bit::clz64(value.lo())));
+}
+
+inline unsigned int omw::countTrailingZeros(const omw::uint128_t& value)
+{
+    return (value.lo() ? omw::internal::bit::ctz64(value.lo()) : (64 + omw::internal::bit::ctz64(value.hi())));
+}
+
+//!
+//! The rotate count is taken modulo 128.
+//!
+inline omw::uint128_t omw::rotateLeft(const omw::uint128_t& value, unsigned int n)
+{
+    return ((value << (n & 127)) | (value >> ((0u - n) & 127)));
+}
+
+//!
+//! The rotate count is taken modulo 128.
+//!
+inline omw::uint128_t omw::rotateRight(const omw::uint128_t& value, unsigned int n) { return omw::rotateLeft(value, 0u - n); }
+
+inline omw::uint128_t omw::byteSwap(const omw::uint128_t& value)
+{
+    return omw::uint128_t(omw::internal::bit::bswap64(value.lo()), omw::internal::bit::bswap64(value.hi()));
+}
+
+
 #endif // IG_OMW_INT_H
@@ -0,0 +1,202 @@
+/*
+author          Oliver Blaser
+date            18.10.2026
+copyright       MIT - Copyright (c) 2026 Oliver Blaser
+*/
+
+#ifndef IG_OMW_INTERNAL_CRCENGINE_H
+#define IG_OMW_INTERNAL_CRCENGINE_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "../../omw/defs.h"
+
+// C++14 is needed to generate the tables at compile time, with C++11 they are generated on the first call
+#if (OMW_CPPSTD >= OMW_CPPSTD_14)
+#define OMWi_CRC_CONSTEXPR constexpr
+#else
+#define OMWi_CRC_CONSTEXPR
+#endif
+
+namespace omw {
+namespace internal {
+
+    // Table driven slicing-by-8 CRC engine shared by `omw::Crc` and the `omw::crc*()` functions. `P` has to provide
+    // `static constexpr omw::CrcParameter<UI> parameter()`.
+    template <class P> class CrcEngine
+    {
+    public:
+        using value_type = decltype(P::parameter().init());
+
+        static constexpr size_t tableSize = 256;
+        static constexpr size_t slices = 8;
+
+        static constexpr unsigned width() { return (8u * sizeof(value_type)); }
+
+        static value_type calc(const uint8_t* data, size_t count)
+        {
+            value_type crc = begin();
+            if (data) crc = updateSlicing(crc, data, count);
+            return finalize(crc);
+        }
+
+        static value_type calcBytewise(const uint8_t* data, size_t count)
+        {
+            value_type crc = begin();
+            if (data) crc = updateBytewise(crc, data, count);
+            return finalize(crc);
+        }
+
+        static OMWi_CRC_CONSTEXPR value_type begin() { return (P::parameter().refIn() ? reflect(P::parameter().init()) : P::parameter().init()); }
+        static value_type updateSlicing(value_type crc, const uint8_t* data, size_t count);
+        static value_type updateBytewise(value_type crc, const uint8_t* data, size_t count);
+        static OMWi_CRC_CONSTEXPR value_type finalize(value_type crc)
+        {
+            return static_cast<value_type>(((P::parameter().refIn() != P::parameter().refOut()) ? reflect(crc) : crc) ^ P::parameter().xorOut());
+        }
+
+        static const value_type* table() { return tables().data[0]; }
+
+        static OMWi_CRC_CONSTEXPR value_type reflect(value_type value)
+        {
+            value_type r = 0;
+
+            for (unsigned i = 0; i < width(); ++i)
+            {
+                r = static_cast<value_type>(r << 1);
+                if (value & 0x01) r |= 0x01;
+                value = static_cast<value_type>(value >> 1);
+            }
+
+            return r;
+        }
+
+    private:
+        // index 0 is the common byte wise table, index k holds the CRC of the byte followed by k zero bytes
+        struct Table
+        {
+            value_type data[slices][tableSize];
+        };
+
+#if (OMW_CPPSTD >= OMW_CPPSTD_14)
+        static const Table m_table;
+        static const Table& tables() { return m_table; }
+#else
+        static const Table& tables()
+        {
+            static const Table t = makeTable();
+            return t;
+        }
+#endif
+
+        static OMWi_CRC_CONSTEXPR Table makeTable()
+        {
+            const value_type msb = static_cast<value_type>(static_cast<value_type>(1) << (width() - 1));
+            const value_type poly = P::parameter().poly();
+            const bool refIn = P::parameter().refIn();
+
+            Table t = {};
+
+            for (size_t i = 0; i < tableSize; ++i)
+            {
+                value_type crc = 0;
+
+                if (refIn)
+                {
+                    const value_type rpoly = reflect(poly);
+                    crc = static_cast<value_type>(i);
+                    for (int bit = 0; bit < 8; ++bit) crc = static_cast<value_type>((crc & 0x01) ? ((crc >> 1) ^ rpoly) : (crc >> 1));
+                }
+                else
+                {
+                    crc = static_cast<value_type>(static_cast<value_type>(i) << (width() - 8));
+                    for (int bit = 0; bit < 8; ++bit) crc = static_cast<value_type>((crc & msb) ? ((crc << 1) ^ poly) : (crc << 1));
+                }
+
+                t.data[0][i] = crc;
+            }
+
+            for (size_t k = 1; k < slices; ++k)
+            {
+                for (size_t i = 0; i < tableSize; ++i)
+                {
+                    const value_type prev = t.data[k - 1][i];
+
+                    if (refIn) t.data[k][i] = static_cast<value_type>((prev >> 8) ^ t.data[0][prev & 0xFF]);
+                    else t.data[k][i] = static_cast<value_type>((prev << 8) ^ t.data[0][(prev >> (width() - 8)) & 0xFF]);
+                }
+            }
+
+            return t;
+        }
+
+        static uint64_t loadLE64(const uint8_t* p)
+        {
+            return (static_cast<uint64_t>(p[0]) | (static_cast<uint64_t>(p[1]) << 8) | (static_cast<uint64_t>(p[2]) << 16) |
+                    (static_cast<uint64_t>(p[3]) << 24) | (static_cast<uint64_t>(p[4]) << 32) | (static_cast<uint64_t>(p[5]) << 40) |
+                    (static_cast<uint64_t>(p[6]) << 48) | (static_cast<uint64_t>(p[7]) << 56));
+        }
+
+        static uint64_t loadBE64(const uint8_t* p)
+        {
+            return ((static_cast<uint64_t>(p[0]) << 56) | (static_cast<uint64_t>(p[1]) << 48) | (static_cast<uint64_t>(p[2]) << 40) |
+                    (static_cast<uint64_t>(p[3]) << 32) | (static_cast<uint64_t>(p[4]) << 24) | (static_cast<uint64_t>(p[5]) << 16) |
+                    (static_cast<uint64_t>(p[6]) << 8) | static_cast<uint64_t>(p[7]));
+        }
+    };
+
+#if (OMW_CPPSTD >= OMW_CPPSTD_14)
+    template <class P> constexpr typename omw::internal::CrcEngine<P>::Table omw::internal::CrcEngine<P>::m_table = omw::internal::CrcEngine<P>::makeTable();
+#endif
+
+    template <class P>
+    typename omw::internal::CrcEngine<P>::value_type omw::internal::CrcEngine<P>::updateSlicing(value_type crc, const uint8_t* data, size_t count)
+    {
+        const Table& tbl = tables();
+
+        while (count >= slices)
+        {
+            value_type r = 0;
+
+            if (P::parameter().refIn())
+            {
+                const uint64_t w = loadLE64(data) ^ crc;
+                for (size_t k = 0; k < 8; ++k) r ^= tbl.data[slices - 1 - k][(w >> (8 * k)) & 0xFF];
+            }
+            else
+            {
+                const uint64_t w = loadBE64(data) ^ (static_cast<uint64_t>(crc) << (64 - width()));
+                for (size_t k = 0; k < 8; ++k) r ^= tbl.data[slices - 1 - k][(w >> (56 - 8 * k)) & 0xFF];
+            }
+
+            crc = r;
+            data += slices;
+            count -= slices;
+        }
+
+        return updateBytewise(crc, data, count);
+    }
+
+    template <class P>
+    typename omw::internal::CrcEngine<P>::value_type omw::internal::CrcEngine<P>::updateBytewise(value_type crc, const uint8_t* data, size_t count)
+    {
+        const Table& tbl = tables();
+
+        if (P::parameter().refIn())
+        {
+            while (count--) crc = static_cast<value_type>((crc >> 8) ^ tbl.data[0][(crc ^ *(data++)) & 0xFF]);
+        }
+        else
+        {
+            while (count--) crc = static_cast<value_type>((crc << 8) ^ tbl.data[0][((crc >> (width() - 8)) ^ *(data++)) & 0xFF]);
+        }
+
+        return crc;
+    }
+
+} // namespace internal
+} // namespace omw
+
+
+#endif // IG_OMW_INTERNAL_CRCENGINE_H
@@ -8,7 +8,9 @@ copyright       MIT - Copyright (c) 2023 Oliver Blaser
 
 #include <cstddef>
 #include <cstdint>
+#include <iterator>
 #include <string>
+#include <system_error>
 #include <utility>
 #include <vector>
 
@@ -16,6 +18,10 @@ copyright       MIT - Copyright (c) 2023 Oliver Blaser
 #include "../omw/int.h"
 #include "../omw/vector.h"
 
+#if (OMW_CPPSTD >= OMW_CPPSTD_17)
+#include <string_view>
+#endif
+
 
 #if OMW_CPPSTD >= OMW_CPPSTD_20
 #define OMW_STDSTRING_CONSTEXPR constexpr
@@ -141,6 +147,141 @@ private:
 
 
 
+/**
+ * @brief Compiled set of search and replace pairs.
+ *
+ * Builds an Aho-Corasick automaton of the search strings once, `replaceAll()` then replaces all of them in a single
+ * pass over the string. Unlike `omw::replaceAll(std::string&, const std::vector<omw::StringReplacePair>&, ...)`, which
+ * applies the pairs one after the other, all pairs are replaced simultaneously: replaced text is not searched again.
+ * Of overlapping matches the leftmost, and of those the longest, is replaced. If multiple pairs have the same search
+ * string, the first one is used. Pairs with an empty search string are ignored.
+ */
+class MultiReplacer
+{
+public:
+    MultiReplacer();
+    explicit MultiReplacer(const std::vector<omw::StringReplacePair>& pairs);
+    MultiReplacer(const omw::StringReplacePair* pairs, size_t count);
+
+    virtual ~MultiReplacer() {}
+
+    const std::vector<omw::StringReplacePair>& pairs() const { return m_pairs; }
+
+    std::string& replaceAll(std::string& str, std::string::size_type startPos = 0, size_t* nReplacementsTotal = nullptr,
+                            std::vector<size_t>* nReplacements = nullptr) const;
+
+private:
+    std::vector<omw::StringReplacePair> m_pairs;
+    std::vector<uint32_t> m_delta; // transitions, indexed by state * m_nClasses + class
+    std::vector<uint32_t> m_depth; // length of the prefix represented by the state
+    std::vector<uint32_t> m_match; // pair of the longest search string which is a suffix of the state, or UINT32_MAX
+    uint16_t m_class[256];         // byte to character class, 0 for the bytes not used in any search string
+    size_t m_nClasses;
+
+    void m_build();
+};
+
+
+
+/**
+ * @brief Compiled substring search.
+ *
+ * Preprocesses the needle once, to search it in any number of strings. The algorithm is selected by the needle length:
+ * - up to 32 bytes: first and last byte filter (SSE2/AVX2 on x86-64, `memchr()` otherwise)
+ * - up to 256 bytes: Boyer-Moore-Horspool
+ * - longer: Two-Way (linear worst case)
+ *
+ * An empty needle is found at the start position.
+ */
+class Searcher
+{
+public:
+    //! @brief Search algorithm
+    enum ALGO
+    {
+        ALGO_AUTO = 0, /*!< Selected by the needle length */
+        ALGO_SIMD,     /*!< First and last byte filter */
+        ALGO_BMH,      /*!< Boyer-Moore-Horspool */
+        ALGO_TWOWAY,   /*!< Two-Way (Crochemore-Perrin) */
+    };
+
+public:
+    Searcher();
+    explicit Searcher(const std::string& needle, ALGO algorithm = ALGO_AUTO);
+    explicit Searcher(const char* needle, ALGO algorithm = ALGO_AUTO);
+    Searcher(const char* needle, size_t count, ALGO algorithm = ALGO_AUTO);
+
+    virtual ~Searcher() {}
+
+    const std::string& needle() const { return m_needle; }
+    size_t size() const { return m_needle.size(); }
+    bool empty() const { return m_needle.empty(); }
+    ALGO algorithm() const { return m_algo; }
+
+    const char* find(const char* first, const char* last) const;
+    std::string::size_type find(const std::string& str, std::string::size_type pos = 0) const;
+
+private:
+    std::string m_needle;
+    ALGO m_algo;
+    std::vector<size_t> m_shift; // bad character shifts of BMH and Two-Way
+    ptrdiff_t m_ell;             // Two-Way critical position - 1
+    size_t m_period;             // Two-Way shift
+    bool m_periodic;             // Two-Way, needle is periodic with period `m_period`
+
+    void m_init(ALGO algorithm);
+    const char* m_findBmh(const char* first, const char* last) const;
+    const char* m_findTwoWay(const char* first, const char* last) const;
+};
+
+
+
+/**
+ * @brief Set of bytes, precomputed for fast scanning.
+ *
+ * The lookup tables are built once on construction, the set can then be used for any number of searches. On x86-64
+ * `find()` and `findNot()` test 16 (SSE2, SSSE3) or 32 (AVX2) bytes at a time, the instruction set is selected at
+ * runtime.
+ */
+class CharSet
+{
+public:
+    CharSet();
+    explicit CharSet(char ch);
+    explicit CharSet(const char* chars);
+    CharSet(const char* chars, size_t count);
+    explicit CharSet(const std::string& chars);
+
+    virtual ~CharSet() {}
+
+    omw::CharSet& add(char ch);
+    omw::CharSet& add(const char* chars, size_t count);
+    omw::CharSet& addRange(char first, char last);
+
+    bool contains(char ch) const
+    {
+        const uint8_t b = static_cast<uint8_t>(ch);
+        return (((m_bitmap[b >> 6] >> (b & 0x3F)) & 1) != 0);
+    }
+
+    size_t size() const;
+    bool empty() const { return (m_count == 0); }
+
+    const char* find(const char* first, const char* last) const;
+    const char* findNot(const char* first, const char* last) const;
+
+private:
+    uint64_t m_bitmap[4];
+    uint8_t m_rowsLo[16]; // bit h is set if the byte (h << 4) | l is in the set, h = [0, 7], indexed by l
+    uint8_t m_rowsHi[16]; // same for h = [8, 15]
+    char m_chars[4];      // the members, if there are at most 4 of them
+    size_t m_count;       // number of members, saturates at 5
+
+    const char* m_scan(const char* first, const char* last, bool negate) const;
+};
+
+
+
 /**
  * Reverses (swaps) the content of the string.
  *
@@ -191,12 +332,14 @@ inline OMW_STDSTRING_CONSTEXPR bool contains(const std::string& str, const std::
 #else
 inline OMW_STDSTRING_CONSTEXPR bool contains(const std::string& str, const std::string_view& sv) { return (str.find(sv) != std::string::npos); }
 #endif
+inline bool contains(const std::string& str, const omw::Searcher& searcher) { return (searcher.find(str) != std::string::npos); }
 
 std::string& replaceFirst(std::string& str, const std::string& search, const std::string& replace, std::string::size_type startPos = 0);
 inline std::string& replaceFirst(std::string& str, const omw::StringReplacePair& pair, std::string::size_type startPos = 0)
 {
     return omw::replaceFirst(str, pair.search(), pair.replace(), startPos);
 }
+std::string& replaceFirst(std::string& str, const omw::Searcher& search, const std::string& replace, std::string::size_type startPos = 0);
 
 std::string& replaceAll(std::string& str, char search, char replace, std::string::size_type startPos = 0, size_t* nReplacements = nullptr);
 std::string& replaceAll(std::string& str, char search, const std::string& replace, std::string::size_type startPos = 0, size_t* nReplacements = nullptr);
@@ -204,10 +347,17 @@ std::string& replaceAll(std::string& str, const std::string& search, char replac
 std::string& replaceAll(std::string& str, const std::string& search, const std::string& replace, std::string::size_type startPos = 0,
                         size_t* nReplacements = nullptr);
 std::string& replaceAll(std::string& str, const omw::StringReplacePair& pair, std::string::size_type startPos = 0, size_t* nReplacements = nullptr);
+std::string& replaceAll(std::string& str, const omw::Searcher& search, const std::string& replace, std::string::size_type startPos = 0,
+                        size_t* nReplacements = nullptr);
 std::string& replaceAll(std::string& str, const std::vector<omw::StringReplacePair>& pairs, std::string::size_type startPos = 0,
                         size_t* nReplacementsTotal = nullptr, std::vector<size_t>* nReplacements = nullptr);
 std::string& replaceAll(std::string& str, const omw::StringReplacePair* pairs, size_t count, std::string::size_type startPos = 0,
                         size_t* nReplacementsTotal = nullptr, std::vector<size_t>* nReplacements = nullptr);
+inline std::string& replaceAll(std::string& str, const omw::MultiReplacer& replacer, std::string::size_type startPos = 0,
+                               size_t* nReplacementsTotal = nullptr, std::vector<size_t>* nReplacements = nullptr)
+{
+    return replacer.replaceAll(str, startPos, nReplacementsTotal, nReplacements);
+}
 /// @}
 
 
@@ -235,6 +385,47 @@ std::string toString(const std::pair<long double, long double>& value, char deli
 /// @}
 
 
+
+//! \name Character Buffer Conversion
+/// @{
+
+/**
+ * Return type of `omw::toChars()`, equivalent to `std::to_chars_result`.
+ */
+struct ToCharsResult
+{
+    char* ptr;    ///< One past the last written character, or `last` on error
+    std::errc ec; ///< Value initialized on success
+};
+
+/**
+ * Return type of `omw::fromChars()`, equivalent to `std::from_chars_result`.
+ */
+struct FromCharsResult
+{
+    const char* ptr; ///< One past the last parsed character, or `first` if no number was found
+    std::errc ec;    ///< Value initialized on success
+};
+
+/**
+ * Maximal number of characters written by `omw::toChars()` for a 128-bit integer (`-170141183460469231731687303715884105728`).
+ */
+constexpr size_t toChars128_maxLength = 40;
+
+omw::ToCharsResult toChars(char* first, char* last, const omw::int128_t& value);
+omw::ToCharsResult toChars(char* first, char* last, const omw::uint128_t& value);
+omw::FromCharsResult fromChars(const char* first, const char* last, omw::int128_t& value);
+omw::FromCharsResult fromChars(const char* first, const char* last, omw::uint128_t& value);
+
+#if (OMW_CPPSTD >= OMW_CPPSTD_14) || defined(OMWi_DOXYGEN_PREDEFINE)
+omw::ToCharsResult toChars(char* first, char* last, const omw::i128& value);
+omw::ToCharsResult toChars(char* first, char* last, const omw::u128& value);
+omw::FromCharsResult fromChars(const char* first, const char* last, omw::i128& value);
+omw::FromCharsResult fromChars(const char* first, const char* last, omw::u128& value);
+#endif
+/// @}
+
+
 //! \name Convert From String
 /// @{
 bool stob(const std::string& str);
@@ -249,8 +440,8 @@ std::pair<int32_t, int32_t> stoipair(const std::string& str, char delimiter = pa
 std::pair<double, double> stodpair(const std::string& str, char delimiter = pairtos_defaultDelimiter);
 // std::pair<long double, long double> stoldpair(const std::string& str, char delimiter = pairtos_defaultDelimiter);
 
-// omw::int128_t stoi128(const std::string& str);
-// omw::uint128_t stoui128(const std::string& str);
+omw::int128_t stoi128(const std::string& str);
+omw::uint128_t stoui128(const std::string& str);
 /// @}
 
 
@@ -315,6 +506,7 @@ static inline omw::StringVector split(const char* str, char delimiter, omw::Stri
 
 
 omw::StringVector split(const std::string& str, const std::string& delimiter, omw::StringVector::size_type maxTokenCount = omw::StringVector_npos);
+omw::StringVector split(const std::string& str, const omw::Searcher& delimiter, omw::StringVector::size_type maxTokenCount = omw::StringVector_npos);
 
 static inline omw::StringVector split(const std::string& str, const char* delimiter, omw::StringVector::size_type maxTokenCount = omw::StringVector_npos)
 {
@@ -333,6 +525,140 @@ static inline omw::StringVector split(const char* str, const char* delimiter, om
 
 
 
+#if (OMW_CPPSTD >= OMW_CPPSTD_17) || defined(OMWi_DOXYGEN_PREDEFINE)
+
+/**
+ * @brief Lazy, non-owning range over the tokens of a string.
+ *
+ * Yields the same tokens as `omw::split()`, but as `std::string_view`s into the original string which are found one
+ * by one while iterating. No memory is allocated. The string (and a string delimiter) must outlive the view and its
+ * iterators. An empty string delimiter does not split the string.
+ *
+ * Use `omw::splitView()` to create the object.
+ *
+ * Requires C++17.
+ */
+class SplitView
+{
+public:
+    using size_type = std::string_view::size_type;
+
+    class iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::string_view;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const std::string_view*;
+        using reference = const std::string_view&;
+
+        iterator()
+            : m_view(nullptr), m_token(), m_pos(std::string_view::npos), m_next(std::string_view::npos), m_count(0)
+        {}
+
+        reference operator*() const { return m_token; }
+        pointer operator->() const { return &m_token; }
+
+        iterator& operator++()
+        {
+            if (m_next == std::string_view::npos) m_pos = std::string_view::npos;
+            else m_setToken(m_next);
+            return *this;
+        }
+
+        iterator operator++(int)
+        {
+            const iterator tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        bool operator==(const iterator& other) const { return (m_pos == other.m_pos); }
+        bool operator!=(const iterator& other) const { return (m_pos != other.m_pos); }
+
+    private:
+        friend class omw::SplitView;
+
+        const omw::SplitView* m_view;
+        std::string_view m_token;
+        size_type m_pos;  // start of the current token, npos at the end
+        size_type m_next; // start of the next token, npos if the current is the last
+        omw::StringVector::size_type m_count;
+
+        explicit iterator(const omw::SplitView* view)
+            : m_view(view), m_token(), m_pos(std::string_view::npos), m_next(std::string_view::npos), m_count(0)
+        {
+            if (m_view->m_maxTokenCount > 0) m_setToken(0);
+        }
+
+        void m_setToken(size_type pos)
+        {
+            const std::string_view& str = m_view->m_str;
+
+            ++m_count;
+            const size_type end = ((m_count < m_view->m_maxTokenCount) ? m_view->m_find(pos) : std::string_view::npos);
+
+            m_pos = pos;
+            if (end == std::string_view::npos)
+            {
+                m_token = str.substr(pos);
+                m_next = std::string_view::npos;
+            }
+            else
+            {
+                m_token = str.substr(pos, end - pos);
+                m_next = end + m_view->m_delimLength();
+            }
+        }
+    };
+
+    using const_iterator = iterator;
+
+    SplitView(std::string_view str, char delimiter, omw::StringVector::size_type maxTokenCount = omw::StringVector_npos)
+        : m_str(str), m_delim(), m_delimCh(delimiter), m_isChar(true), m_maxTokenCount(maxTokenCount)
+    {}
+
+    SplitView(std::string_view str, std::string_view delimiter, omw::StringVector::size_type maxTokenCount = omw::StringVector_npos)
+        : m_str(str), m_delim(delimiter), m_delimCh(0), m_isChar(false), m_maxTokenCount(maxTokenCount)
+    {}
+
+    iterator begin() const { return iterator(this); }
+    iterator end() const { return iterator(); }
+
+private:
+    std::string_view m_str;
+    std::string_view m_delim;
+    char m_delimCh;
+    bool m_isChar;
+    omw::StringVector::size_type m_maxTokenCount;
+
+    size_type m_delimLength() const { return (m_isChar ? 1 : m_delim.size()); }
+
+    size_type m_find(size_type pos) const
+    {
+        if (m_isChar) return m_str.find(m_delimCh, pos);
+        return (m_delim.empty() ? std::string_view::npos : m_str.find(m_delim, pos));
+    }
+};
+
+inline omw::SplitView splitView(std::string_view str, char delimiter, omw::StringVector::size_type maxTokenCount = omw::StringVector_npos)
+{
+    return omw::SplitView(str, delimiter, maxTokenCount);
+}
+
+inline omw::SplitView splitView(std::string_view str, std::string_view delimiter, omw::StringVector::size_type maxTokenCount = omw::StringVector_npos)
+{
+    return omw::SplitView(str, delimiter, maxTokenCount);
+}
+
+size_t splitInto(std::string_view str, char delimiter, std::vector<std::string_view>& tokens, omw::StringVector::size_type maxTokenCount = omw::StringVector_npos);
+size_t splitInto(std::string_view str, std::string_view delimiter, std::vector<std::string_view>& tokens,
+                 omw::StringVector::size_type maxTokenCount = omw::StringVector_npos);
+
+#endif // C++17
+
+
+
 omw::StringVector splitLen(const std::string& str, std::string::size_type tokenLength, omw::StringVector::size_type maxTokenCount = omw::StringVector_npos);
 
 static inline omw::StringVector splitLen(const char* str, std::string::size_type tokenLength,
@@ -413,6 +739,19 @@ bool isHex(const std::string& str, std::string::size_type pos = 0, std::string::
 size_t peekNewLine(const char* p);
 size_t peekNewLine(const char* p, const char* end);
 
+//! \name Scanning
+/// @{
+std::string::size_type findFirstOf(const std::string& str, const omw::CharSet& set, std::string::size_type pos = 0);
+std::string::size_type findFirstNotOf(const std::string& str, const omw::CharSet& set, std::string::size_type pos = 0);
+const char* findNewLine(const char* first, const char* last);
+size_t countLines(const char* first, const char* last);
+size_t countLines(const std::string& str);
+omw::StringVector splitLines(const std::string& str);
+#if (OMW_CPPSTD >= OMW_CPPSTD_17) || defined(OMWi_DOXYGEN_PREDEFINE)
+size_t splitLinesInto(std::string_view str, std::vector<std::string_view>& lines);
+#endif
+/// @}
+
 std::string readString(const uint8_t* data, size_t count);
 std::string readString(const std::vector<uint8_t>& data, std::vector<uint8_t>::size_type pos, std::vector<uint8_t>::size_type count);
 void writeString(uint8_t* buffer, const uint8_t* end, const std::string& str);
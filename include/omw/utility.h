@@ -10,8 +10,18 @@ copyright       MIT - Copyright (c) 2023 Oliver Blaser
 #include <cstddef>
 #include <cstdint>
 #include <string>
+#include <type_traits>
 #include <vector>
 
+#include "../omw/defs.h"
+
+
+#if (OMW_CPPSTD >= OMW_CPPSTD_14)
+#define OMWi_SHIFT_CONSTEXPR constexpr
+#else
+#define OMWi_SHIFT_CONSTEXPR
+#endif
+
 
 
 /*! \addtogroup grp_utility_langSupport
@@ -31,42 +41,83 @@ copyright       MIT - Copyright (c) 2023 Oliver Blaser
 
 namespace omw {
 
+namespace internal {
+    namespace shift {
+
+        template <typename T>
+        using EnableIfInt = std::enable_if<std::is_integral<T>::value && !std::is_same<typename std::remove_cv<T>::type, bool>::value>;
+
+        // all bits set if `cond` is true
+        template <typename W> constexpr W mask(bool cond) { return static_cast<W>(W(0) - W(cond)); }
+
+        // min(n, nBits - 1) without a branch
+        constexpr unsigned int clamp(unsigned int n, unsigned int nBits) { return ((n & (nBits - 1)) | ((nBits - 1) & mask<unsigned int>(n >= nBits))); }
+
+        // The value is processed in the working type `W` (at least 32 bit, so that it is not promoted to int).
+        template <typename T> struct Traits
+        {
+            using U = typename std::make_unsigned<T>::type;
+            using W = typename std::conditional<(sizeof(T) > sizeof(uint32_t)), uint64_t, uint32_t>::type;
+
+            static constexpr unsigned int nBits = sizeof(T) * 8;
+            static constexpr bool isSigned = std::is_signed<T>::value;
+
+            static constexpr W load(T value) { return static_cast<W>(static_cast<U>(value)); }
+
+            // all bits set if the value is negative
+            static constexpr W sign(T value) { return mask<W>(isSigned && ((load(value) >> (nBits - 1)) != 0)); }
+
+            // the bits of negative values are inverted, so that the logical right shift equals the arithmetic one
+            static constexpr W flip(T value) { return static_cast<W>(static_cast<U>(load(value) ^ sign(value))); }
+        };
+
+    } // namespace shift
+} // namespace internal
+
 /*! \addtogroup grp_utility_langSupport
  * @{
  */
 
-void shiftLeftAssign(int8_t& value, unsigned int n);
-void shiftLeftAssign(int16_t& value, unsigned int n);
-void shiftLeftAssign(int32_t& value, unsigned int n); /*!< See \ref grp_utility_langSupport_section_bitShiftOp in \ref grp_utility_langSupport. */
-void shiftLeftAssign(int64_t& value, unsigned int n);
-void shiftLeftAssign(uint8_t& value, unsigned int n);
-void shiftLeftAssign(uint16_t& value, unsigned int n);
-void shiftLeftAssign(uint32_t& value, unsigned int n);
-void shiftLeftAssign(uint64_t& value, unsigned int n);
-void shiftRightAssign(int8_t& value, unsigned int n);
-void shiftRightAssign(int16_t& value, unsigned int n);
-void shiftRightAssign(int32_t& value, unsigned int n); /*!< See \ref grp_utility_langSupport_section_bitShiftOp in \ref grp_utility_langSupport. */
-void shiftRightAssign(int64_t& value, unsigned int n);
-void shiftRightAssign(uint8_t& value, unsigned int n);
-void shiftRightAssign(uint16_t& value, unsigned int n);
-void shiftRightAssign(uint32_t& value, unsigned int n);
-void shiftRightAssign(uint64_t& value, unsigned int n);
-int8_t shiftLeft(int8_t value, unsigned int n);
-int16_t shiftLeft(int16_t value, unsigned int n);
-int32_t shiftLeft(int32_t value, unsigned int n); /*!< See \ref grp_utility_langSupport_section_bitShiftOp in \ref grp_utility_langSupport. */
-int64_t shiftLeft(int64_t value, unsigned int n);
-uint8_t shiftLeft(uint8_t value, unsigned int n);
-uint16_t shiftLeft(uint16_t value, unsigned int n);
-uint32_t shiftLeft(uint32_t value, unsigned int n);
-uint64_t shiftLeft(uint64_t value, unsigned int n);
-int8_t shiftRight(int8_t value, unsigned int n);
-int16_t shiftRight(int16_t value, unsigned int n);
-int32_t shiftRight(int32_t value, unsigned int n); /*!< See \ref grp_utility_langSupport_section_bitShiftOp in \ref grp_utility_langSupport. */
-int64_t shiftRight(int64_t value, unsigned int n);
-uint8_t shiftRight(uint8_t value, unsigned int n);
-uint16_t shiftRight(uint16_t value, unsigned int n);
-uint32_t shiftRight(uint32_t value, unsigned int n);
-uint64_t shiftRight(uint64_t value, unsigned int n);
+/**
+ * See \ref grp_utility_langSupport_section_bitShiftOp in \ref grp_utility_langSupport.
+ */
+template <typename T, typename internal::shift::EnableIfInt<T>::type* = nullptr> constexpr T shiftLeft(T value, unsigned int n)
+{
+    using tr = internal::shift::Traits<T>;
+    return static_cast<T>(static_cast<typename tr::U>((tr::load(value) << (n & (tr::nBits - 1))) & internal::shift::mask<typename tr::W>(n < tr::nBits)));
+}
+
+/**
+ * See \ref grp_utility_langSupport_section_bitShiftOp in \ref grp_utility_langSupport.
+ */
+template <typename T, typename internal::shift::EnableIfInt<T>::type* = nullptr> constexpr T shiftRight(T value, unsigned int n)
+{
+    using tr = internal::shift::Traits<T>;
+    return static_cast<T>(static_cast<typename tr::U>(
+        ((tr::flip(value) >> internal::shift::clamp(n, tr::nBits)) & internal::shift::mask<typename tr::W>(tr::isSigned || (n < tr::nBits))) ^
+        tr::sign(value)));
+}
+
+/**
+ * See \ref grp_utility_langSupport_section_bitShiftOp in \ref grp_utility_langSupport.
+ */
+template <typename T, typename internal::shift::EnableIfInt<T>::type* = nullptr> OMWi_SHIFT_CONSTEXPR void shiftLeftAssign(T& value, unsigned int n)
+{
+    value = omw::shiftLeft(value, n);
+}
+
+/**
+ * See \ref grp_utility_langSupport_section_bitShiftOp in \ref grp_utility_langSupport.
+ */
+template <typename T, typename internal::shift::EnableIfInt<T>::type* = nullptr> OMWi_SHIFT_CONSTEXPR void shiftRightAssign(T& value, unsigned int n)
+{
+    value = omw::shiftRight(value, n);
+}
+
+void shiftLeft(uint8_t* data, size_t size, size_t n);
+void shiftRight(uint8_t* data, size_t size, size_t n);
+void rotateLeft(uint8_t* data, size_t size, size_t n);
+void rotateRight(uint8_t* data, size_t size, size_t n);
 
 // grp_utility_langSupport
 /*! @} */
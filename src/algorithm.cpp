@@ -4,73 +4,8 @@ date            20.12.2021
 copyright       MIT - Copyright (c) 2021 Oliver Blaser
 */
 
-#include <bitset>
-
 #include "omw/algorithm.h"
-
-
-namespace {
-
-namespace doubleDabble {
-
-    void add3(std::vector<uint8_t>& bcd)
-    {
-        for (size_t i = 0; i < bcd.size(); ++i)
-        {
-            uint8_t h = bcd[i] >> 4;
-            uint8_t l = bcd[i] & 0x0F;
-
-            if (h >= 5) h += 3;
-            if (l >= 5) l += 3;
-
-#if 0 // proof that add3 operation never overflows a BCD digit
-            static bool overflow = false;
-            static bool cntOverflow = false;
-            static uint64_t cntH = 0;
-            static uint64_t cntM = 0;
-            static uint64_t cntL = 0;
-            if ((h & 0xF0) || (l & 0xF0))
-            {
-                overflow = true;
-
-                if (cntH == 0xFFFFFFFFFFFFFFFF) cntOverflow = true;
-                if (cntM == 0xFFFFFFFFFFFFFFFF) ++cntH;
-                if (cntL == 0xFFFFFFFFFFFFFFFF) ++cntM;
-                ++cntL;
-            }
-#endif
-
-            bcd[i] = h;
-            bcd[i] <<= 4;
-            bcd[i] |= l;
-        }
-    }
-
-    template <size_t N> void leftShift(std::vector<uint8_t>& bcd, std::bitset<N>& bin)
-    {
-        for (size_t i = 0; i < (bcd.size() - 1); ++i)
-        {
-            bcd[i] <<= 1;
-            if (bcd[i + 1] & 0x80) bcd[i] |= 0x01;
-        }
-
-        bcd[bcd.size() - 1] <<= 1;
-        if (bin.test(N - 1)) bcd[bcd.size() - 1] |= 0x01;
-
-        bin <<= 1;
-    }
-
-    template <size_t N> void dd(std::vector<uint8_t>& bcd, std::bitset<N>& bin)
-    {
-        for (size_t i = 0; i < N; ++i)
-        {
-            ::doubleDabble::add3(bcd);
-            ::doubleDabble::leftShift(bcd, bin);
-        }
-    }
-
-} // namespace doubleDabble
-} // namespace
+#include "omw/encoding.h"
 
 
 std::vector<uint8_t> omw::doubleDabble128(uint32_t valueHH, uint32_t valueLH, uint32_t valueHL, uint32_t valueLL)
@@ -86,61 +21,140 @@ std::vector<uint8_t> omw::doubleDabble128(uint32_t valueHH, uint32_t valueLH, ui
     return omw::doubleDabble128(value64H, value64L);
 }
 
-std::vector<uint8_t> omw::doubleDabble128(uint64_t valueH, uint64_t valueL)
-{
-    constexpr size_t bitWidth = 128;
-    using chunk_t = uint64_t;
-    constexpr size_t chunkWidth = 64;
+std::vector<uint8_t> omw::doubleDabble128(uint64_t valueH, uint64_t valueL) { return omw::doubleDabble(omw::uint128_t(valueH, valueL)); }
 
+//! Returns the 40 digit packed BCD representation of the value, see `omw::bcd::encode()`.
+std::vector<uint8_t> omw::doubleDabble(const omw::uint128_t& value)
+{
     std::vector<uint8_t> bcd(20);
-    std::bitset<bitWidth> bin;
+    omw::bcd::encode(bcd.data(), bcd.size(), value);
+    return bcd;
+}
+
+
+
+namespace {
+
+// Myers' bit-parallel edit distance in the formulation of Hyyrö, with the pattern split into blocks of 64 symbols. The
+// blocks are processed per text symbol from top to bottom, passing the horizontal delta (-1, 0, +1) of the block's last
+// row to the next block.
+//
+// Returns the horizontal delta at the `outBit` row of the block.
+int levenshtein_advanceBlock(uint64_t& pv, uint64_t& mv, uint64_t eq, int hin, uint64_t outBit)
+{
+    if (hin < 0) eq |= 1;
 
-    // init
+    const uint64_t xv = eq | mv;
+    const uint64_t xh = (((eq & pv) + pv) ^ pv) | eq;
+    uint64_t ph = mv | ~(xh | pv);
+    uint64_t mh = pv & xh;
+
+    const int hout = ((ph & outBit) ? 1 : ((mh & outBit) ? -1 : 0));
+
+    ph <<= 1;
+    mh <<= 1;
+    if (hin < 0) mh |= 1;
+    else if (hin > 0) ph |= 1;
+
+    pv = mh | ~(xv | ph);
+    mv = ph & xv;
+
+    return hout;
+}
+
+// `m` is the length of the pattern `p`, 0 < m <= 64
+size_t levenshtein_myers64(const uint8_t* p, size_t m, const uint8_t* t, size_t n)
+{
+    // only the entries of the symbols which are used are initialized, that is cheaper than clearing the whole table for short strings
+    uint64_t peq[256];
+    for (size_t i = 0; i < m; ++i) peq[p[i]] = 0;
+    for (size_t j = 0; j < n; ++j) peq[t[j]] = 0;
+    for (size_t i = 0; i < m; ++i) peq[p[i]] |= (uint64_t(1) << i);
+
+    const uint64_t outBit = (uint64_t(1) << (m - 1));
+    uint64_t pv = OMW_64BIT_ALL;
+    uint64_t mv = 0;
+    size_t score = m;
+
+    for (size_t j = 0; j < n; ++j)
     {
-        chunk_t chunkValue;
-        chunk_t chunkMask;
-
-        // i = 0
-        chunkValue = valueL;
-        chunkMask = 1;
-        for (size_t j = 0; j < chunkWidth; ++j)
-        {
-            bin.set(j, ((chunkValue & chunkMask) != 0));
-            chunkMask <<= 1;
-        }
-
-        // i = 1
-        chunkValue = valueH;
-        chunkMask = 1;
-        for (size_t j = 0; j < chunkWidth; ++j)
-        {
-            bin.set(chunkWidth + j, ((chunkValue & chunkMask) != 0));
-            chunkMask <<= 1;
-        }
+        const int h = ::levenshtein_advanceBlock(pv, mv, peq[t[j]], 1, outBit);
+        if (h > 0) ++score;
+        else if (h < 0) --score;
     }
 
-    ::doubleDabble::dd(bcd, bin);
+    return score;
+}
 
-    return bcd;
+// `m` is the length of the pattern `p`, 64 < m
+size_t levenshtein_myersBlocked(const uint8_t* p, size_t m, const uint8_t* t, size_t n)
+{
+    const size_t nBlocks = (m + 63) / 64;
+
+    std::vector<uint64_t> peq(256 * nBlocks, 0);
+    for (size_t i = 0; i < m; ++i) peq[(p[i] * nBlocks) + (i / 64)] |= (uint64_t(1) << (i % 64));
+
+    std::vector<uint64_t> pv(nBlocks, OMW_64BIT_ALL);
+    std::vector<uint64_t> mv(nBlocks, 0);
+    const size_t last = nBlocks - 1;
+    const uint64_t outBit = (uint64_t(1) << ((m - 1) % 64));
+    size_t score = m;
+
+    for (size_t j = 0; j < n; ++j)
+    {
+        const uint64_t* const eq = peq.data() + (t[j] * nBlocks);
+        int h = 1;
+
+        for (size_t k = 0; k < last; ++k) h = ::levenshtein_advanceBlock(pv[k], mv[k], eq[k], h, OMW_64BIT_MSB);
+        h = ::levenshtein_advanceBlock(pv[last], mv[last], eq[last], h, outBit);
+
+        if (h > 0) ++score;
+        else if (h < 0) --score;
+    }
+
+    return score;
 }
 
-std::vector<uint8_t> omw::doubleDabble(const omw::uint128_t& value)
+} // namespace
+
+//! @return The edit distance, `SIZE_MAX` if a pointer is `NULL`
+//!
+//! Bit-parallel algorithm by Myers/Hyyrö, O(n * ceil(m / 64)) time and O(m) memory where m is the length of the shorter
+//! string. Strings of up to 64 characters are processed without heap allocation.
+//!
+size_t omw::levenshteinDistance(const char* a, size_t aCount, const char* b, size_t bCount)
 {
-    std::vector<uint8_t> bcd(20);
-    std::bitset<128> bin;
+    if (!a || !b) return SIZE_MAX;
 
-    // init
+    const uint8_t* pa = reinterpret_cast<const uint8_t*>(a);
+    const uint8_t* pb = reinterpret_cast<const uint8_t*>(b);
+
+    // common prefix and suffix do not change the distance
+    while ((aCount > 0) && (bCount > 0) && (*pa == *pb))
+    {
+        ++pa;
+        ++pb;
+        --aCount;
+        --bCount;
+    }
+    while ((aCount > 0) && (bCount > 0) && (pa[aCount - 1] == pb[bCount - 1]))
     {
-        omw::uint128_t chunkMask = 1;
+        --aCount;
+        --bCount;
+    }
 
-        for (size_t i = 0; i < 128; ++i)
-        {
-            bin.set(i, static_cast<bool>(value & chunkMask));
-            chunkMask <<= 1;
-        }
+    // the shorter string is the pattern
+    if (aCount > bCount)
+    {
+        std::swap(pa, pb);
+        std::swap(aCount, bCount);
     }
 
-    ::doubleDabble::dd(bcd, bin);
+    size_t r;
 
-    return bcd;
+    if (aCount == 0) r = bCount;
+    else if (aCount <= 64) r = ::levenshtein_myers64(pa, aCount, pb, bCount);
+    else r = ::levenshtein_myersBlocked(pa, aCount, pb, bCount);
+
+    return r;
 }
@@ -6,120 +6,1678 @@ copyright       MIT - Copyright (c) 2022 Oliver Blaser
 
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <stdexcept>
 #include <vector>
 
+#include "cpuFeatures.h"
 #include "omw/checksum.h"
+#include "omw/defs.h"
 
 
 namespace {
 
-#ifndef ___OMWi_REGION_preview
-
-const uint16_t tableKermit___[] = {
-    0x0000, 0x1189, 0x2312, 0x329B, 0x4624, 0x57AD, 0x6536, 0x74BF, 0x8C48, 0x9DC1, 0xAF5A, 0xBED3, 0xCA6C, 0xDBE5, 0xE97E, 0xF8F7, 0x1081, 0x0108, 0x3393,
-    0x221A, 0x56A5, 0x472C, 0x75B7, 0x643E, 0x9CC9, 0x8D40, 0xBFDB, 0xAE52, 0xDAED, 0xCB64, 0xF9FF, 0xE876, 0x2102, 0x308B, 0x0210, 0x1399, 0x6726, 0x76AF,
-    0x4434, 0x55BD, 0xAD4A, 0xBCC3, 0x8E58, 0x9FD1, 0xEB6E, 0xFAE7, 0xC87C, 0xD9F5, 0x3183, 0x200A, 0x1291, 0x0318, 0x77A7, 0x662E, 0x54B5, 0x453C, 0xBDCB,
-    0xAC42, 0x9ED9, 0x8F50, 0xFBEF, 0xEA66, 0xD8FD, 0xC974, 0x4204, 0x538D, 0x6116, 0x709F, 0x0420, 0x15A9, 0x2732, 0x36BB, 0xCE4C, 0xDFC5, 0xED5E, 0xFCD7,
-    0x8868, 0x99E1, 0xAB7A, 0xBAF3, 0x5285, 0x430C, 0x7197, 0x601E, 0x14A1, 0x0528, 0x37B3, 0x263A, 0xDECD, 0xCF44, 0xFDDF, 0xEC56, 0x98E9, 0x8960, 0xBBFB,
-    0xAA72, 0x6306, 0x728F, 0x4014, 0x519D, 0x2522, 0x34AB, 0x0630, 0x17B9, 0xEF4E, 0xFEC7, 0xCC5C, 0xDDD5, 0xA96A, 0xB8E3, 0x8A78, 0x9BF1, 0x7387, 0x620E,
-    0x5095, 0x411C, 0x35A3, 0x242A, 0x16B1, 0x0738, 0xFFCF, 0xEE46, 0xDCDD, 0xCD54, 0xB9EB, 0xA862, 0x9AF9, 0x8B70, 0x8408, 0x9581, 0xA71A, 0xB693, 0xC22C,
-    0xD3A5, 0xE13E, 0xF0B7, 0x0840, 0x19C9, 0x2B52, 0x3ADB, 0x4E64, 0x5FED, 0x6D76, 0x7CFF, 0x9489, 0x8500, 0xB79B, 0xA612, 0xD2AD, 0xC324, 0xF1BF, 0xE036,
-    0x18C1, 0x0948, 0x3BD3, 0x2A5A, 0x5EE5, 0x4F6C, 0x7DF7, 0x6C7E, 0xA50A, 0xB483, 0x8618, 0x9791, 0xE32E, 0xF2A7, 0xC03C, 0xD1B5, 0x2942, 0x38CB, 0x0A50,
-    0x1BD9, 0x6F66, 0x7EEF, 0x4C74, 0x5DFD, 0xB58B, 0xA402, 0x9699, 0x8710, 0xF3AF, 0xE226, 0xD0BD, 0xC134, 0x39C3, 0x284A, 0x1AD1, 0x0B58, 0x7FE7, 0x6E6E,
-    0x5CF5, 0x4D7C, 0xC60C, 0xD785, 0xE51E, 0xF497, 0x8028, 0x91A1, 0xA33A, 0xB2B3, 0x4A44, 0x5BCD, 0x6956, 0x78DF, 0x0C60, 0x1DE9, 0x2F72, 0x3EFB, 0xD68D,
-    0xC704, 0xF59F, 0xE416, 0x90A9, 0x8120, 0xB3BB, 0xA232, 0x5AC5, 0x4B4C, 0x79D7, 0x685E, 0x1CE1, 0x0D68, 0x3FF3, 0x2E7A, 0xE70E, 0xF687, 0xC41C, 0xD595,
-    0xA12A, 0xB0A3, 0x8238, 0x93B1, 0x6B46, 0x7ACF, 0x4854, 0x59DD, 0x2D62, 0x3CEB, 0x0E70, 0x1FF9, 0xF78F, 0xE606, 0xD49D, 0xC514, 0xB1AB, 0xA022, 0x92B9,
-    0x8330, 0x7BC7, 0x6A4E, 0x58D5, 0x495C, 0x3DE3, 0x2C6A, 0x1EF1, 0x0F78
+// `omw::Crc` (C++14) adds the SIMD `update()` specialisations of CRC-32 and CRC-32C to the shared engine
+#if (OMW_CPPSTD >= OMW_CPPSTD_14)
+template <class P> using CrcEngine = omw::Crc<P>;
+#else
+template <class P> using CrcEngine = omw::internal::CrcEngine<P>;
+#endif
+
+// Exceptions
+// - `std::invalid_argument`
+template <class P>
+typename ::CrcEngine<P>::value_type crc_vector(const std::vector<uint8_t>& data, std::vector<uint8_t>::size_type pos, std::vector<uint8_t>::size_type count,
+                                            const char* fnName)
+{
+    if (((data.size() - pos) < count) || (pos > data.size())) throw std::invalid_argument(fnName);
+    return ::CrcEngine<P>::calc(data.data() + pos, count);
+}
+
+// used by the `omw::Crc` specialisations, which need C++14
+#if defined(OMWi_X86_DISPATCH) && (OMW_CPPSTD >= OMW_CPPSTD_14)
+
+// CRC-32C using the SSE4.2 `crc32` instruction, the register is in the reflected domain just like in the table engine
+OMWi_TARGET("sse4.2") uint32_t crc32c_sse42(uint32_t crc, const uint8_t* data, size_t count)
+{
+    uint64_t crc64 = crc;
+
+    while (count >= 8)
+    {
+        uint64_t w;
+        std::memcpy(&w, data, 8);
+        crc64 = _mm_crc32_u64(crc64, w);
+        data += 8;
+        count -= 8;
+    }
+
+    crc = static_cast<uint32_t>(crc64);
+    while (count--) crc = _mm_crc32_u8(crc, *(data++));
+
+    return crc;
+}
+
+// Bit reflected CRC-32 (polynomial 0x04C11DB7) by folding with carry-less multiplication, see Intel's paper "Fast CRC Computation for Generic
+// Polynomials Using PCLMULQDQ Instruction". Processes `count` bytes, `count` has to be a multiple of 16 and at least 64.
+OMWi_TARGET("sse4.1,pclmul") uint32_t crc32_clmul(uint32_t crc, const uint8_t* data, size_t count)
+{
+    alignas(16) static const uint64_t k1k2[] = { 0x0154442BD4, 0x01C6E41596 };
+    alignas(16) static const uint64_t k3k4[] = { 0x01751997D0, 0x00CCAA009E };
+    alignas(16) static const uint64_t k5k0[] = { 0x0163CD6124, 0x0000000000 };
+    alignas(16) static const uint64_t poly[] = { 0x01DB710641, 0x01F7011641 };
+
+    __m128i x0, x1, x2, x3, x4, x5, x6, x7, x8, y5, y6, y7, y8;
+
+    x1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x00));
+    x2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x10));
+    x3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x20));
+    x4 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x30));
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(static_cast<int>(crc)));
+    x0 = _mm_load_si128(reinterpret_cast<const __m128i*>(k1k2));
+    data += 64;
+    count -= 64;
+
+    // fold 4x128 bits in parallel
+    while (count >= 64)
+    {
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x6 = _mm_clmulepi64_si128(x2, x0, 0x00);
+        x7 = _mm_clmulepi64_si128(x3, x0, 0x00);
+        x8 = _mm_clmulepi64_si128(x4, x0, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x2 = _mm_clmulepi64_si128(x2, x0, 0x11);
+        x3 = _mm_clmulepi64_si128(x3, x0, 0x11);
+        x4 = _mm_clmulepi64_si128(x4, x0, 0x11);
+
+        y5 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x00));
+        y6 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x10));
+        y7 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x20));
+        y8 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x30));
+
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), y5);
+        x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), y6);
+        x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), y7);
+        x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), y8);
+
+        data += 64;
+        count -= 64;
+    }
+
+    // fold into 128 bits
+    x0 = _mm_load_si128(reinterpret_cast<const __m128i*>(k3k4));
+
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);
+
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);
+
+    // fold the remaining 128 bit blocks
+    while (count >= 16)
+    {
+        x2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+
+        data += 16;
+        count -= 16;
+    }
+
+    // fold 128 to 64 bits
+    x2 = _mm_clmulepi64_si128(x1, x0, 0x10);
+    x3 = _mm_setr_epi32(~0, 0, ~0, 0);
+    x1 = _mm_srli_si128(x1, 8);
+    x1 = _mm_xor_si128(x1, x2);
+
+    x0 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(k5k0));
+
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_and_si128(x1, x3);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    // Barrett reduction to 32 bits
+    x0 = _mm_load_si128(reinterpret_cast<const __m128i*>(poly));
+
+    x2 = _mm_and_si128(x1, x3);
+    x2 = _mm_clmulepi64_si128(x2, x0, 0x10);
+    x2 = _mm_and_si128(x2, x3);
+    x2 = _mm_clmulepi64_si128(x2, x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    return static_cast<uint32_t>(_mm_extract_epi32(x1, 1));
+}
+
+#endif // OMWi_X86_DISPATCH && C++14
+
+// XOR reduction for the parity words. The kernels process the largest multiple of `parityLanes` bytes and XOR the result into `lanes`,
+// `lanes[i]` is the parity of all bytes at index `i` modulo `parityLanes`.
+constexpr size_t parityLanes = 32;
+using parity_kernel_t = size_t (*)(const uint8_t* data, size_t count, uint8_t* lanes);
+
+#ifdef OMWi_X86_DISPATCH
+
+// SSE2 is part of x86-64, no runtime check needed
+size_t parityKernel_sse2(const uint8_t* data, size_t count, uint8_t* lanes)
+{
+    __m128i acc0 = _mm_setzero_si128();
+    __m128i acc1 = _mm_setzero_si128();
+    const size_t n = count - (count % parityLanes);
+
+    for (size_t i = 0; i < n; i += parityLanes)
+    {
+        acc0 = _mm_xor_si128(acc0, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)));
+        acc1 = _mm_xor_si128(acc1, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + 16)));
+    }
+
+    uint8_t tmp[parityLanes];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(tmp), acc0);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(tmp + 16), acc1);
+    for (size_t i = 0; i < parityLanes; ++i) lanes[i] ^= tmp[i];
+
+    return n;
+}
+
+OMWi_TARGET("avx2") size_t parityKernel_avx2(const uint8_t* data, size_t count, uint8_t* lanes)
+{
+    __m256i acc0 = _mm256_setzero_si256();
+    __m256i acc1 = _mm256_setzero_si256();
+    __m256i acc2 = _mm256_setzero_si256();
+    __m256i acc3 = _mm256_setzero_si256();
+    size_t i = 0;
+
+    // four independent accumulators to keep the loads in flight
+    while ((count - i) >= (4 * parityLanes))
+    {
+        acc0 = _mm256_xor_si256(acc0, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)));
+        acc1 = _mm256_xor_si256(acc1, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 32)));
+        acc2 = _mm256_xor_si256(acc2, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 64)));
+        acc3 = _mm256_xor_si256(acc3, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 96)));
+        i += 4 * parityLanes;
+    }
+
+    while ((count - i) >= parityLanes)
+    {
+        acc0 = _mm256_xor_si256(acc0, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)));
+        i += parityLanes;
+    }
+
+    acc0 = _mm256_xor_si256(_mm256_xor_si256(acc0, acc1), _mm256_xor_si256(acc2, acc3));
+
+    uint8_t tmp[parityLanes];
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(tmp), acc0);
+    for (size_t k = 0; k < parityLanes; ++k) lanes[k] ^= tmp[k];
+
+    _mm256_zeroupper();
+
+    return i;
+}
+
+#else // OMWi_X86_DISPATCH
+
+size_t parityKernel_word(const uint8_t* data, size_t count, uint8_t* lanes)
+{
+    uint64_t acc[4] = { 0, 0, 0, 0 };
+    const size_t n = count - (count % parityLanes);
+
+    for (size_t i = 0; i < n; i += parityLanes)
+    {
+        uint64_t w[4];
+        std::memcpy(w, data + i, sizeof(w));
+        acc[0] ^= w[0];
+        acc[1] ^= w[1];
+        acc[2] ^= w[2];
+        acc[3] ^= w[3];
+    }
+
+    uint8_t tmp[parityLanes];
+    std::memcpy(tmp, acc, sizeof(tmp));
+    for (size_t i = 0; i < parityLanes; ++i) lanes[i] ^= tmp[i];
+
+    return n;
+}
+
+#endif // OMWi_X86_DISPATCH
+
+parity_kernel_t parityKernel()
+{
+#ifdef OMWi_X86_DISPATCH
+    static const parity_kernel_t kernel = (omw::internal::cpu::hasAvx2() ? parityKernel_avx2 : parityKernel_sse2);
+#else
+    static const parity_kernel_t kernel = parityKernel_word;
+#endif
+
+    return kernel;
+}
+
+// returns the parity of every byte position modulo `parityLanes`
+void parityLanesOf(const uint8_t* data, size_t count, uint8_t* lanes)
+{
+    for (size_t i = 0; i < parityLanes; ++i) lanes[i] = 0;
+
+    if (data)
+    {
+        size_t i = (count >= parityLanes) ? parityKernel()(data, count, lanes) : 0;
+        for (; i < count; ++i) lanes[i % parityLanes] ^= data[i];
+    }
+}
+
+// helpers for the hash functions
+
+uint32_t readLE32(const uint8_t* p)
+{
+    return (static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) | (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24));
+}
+
+uint64_t readLE64(const uint8_t* p) { return (static_cast<uint64_t>(readLE32(p)) | (static_cast<uint64_t>(readLE32(p + 4)) << 32)); }
+
+void writeLE64(uint8_t* p, uint64_t value)
+{
+    for (size_t i = 0; i < 8; ++i) p[i] = static_cast<uint8_t>(value >> (8 * i));
+}
+
+uint64_t rotl64(uint64_t value, unsigned n) { return ((value << n) | (value >> (64 - n))); }
+
+uint32_t swap32(uint32_t value)
+{
+    return (((value << 24) & 0xFF000000) | ((value << 8) & 0x00FF0000) | ((value >> 8) & 0x0000FF00) | ((value >> 24) & 0x000000FF));
+}
+
+uint64_t swap64(uint64_t value) { return ((static_cast<uint64_t>(swap32(static_cast<uint32_t>(value))) << 32) | swap32(static_cast<uint32_t>(value >> 32))); }
+
+// 64x64 => 128 bit multiplication, returns the XOR of the high and low half
+uint64_t mul128Fold64(uint64_t a, uint64_t b)
+{
+#if defined(__SIZEOF_INT128__)
+    __extension__ typedef unsigned __int128 uint128_t;
+    const uint128_t r = static_cast<uint128_t>(a) * b;
+    return (static_cast<uint64_t>(r) ^ static_cast<uint64_t>(r >> 64));
+#else
+    const uint64_t aLo = a & 0xFFFFFFFF;
+    const uint64_t aHi = a >> 32;
+    const uint64_t bLo = b & 0xFFFFFFFF;
+    const uint64_t bHi = b >> 32;
+
+    const uint64_t lolo = aLo * bLo;
+    const uint64_t hilo = aHi * bLo;
+    const uint64_t lohi = aLo * bHi;
+    const uint64_t hihi = aHi * bHi;
+
+    const uint64_t cross = (lolo >> 32) + (hilo & 0xFFFFFFFF) + lohi;
+    const uint64_t hi = (hilo >> 32) + (cross >> 32) + hihi;
+    const uint64_t lo = (cross << 32) | (lolo & 0xFFFFFFFF);
+
+    return (lo ^ hi);
+#endif
+}
+
+constexpr uint32_t xxhPrime32_1 = 0x9E3779B1;
+constexpr uint32_t xxhPrime32_2 = 0x85EBCA77;
+constexpr uint32_t xxhPrime32_3 = 0xC2B2AE3D;
+constexpr uint64_t xxhPrime64_1 = 0x9E3779B185EBCA87;
+constexpr uint64_t xxhPrime64_2 = 0xC2B2AE3D27D4EB4F;
+constexpr uint64_t xxhPrime64_3 = 0x165667B19E3779F9;
+constexpr uint64_t xxhPrime64_4 = 0x85EBCA77C2B2AE63;
+constexpr uint64_t xxhPrime64_5 = 0x27D4EB2F165667C5;
+constexpr uint64_t xxhPrimeMx1 = 0x165667919E3779F9;
+constexpr uint64_t xxhPrimeMx2 = 0x9FB21C651E98DF25;
+
+uint64_t xxh64Round(uint64_t acc, uint64_t input)
+{
+    acc += input * xxhPrime64_2;
+    acc = rotl64(acc, 31);
+    return (acc * xxhPrime64_1);
+}
+
+uint64_t xxh64MergeRound(uint64_t acc, uint64_t value)
+{
+    acc ^= xxh64Round(0, value);
+    return ((acc * xxhPrime64_1) + xxhPrime64_4);
+}
+
+uint64_t xxh64Avalanche(uint64_t h)
+{
+    h ^= h >> 33;
+    h *= xxhPrime64_2;
+    h ^= h >> 29;
+    h *= xxhPrime64_3;
+    h ^= h >> 32;
+    return h;
+}
+
+// processes the last 0..31 bytes
+uint64_t xxh64Finalize(uint64_t h, const uint8_t* data, size_t count)
+{
+    while (count >= 8)
+    {
+        h ^= xxh64Round(0, readLE64(data));
+        h = (rotl64(h, 27) * xxhPrime64_1) + xxhPrime64_4;
+        data += 8;
+        count -= 8;
+    }
+
+    if (count >= 4)
+    {
+        h ^= static_cast<uint64_t>(readLE32(data)) * xxhPrime64_1;
+        h = (rotl64(h, 23) * xxhPrime64_2) + xxhPrime64_3;
+        data += 4;
+        count -= 4;
+    }
+
+    while (count > 0)
+    {
+        h ^= (*data) * xxhPrime64_5;
+        h = rotl64(h, 11) * xxhPrime64_1;
+        ++data;
+        --count;
+    }
+
+    return xxh64Avalanche(h);
+}
+
+uint64_t xxh64MergeAccs(const uint64_t* acc)
+{
+    uint64_t h = rotl64(acc[0], 1) + rotl64(acc[1], 7) + rotl64(acc[2], 12) + rotl64(acc[3], 18);
+    for (size_t i = 0; i < 4; ++i) h = xxh64MergeRound(h, acc[i]);
+    return h;
+}
+
+// processes the largest multiple of 32 bytes, returns the number of processed bytes
+size_t xxh64Stripes(uint64_t* acc, const uint8_t* data, size_t count)
+{
+    const size_t n = count - (count % 32);
+
+    for (size_t i = 0; i < n; i += 32)
+    {
+        acc[0] = xxh64Round(acc[0], readLE64(data + i));
+        acc[1] = xxh64Round(acc[1], readLE64(data + i + 8));
+        acc[2] = xxh64Round(acc[2], readLE64(data + i + 16));
+        acc[3] = xxh64Round(acc[3], readLE64(data + i + 24));
+    }
+
+    return n;
+}
+
+void xxh64Init(uint64_t* acc, uint64_t seed)
+{
+    acc[0] = seed + xxhPrime64_1 + xxhPrime64_2;
+    acc[1] = seed + xxhPrime64_2;
+    acc[2] = seed;
+    acc[3] = seed - xxhPrime64_1;
+}
+
+
+
+// XXH3, see https://github.com/Cyan4973/xxHash/blob/dev/doc/xxhash_spec.md
+
+constexpr size_t xxh3StripeLen = 64;
+constexpr size_t xxh3SecretConsumeRate = 8;
+constexpr size_t xxh3SecretSize = 192;
+constexpr size_t xxh3StripesPerBlock = (xxh3SecretSize - xxh3StripeLen) / xxh3SecretConsumeRate;
+constexpr size_t xxh3BlockLen = xxh3StripeLen * xxh3StripesPerBlock;
+constexpr size_t xxh3MidSizeMax = 240;
+
+alignas(64) const uint8_t xxh3DefaultSecret[xxh3SecretSize] = {
+    0xB8, 0xFE, 0x6C, 0x39, 0x23, 0xA4, 0x4B, 0xBE, 0x7C, 0x01, 0x81, 0x2C, 0xF7, 0x21, 0xAD, 0x1C, 0xDE, 0xD4, 0x6D, 0xE9, 0x83, 0x90, 0x97, 0xDB,
+    0x72, 0x40, 0xA4, 0xA4, 0xB7, 0xB3, 0x67, 0x1F, 0xCB, 0x79, 0xE6, 0x4E, 0xCC, 0xC0, 0xE5, 0x78, 0x82, 0x5A, 0xD0, 0x7D, 0xCC, 0xFF, 0x72, 0x21,
+    0xB8, 0x08, 0x46, 0x74, 0xF7, 0x43, 0x24, 0x8E, 0xE0, 0x35, 0x90, 0xE6, 0x81, 0x3A, 0x26, 0x4C, 0x3C, 0x28, 0x52, 0xBB, 0x91, 0xC3, 0x00, 0xCB,
+    0x88, 0xD0, 0x65, 0x8B, 0x1B, 0x53, 0x2E, 0xA3, 0x71, 0x64, 0x48, 0x97, 0xA2, 0x0D, 0xF9, 0x4E, 0x38, 0x19, 0xEF, 0x46, 0xA9, 0xDE, 0xAC, 0xD8,
+    0xA8, 0xFA, 0x76, 0x3F, 0xE3, 0x9C, 0x34, 0x3F, 0xF9, 0xDC, 0xBB, 0xC7, 0xC7, 0x0B, 0x4F, 0x1D, 0x8A, 0x51, 0xE0, 0x4B, 0xCD, 0xB4, 0x59, 0x31,
+    0xC8, 0x9F, 0x7E, 0xC9, 0xD9, 0x78, 0x73, 0x64, 0xEA, 0xC5, 0xAC, 0x83, 0x34, 0xD3, 0xEB, 0xC3, 0xC5, 0x81, 0xA0, 0xFF, 0xFA, 0x13, 0x63, 0xEB,
+    0x17, 0x0D, 0xDD, 0x51, 0xB7, 0xF0, 0xDA, 0x49, 0xD3, 0x16, 0x55, 0x26, 0x29, 0xD4, 0x68, 0x9E, 0x2B, 0x16, 0xBE, 0x58, 0x7D, 0x47, 0xA1, 0xFC,
+    0x8F, 0xF8, 0xB8, 0xD1, 0x7A, 0xD0, 0x31, 0xCE, 0x45, 0xCB, 0x3A, 0x8F, 0x95, 0x16, 0x04, 0x28, 0xAF, 0xD7, 0xFB, 0xCA, 0xBB, 0x4B, 0x40, 0x7E,
 };
 
-#endif // ___OMWi_REGION_preview
+void xxh3InitSecret(uint8_t* secret, uint64_t seed)
+{
+    for (size_t i = 0; i < xxh3SecretSize; i += 16)
+    {
+        writeLE64(secret + i, readLE64(xxh3DefaultSecret + i) + seed);
+        writeLE64(secret + i + 8, readLE64(xxh3DefaultSecret + i + 8) - seed);
+    }
+}
+
+void xxh3InitAcc(uint64_t* acc)
+{
+    acc[0] = xxhPrime32_3;
+    acc[1] = xxhPrime64_1;
+    acc[2] = xxhPrime64_2;
+    acc[3] = xxhPrime64_3;
+    acc[4] = xxhPrime64_4;
+    acc[5] = xxhPrime32_2;
+    acc[6] = xxhPrime64_5;
+    acc[7] = xxhPrime32_1;
+}
+
+uint64_t xxh3Avalanche(uint64_t h)
+{
+    h ^= h >> 37;
+    h *= xxhPrimeMx1;
+    h ^= h >> 32;
+    return h;
+}
+
+uint64_t xxh3Rrmxmx(uint64_t h, uint64_t len)
+{
+    h ^= rotl64(h, 49) ^ rotl64(h, 24);
+    h *= xxhPrimeMx2;
+    h ^= (h >> 35) + len;
+    h *= xxhPrimeMx2;
+    return (h ^ (h >> 28));
+}
+
+uint64_t xxh3Mix16(const uint8_t* data, const uint8_t* secret, uint64_t seed)
+{
+    return mul128Fold64(readLE64(data) ^ (readLE64(secret) + seed), readLE64(data + 8) ^ (readLE64(secret + 8) - seed));
+}
+
+uint64_t xxh3Len0to16(const uint8_t* data, size_t count, const uint8_t* secret, uint64_t seed)
+{
+    if (count > 8)
+    {
+        const uint64_t bitflip1 = (readLE64(secret + 24) ^ readLE64(secret + 32)) + seed;
+        const uint64_t bitflip2 = (readLE64(secret + 40) ^ readLE64(secret + 48)) - seed;
+        const uint64_t lo = readLE64(data) ^ bitflip1;
+        const uint64_t hi = readLE64(data + count - 8) ^ bitflip2;
+        return xxh3Avalanche(count + swap64(lo) + hi + mul128Fold64(lo, hi));
+    }
+
+    if (count >= 4)
+    {
+        seed ^= static_cast<uint64_t>(swap32(static_cast<uint32_t>(seed))) << 32;
+        const uint64_t bitflip = (readLE64(secret + 8) ^ readLE64(secret + 16)) - seed;
+        const uint64_t input = readLE32(data + count - 4) + (static_cast<uint64_t>(readLE32(data)) << 32);
+        return xxh3Rrmxmx(input ^ bitflip, count);
+    }
 
+    if (count > 0)
+    {
+        const uint32_t combined = (static_cast<uint32_t>(data[0]) << 16) | (static_cast<uint32_t>(data[count >> 1]) << 24) |
+                                  static_cast<uint32_t>(data[count - 1]) | (static_cast<uint32_t>(count) << 8);
+        const uint64_t bitflip = (readLE32(secret) ^ readLE32(secret + 4)) + seed;
+        return xxh64Avalanche(combined ^ bitflip);
+    }
+
+    return xxh64Avalanche(seed ^ readLE64(secret + 56) ^ readLE64(secret + 64));
+}
+
+uint64_t xxh3Len17to128(const uint8_t* data, size_t count, const uint8_t* secret, uint64_t seed)
+{
+    uint64_t acc = count * xxhPrime64_1;
+
+    if (count > 32)
+    {
+        if (count > 64)
+        {
+            if (count > 96)
+            {
+                acc += xxh3Mix16(data + 48, secret + 96, seed);
+                acc += xxh3Mix16(data + count - 64, secret + 112, seed);
+            }
+
+            acc += xxh3Mix16(data + 32, secret + 64, seed);
+            acc += xxh3Mix16(data + count - 48, secret + 80, seed);
+        }
+
+        acc += xxh3Mix16(data + 16, secret + 32, seed);
+        acc += xxh3Mix16(data + count - 32, secret + 48, seed);
+    }
+
+    acc += xxh3Mix16(data, secret, seed);
+    acc += xxh3Mix16(data + count - 16, secret + 16, seed);
+
+    return xxh3Avalanche(acc);
+}
+
+uint64_t xxh3Len129to240(const uint8_t* data, size_t count, const uint8_t* secret, uint64_t seed)
+{
+    uint64_t acc = count * xxhPrime64_1;
+    const size_t rounds = count / 16;
+
+    for (size_t i = 0; i < 8; ++i) acc += xxh3Mix16(data + (16 * i), secret + (16 * i), seed);
+    acc = xxh3Avalanche(acc);
+
+    uint64_t accEnd = xxh3Mix16(data + count - 16, secret + 136 - 17, seed);
+    for (size_t i = 8; i < rounds; ++i) accEnd += xxh3Mix16(data + (16 * i), secret + (16 * (i - 8)) + 3, seed);
+
+    return xxh3Avalanche(acc + accEnd);
+}
+
+uint64_t xxh3Short(const uint8_t* data, size_t count, uint64_t seed)
+{
+    if (count <= 16) return xxh3Len0to16(data, count, xxh3DefaultSecret, seed);
+    if (count <= 128) return xxh3Len17to128(data, count, xxh3DefaultSecret, seed);
+    return xxh3Len129to240(data, count, xxh3DefaultSecret, seed);
+}
+
+// accumulates `stripes` stripes, the secret advances by 8 bytes per stripe
+using xxh3_accumulate_t = void (*)(uint64_t* acc, const uint8_t* data, const uint8_t* secret, size_t stripes);
+using xxh3_scramble_t = void (*)(uint64_t* acc, const uint8_t* secret);
+
+void xxh3Accumulate512_scalar(uint64_t* acc, const uint8_t* data, const uint8_t* secret)
+{
+    for (size_t i = 0; i < 8; ++i)
+    {
+        const uint64_t value = readLE64(data + (8 * i));
+        const uint64_t key = value ^ readLE64(secret + (8 * i));
+        acc[i ^ 1] += value;
+        acc[i] += (key & 0xFFFFFFFF) * (key >> 32);
+    }
+}
+
+#ifdef OMWi_X86_DISPATCH
+
+// SSE2 is part of x86-64, no runtime check needed
+void xxh3Accumulate_sse2(uint64_t* acc, const uint8_t* data, const uint8_t* secret, size_t stripes)
+{
+    __m128i a[4];
+    for (size_t i = 0; i < 4; ++i) a[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(acc) + i);
+
+    for (size_t n = 0; n < stripes; ++n)
+    {
+        const uint8_t* const d = data + (n * xxh3StripeLen);
+        const uint8_t* const s = secret + (n * xxh3SecretConsumeRate);
+
+        for (size_t i = 0; i < 4; ++i)
+        {
+            const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(d) + i);
+            const __m128i key = _mm_xor_si128(value, _mm_loadu_si128(reinterpret_cast<const __m128i*>(s) + i));
+            const __m128i product = _mm_mul_epu32(key, _mm_shuffle_epi32(key, _MM_SHUFFLE(0, 3, 0, 1)));
+            a[i] = _mm_add_epi64(_mm_add_epi64(a[i], _mm_shuffle_epi32(value, _MM_SHUFFLE(1, 0, 3, 2))), product);
+        }
+    }
+
+    for (size_t i = 0; i < 4; ++i) _mm_storeu_si128(reinterpret_cast<__m128i*>(acc) + i, a[i]);
+}
+
+void xxh3Scramble_sse2(uint64_t* acc, const uint8_t* secret)
+{
+    const __m128i prime = _mm_set1_epi32(static_cast<int>(xxhPrime32_1));
+
+    for (size_t i = 0; i < 4; ++i)
+    {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(acc) + i);
+        a = _mm_xor_si128(a, _mm_srli_epi64(a, 47));
+        a = _mm_xor_si128(a, _mm_loadu_si128(reinterpret_cast<const __m128i*>(secret) + i));
+
+        const __m128i lo = _mm_mul_epu32(a, prime);
+        const __m128i hi = _mm_mul_epu32(_mm_shuffle_epi32(a, _MM_SHUFFLE(0, 3, 0, 1)), prime);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(acc) + i, _mm_add_epi64(lo, _mm_slli_epi64(hi, 32)));
+    }
+}
+
+OMWi_TARGET("avx2") void xxh3Accumulate_avx2(uint64_t* acc, const uint8_t* data, const uint8_t* secret, size_t stripes)
+{
+    __m256i a0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(acc));
+    __m256i a1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(acc) + 1);
+
+    for (size_t n = 0; n < stripes; ++n)
+    {
+        const __m256i* const d = reinterpret_cast<const __m256i*>(data + (n * xxh3StripeLen));
+        const __m256i* const s = reinterpret_cast<const __m256i*>(secret + (n * xxh3SecretConsumeRate));
+
+        const __m256i v0 = _mm256_loadu_si256(d);
+        const __m256i v1 = _mm256_loadu_si256(d + 1);
+        const __m256i k0 = _mm256_xor_si256(v0, _mm256_loadu_si256(s));
+        const __m256i k1 = _mm256_xor_si256(v1, _mm256_loadu_si256(s + 1));
+
+        a0 = _mm256_add_epi64(_mm256_add_epi64(a0, _mm256_shuffle_epi32(v0, _MM_SHUFFLE(1, 0, 3, 2))),
+                              _mm256_mul_epu32(k0, _mm256_shuffle_epi32(k0, _MM_SHUFFLE(0, 3, 0, 1))));
+        a1 = _mm256_add_epi64(_mm256_add_epi64(a1, _mm256_shuffle_epi32(v1, _MM_SHUFFLE(1, 0, 3, 2))),
+                              _mm256_mul_epu32(k1, _mm256_shuffle_epi32(k1, _MM_SHUFFLE(0, 3, 0, 1))));
+    }
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(acc), a0);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(acc) + 1, a1);
+    _mm256_zeroupper();
+}
+
+#else // OMWi_X86_DISPATCH
+
+void xxh3Accumulate_scalar(uint64_t* acc, const uint8_t* data, const uint8_t* secret, size_t stripes)
+{
+    for (size_t n = 0; n < stripes; ++n) xxh3Accumulate512_scalar(acc, data + (n * xxh3StripeLen), secret + (n * xxh3SecretConsumeRate));
+}
+
+void xxh3Scramble_scalar(uint64_t* acc, const uint8_t* secret)
+{
+    for (size_t i = 0; i < 8; ++i)
+    {
+        uint64_t a = acc[i];
+        a ^= a >> 47;
+        a ^= readLE64(secret + (8 * i));
+        acc[i] = a * xxhPrime32_1;
+    }
+}
+
+#endif // OMWi_X86_DISPATCH
+
+xxh3_accumulate_t xxh3Accumulate()
+{
+#ifdef OMWi_X86_DISPATCH
+    static const xxh3_accumulate_t fn = (omw::internal::cpu::hasAvx2() ? xxh3Accumulate_avx2 : xxh3Accumulate_sse2);
+#else
+    static const xxh3_accumulate_t fn = xxh3Accumulate_scalar;
+#endif
+
+    return fn;
+}
+
+xxh3_scramble_t xxh3Scramble()
+{
+#ifdef OMWi_X86_DISPATCH
+    return xxh3Scramble_sse2;
+#else
+    return xxh3Scramble_scalar;
+#endif
+}
+
+// processes `stripes` stripes where `stripesSoFar` stripes of the current block have already been processed
+void xxh3ConsumeStripes(uint64_t* acc, size_t& stripesSoFar, const uint8_t* data, size_t stripes, const uint8_t* secret)
+{
+    const xxh3_accumulate_t accumulate = xxh3Accumulate();
+    const xxh3_scramble_t scramble = xxh3Scramble();
+
+    const uint8_t* blockSecret = secret + (stripesSoFar * xxh3SecretConsumeRate);
+    size_t n = xxh3StripesPerBlock - stripesSoFar;
+
+    if (stripes >= n)
+    {
+        do
+        {
+            accumulate(acc, data, blockSecret, n);
+            scramble(acc, secret + xxh3SecretSize - xxh3StripeLen);
+            data += n * xxh3StripeLen;
+            stripes -= n;
+            n = xxh3StripesPerBlock;
+            blockSecret = secret;
+        }
+        while (stripes >= xxh3StripesPerBlock);
+
+        stripesSoFar = 0;
+    }
+
+    if (stripes > 0)
+    {
+        accumulate(acc, data, blockSecret, stripes);
+        stripesSoFar += stripes;
+    }
+}
+
+uint64_t xxh3MergeAccs(const uint64_t* acc, const uint8_t* secret, uint64_t start)
+{
+    uint64_t r = start;
+    for (size_t i = 0; i < 4; ++i) r += mul128Fold64(acc[2 * i] ^ readLE64(secret + (16 * i)), acc[(2 * i) + 1] ^ readLE64(secret + (16 * i) + 8));
+    return xxh3Avalanche(r);
+}
+
+uint64_t xxh3Long(const uint8_t* data, size_t count, const uint8_t* secret)
+{
+    alignas(32) uint64_t acc[8];
+    xxh3InitAcc(acc);
+
+    const size_t blocks = (count - 1) / xxh3BlockLen;
+
+    for (size_t n = 0; n < blocks; ++n)
+    {
+        xxh3Accumulate()(acc, data + (n * xxh3BlockLen), secret, xxh3StripesPerBlock);
+        xxh3Scramble()(acc, secret + xxh3SecretSize - xxh3StripeLen);
+    }
+
+    const size_t stripes = ((count - 1) - (xxh3BlockLen * blocks)) / xxh3StripeLen;
+    xxh3Accumulate()(acc, data + (blocks * xxh3BlockLen), secret, stripes);
+
+    // last stripe
+    xxh3Accumulate512_scalar(acc, data + count - xxh3StripeLen, secret + xxh3SecretSize - xxh3StripeLen - 7);
+
+    return xxh3MergeAccs(acc, secret + 11, count * xxhPrime64_1);
+}
+
+} // namespace
+
+
+
+/*!
+ * \class omw::Crc
+ *
+ * `#include <omw/checksum.h>`
+ *
+ * _since C++14_
+ *
+ * Table driven CRC engine. The template parameter `P` has to provide `static constexpr omw::CrcParameter<UI> parameter()`, where `UI` is one
+ * of `uint8_t`, `uint16_t`, `uint32_t` or `uint64_t` and determines the width of the CRC. See `omw::crc16::Kermit` as an example.
+ *
+ * The tables are generated at compile time. `omw::Crc::calc()` uses slicing-by-8 (8 bytes per iteration), `omw::Crc::calcBytewise()` is
+ * the classic byte wise implementation.
+ *
+ * On x86-64 `omw::Crc<omw::crc32::Castagnoli>` and `omw::Crc<omw::crc32::Ieee>` use the SSE4.2 `crc32` and the `PCLMULQDQ` instructions
+ * if the CPU supports them (detected at runtime). The results are identical to the table engine.
+ *
+ * The register level functions allow to process data in multiple chunks:
+ * ```
+ * using crc_t = omw::Crc<omw::crc32::Ieee>;
+ * crc_t::value_type crc = crc_t::begin();
+ * crc = crc_t::update(crc, data, count);
+ * crc = crc_t::update(crc, moreData, moreCount);
+ * crc = crc_t::finalize(crc);
+ * ```
+ */
+
+#if (OMW_CPPSTD >= OMW_CPPSTD_14)
+
+//!
+//! Uses the `PCLMULQDQ` instruction if supported by the CPU, otherwise `omw::Crc::updateSlicing()`.
+//!
+template <> uint32_t omw::Crc<omw::crc32::Ieee>::update(uint32_t crc, const uint8_t* data, size_t count)
+{
+#ifdef OMWi_X86_DISPATCH
+    static const bool clmul = omw::internal::cpu::hasPclmul();
+
+    if (clmul && (count >= 64))
+    {
+        const size_t n = count & ~static_cast<size_t>(0x0F);
+        crc = ::crc32_clmul(crc, data, n);
+        data += n;
+        count -= n;
+    }
+#endif
+
+    return updateSlicing(crc, data, count);
+}
+
+//!
+//! Uses the SSE4.2 `crc32` instruction if supported by the CPU, otherwise `omw::Crc::updateSlicing()`.
+//!
+template <> uint32_t omw::Crc<omw::crc32::Castagnoli>::update(uint32_t crc, const uint8_t* data, size_t count)
+{
+#ifdef OMWi_X86_DISPATCH
+    static const bool sse42 = omw::internal::cpu::hasSse42();
+    if (sse42) return ::crc32c_sse42(crc, data, count);
+#endif
+
+    return updateSlicing(crc, data, count);
+}
+
+#endif // C++14
+
+
+
+/*!
+ * \class omw::CrcState
+ *
+ * `#include <omw/checksum.h>`
+ *
+ * _since C++14_
+ *
+ * Streaming CRC calculation, for data which arrives in chunks (e.g. from `omw::io::SerialPort::read()`). The template parameter is the same as
+ * for `omw::Crc`.
+ *
+ * ```
+ * omw::CrcState<omw::crc16::Kermit> state;
+ * state.update(data, count);
+ * state.update(moreData, moreCount);
+ * const uint16_t crc = state.finalize();
+ * ```
+ *
+ * `finalize()` does not alter the state, more data can be appended afterwards.
+ *
+ * CRCs of consecutive blocks can be merged with `combine()` (or `append()` on states), which allows to calculate the CRC of large data in
+ * parallel chunks. `combine()` takes the final CRCs of the two blocks and the length of the second block, it works in `O(log(lengthB))` using
+ * GF(2) matrices (the same algorithm as zlib's `crc32_combine()`).
+ *
+ * \b Exceptions
+ * - `update(const std::vector<uint8_t>&, ...)`: `std::invalid_argument` if count is greater than `data.size() - pos` or if `pos` is greater than
+ *   `data.size()`
+ */
+
+/*!
+ * \fn omw::crcParallel(const uint8_t* data, size_t count, unsigned threads)
+ *
+ * `#include <omw/checksumParallel.h>`
+ *
+ * _since C++14_
+ *
+ * Calculates the CRC of a large buffer on multiple threads. The buffer is split into one contiguous chunk per thread, the partial CRCs are
+ * merged with `omw::CrcState::append()`. The result is identical to `omw::Crc::calc()`.
+ *
+ * @param threads Number of worker threads, `0` to use `std::thread::hardware_concurrency()`
+ *
+ * Buffers smaller than 2MiB are processed by the calling thread. The function is header only, the program using it has to link the threads
+ * library (e.g. `Threads::Threads` or `-pthread`), the omw library targets don't.
+ *
+ * ```
+ * const uint32_t crc = omw::crcParallel<omw::crc32::Ieee>(data, count);
+ * ```
+ */
+
+/*!
+ * \fn omw::crcParallel(const omw::io::BinFileInterface& file, unsigned threads)
+ *
+ * `#include <omw/checksumParallel.h>`
+ *
+ * _since C++14_
+ *
+ * Calculates the CRC of a file on multiple threads. Every worker opens the file with it's own stream and reads it's part in 1MiB blocks, the
+ * file interface itself doesn't have to be opened. The result is identical to the CRC over the whole file content.
+ *
+ * @param threads Number of worker threads, `0` to use `std::thread::hardware_concurrency()`
+ *
+ * \b Exceptions
+ * - `std::ios::failure` if the file can not be opened or read
+ * - `std::runtime_error` if the evaluated file size (`std::streampos`) was negative
+ */
+
+/*!
+ * \namespace omw::crc8
+ *
+ * `#include <omw/checksum.h>`
+ *
+ * 8-bit CRC algorithms, see \ref ns_omw_crc_section_fn.
+ */
+
+/*!
+ * \namespace omw::crc16
+ *
+ * `#include <omw/checksum.h>`
+ *
+ * 16-bit CRC algorithms, see \ref ns_omw_crc_section_fn.
+ */
+
+/*!
+ * \namespace omw::crc32
+ *
+ * `#include <omw/checksum.h>`
+ *
+ * 32-bit CRC algorithms, see \ref ns_omw_crc_section_fn.
+ */
+
+/*!
+ * \namespace omw::crc64
+ *
+ * `#include <omw/checksum.h>`
+ *
+ * 64-bit CRC algorithms, see \ref ns_omw_crc_section_fn.
+ *
+ * \section ns_omw_crc_section_fn CRC Functions
+ *
+ * Calculate the CRC using `omw::Crc` (slicing-by-8) with the parameters of the algorithm.
+ * With C++11 the same slicing-by-8 engine is used, but the tables are generated at runtime on the first call and there is no hardware
+ * acceleration for CRC-32.
+ *
+ * The CRC of no data equals the initial value of the algorithm (after the output XOR is applied).
+ *
+ * The vector overloads throw `std::invalid_argument` if count is greater than `data.size() - pos` or if `pos` is greater than `data.size()`.
+ */
+
+uint8_t omw::crc8::smbus(const uint8_t* data, size_t count) { return ::CrcEngine<omw::crc8::Smbus>::calc(data, count); }
+uint8_t omw::crc8::smbus(const std::vector<uint8_t>& data, std::vector<uint8_t>::size_type pos, std::vector<uint8_t>::size_type count)
+{
+    return ::crc_vector<omw::crc8::Smbus>(data, pos, count, "omw::crc8::smbus");
+}
+
+uint16_t omw::crc16::kermit(const uint8_t* data, size_t count) { return ::CrcEngine<omw::crc16::Kermit>::calc(data, count); }
+uint16_t omw::crc16::kermit(const std::vector<uint8_t>& data, std::vector<uint8_t>::size_type pos, std::vector<uint8_t>::size_type count)
+{
+    return ::crc_vector<omw::crc16::Kermit>(data, pos, count, "omw::crc16::kermit");
+}
+
+uint16_t omw::crc16::modbus(const uint8_t* data, size_t count) { return ::CrcEngine<omw::crc16::Modbus>::calc(data, count); }
+uint16_t omw::crc16::modbus(const std::vector<uint8_t>& data, std::vector<uint8_t>::size_type pos, std::vector<uint8_t>::size_type count)
+{
+    return ::crc_vector<omw::crc16::Modbus>(data, pos, count, "omw::crc16::modbus");
+}
+
+uint32_t omw::crc32::ieee(const uint8_t* data, size_t count) { return ::CrcEngine<omw::crc32::Ieee>::calc(data, count); }
+uint32_t omw::crc32::ieee(const std::vector<uint8_t>& data, std::vector<uint8_t>::size_type pos, std::vector<uint8_t>::size_type count)
+{
+    return ::crc_vector<omw::crc32::Ieee>(data, pos, count, "omw::crc32::ieee");
+}
+
+uint32_t omw::crc32::castagnoli(const uint8_t* data, size_t count) { return ::CrcEngine<omw::crc32::Castagnoli>::calc(data, count); }
+uint32_t omw::crc32::castagnoli(const std::vector<uint8_t>& data, std::vector<uint8_t>::size_type pos, std::vector<uint8_t>::size_type count)
+{
+    return ::crc_vector<omw::crc32::Castagnoli>(data, pos, count, "omw::crc32::castagnoli");
+}
+
+uint64_t omw::crc64::ecma(const uint8_t* data, size_t count) { return ::CrcEngine<omw::crc64::Ecma>::calc(data, count); }
+uint64_t omw::crc64::ecma(const std::vector<uint8_t>& data, std::vector<uint8_t>::size_type pos, std::vector<uint8_t>::size_type count)
+{
+    return ::crc_vector<omw::crc64::Ecma>(data, pos, count, "omw::crc64::ecma");
+}
+
+uint64_t omw::crc64::xz(const uint8_t* data, size_t count) { return ::CrcEngine<omw::crc64::Xz>::calc(data, count); }
+uint64_t omw::crc64::xz(const std::vector<uint8_t>& data, std::vector<uint8_t>::size_type pos, std::vector<uint8_t>::size_type count)
+{
+    return ::crc_vector<omw::crc64::Xz>(data, pos, count, "omw::crc64::xz");
+}
+
+
+
+//!
+//! Calculates a XOR checksum.
+//!
+//! The parity word of no data equals `0`.
+//!
+//! The buffer is XOR reduced in wide registers (AVX2 if supported by the CPU, SSE2 or 64-bit words otherwise).
+//!
+uint8_t omw::parityWord(const uint8_t* data, size_t count)
+{
+    uint8_t lanes[::parityLanes];
+    ::parityLanesOf(data, count, lanes);
+
+    uint8_t r = 0;
+    for (size_t i = 0; i < ::parityLanes; ++i) r ^= lanes[i];
+
+    return r;
+}
+
+//!
+//! Calculates a XOR checksum.
+//!
+//! The parity word of no data equals `0`.
+//!
+//! \b Exceptions
+//! - `std::invalid_argument` if count is greater than `data.size() - pos` or if `pos` is greater than `data.size()`
+//!
+uint8_t omw::parityWord(const std::vector<uint8_t>& data, std::vector<uint8_t>::size_type pos, std::vector<uint8_t>::size_type count)
+{
+    if (((data.size() - pos) < count) || (pos > data.size())) throw std::invalid_argument("omw::parityWord");
+    return omw::parityWord(data.data() + pos, count);
+}
+
+//!
+//! Calculates a 16-bit XOR checksum over big endian words. If `count` is odd, the last word is padded with a `0x00` byte.
+//!
+//! The parity word of no data equals `0`.
+//!
+uint16_t omw::parityWord16(const uint8_t* data, size_t count)
+{
+    uint8_t lanes[::parityLanes];
+    ::parityLanesOf(data, count, lanes);
+
+    uint8_t hi = 0, lo = 0;
+    for (size_t i = 0; i < ::parityLanes; i += 2)
+    {
+        hi ^= lanes[i];
+        lo ^= lanes[i + 1];
+    }
+
+    return static_cast<uint16_t>((static_cast<uint16_t>(hi) << 8) | lo);
+}
+
+//!
+//! Calculates a 16-bit XOR checksum over big endian words. If `count` is odd, the last word is padded with a `0x00` byte.
+//!
+//! The parity word of no data equals `0`.
+//!
+//! \b Exceptions
+//! - `std::invalid_argument` if count is greater than `data.size() - pos` or if `pos` is greater than `data.size()`
+//!
+uint16_t omw::parityWord16(const std::vector<uint8_t>& data, std::vector<uint8_t>::size_type pos, std::vector<uint8_t>::size_type count)
+{
+    if (((data.size() - pos) < count) || (pos > data.size())) throw std::invalid_argument("omw::parityWord16");
+    return omw::parityWord16(data.data() + pos, count);
+}
+
+//!
+//! Calculates a 32-bit XOR checksum over big endian words. If `count` is not a multiple of 4, the last word is padded with `0x00` bytes.
+//!
+//! The parity word of no data equals `0`.
+//!
+uint32_t omw::parityWord32(const uint8_t* data, size_t count)
+{
+    uint8_t lanes[::parityLanes];
+    ::parityLanesOf(data, count, lanes);
+
+    uint32_t r = 0;
+    for (size_t i = 0; i < ::parityLanes; ++i) r ^= (static_cast<uint32_t>(lanes[i]) << (8 * (3 - (i % 4))));
+
+    return r;
+}
+
+//!
+//! Calculates a 32-bit XOR checksum over big endian words. If `count` is not a multiple of 4, the last word is padded with `0x00` bytes.
+//!
+//! The parity word of no data equals `0`.
+//!
+//! \b Exceptions
+//! - `std::invalid_argument` if count is greater than `data.size() - pos` or if `pos` is greater than `data.size()`
+//!
+uint32_t omw::parityWord32(const std::vector<uint8_t>& data, std::vector<uint8_t>::size_type pos, std::vector<uint8_t>::size_type count)
+{
+    if (((data.size() - pos) < count) || (pos > data.size())) throw std::invalid_argument("omw::parityWord32");
+    return omw::parityWord32(data.data() + pos, count);
 }
 
 
 
-#ifdef OMWi_CHECKSUM_CRC_PREVIEW
+//!
+//! Calculates the Adler-32 checksum (RFC 1950).
+//!
+uint32_t omw::adler32(const uint8_t* data, size_t count)
+{
+    omw::Adler32State state;
+    state.update(data, count);
+    return state.finalize();
+}
 
-const uint16_t omw::crc16::tableKermit[omw::crc16::tableSize] = {
-    0x0000, 0x1189, 0x2312, 0x329B, 0x4624, 0x57AD, 0x6536, 0x74BF, 0x8C48, 0x9DC1, 0xAF5A, 0xBED3, 0xCA6C, 0xDBE5, 0xE97E, 0xF8F7, 0x1081, 0x0108, 0x3393,
-    0x221A, 0x56A5, 0x472C, 0x75B7, 0x643E, 0x9CC9, 0x8D40, 0xBFDB, 0xAE52, 0xDAED, 0xCB64, 0xF9FF, 0xE876, 0x2102, 0x308B, 0x0210, 0x1399, 0x6726, 0x76AF,
-    0x4434, 0x55BD, 0xAD4A, 0xBCC3, 0x8E58, 0x9FD1, 0xEB6E, 0xFAE7, 0xC87C, 0xD9F5, 0x3183, 0x200A, 0x1291, 0x0318, 0x77A7, 0x662E, 0x54B5, 0x453C, 0xBDCB,
-    0xAC42, 0x9ED9, 0x8F50, 0xFBEF, 0xEA66, 0xD8FD, 0xC974, 0x4204, 0x538D, 0x6116, 0x709F, 0x0420, 0x15A9, 0x2732, 0x36BB, 0xCE4C, 0xDFC5, 0xED5E, 0xFCD7,
-    0x8868, 0x99E1, 0xAB7A, 0xBAF3, 0x5285, 0x430C, 0x7197, 0x601E, 0x14A1, 0x0528, 0x37B3, 0x263A, 0xDECD, 0xCF44, 0xFDDF, 0xEC56, 0x98E9, 0x8960, 0xBBFB,
-    0xAA72, 0x6306, 0x728F, 0x4014, 0x519D, 0x2522, 0x34AB, 0x0630, 0x17B9, 0xEF4E, 0xFEC7, 0xCC5C, 0xDDD5, 0xA96A, 0xB8E3, 0x8A78, 0x9BF1, 0x7387, 0x620E,
-    0x5095, 0x411C, 0x35A3, 0x242A, 0x16B1, 0x0738, 0xFFCF, 0xEE46, 0xDCDD, 0xCD54, 0xB9EB, 0xA862, 0x9AF9, 0x8B70, 0x8408, 0x9581, 0xA71A, 0xB693, 0xC22C,
-    0xD3A5, 0xE13E, 0xF0B7, 0x0840, 0x19C9, 0x2B52, 0x3ADB, 0x4E64, 0x5FED, 0x6D76, 0x7CFF, 0x9489, 0x8500, 0xB79B, 0xA612, 0xD2AD, 0xC324, 0xF1BF, 0xE036,
-    0x18C1, 0x0948, 0x3BD3, 0x2A5A, 0x5EE5, 0x4F6C, 0x7DF7, 0x6C7E, 0xA50A, 0xB483, 0x8618, 0x9791, 0xE32E, 0xF2A7, 0xC03C, 0xD1B5, 0x2942, 0x38CB, 0x0A50,
-    0x1BD9, 0x6F66, 0x7EEF, 0x4C74, 0x5DFD, 0xB58B, 0xA402, 0x9699, 0x8710, 0xF3AF, 0xE226, 0xD0BD, 0xC134, 0x39C3, 0x284A, 0x1AD1, 0x0B58, 0x7FE7, 0x6E6E,
-    0x5CF5, 0x4D7C, 0xC60C, 0xD785, 0xE51E, 0xF497, 0x8028, 0x91A1, 0xA33A, 0xB2B3, 0x4A44, 0x5BCD, 0x6956, 0x78DF, 0x0C60, 0x1DE9, 0x2F72, 0x3EFB, 0xD68D,
-    0xC704, 0xF59F, 0xE416, 0x90A9, 0x8120, 0xB3BB, 0xA232, 0x5AC5, 0x4B4C, 0x79D7, 0x685E, 0x1CE1, 0x0D68, 0x3FF3, 0x2E7A, 0xE70E, 0xF687, 0xC41C, 0xD595,
-    0xA12A, 0xB0A3, 0x8238, 0x93B1, 0x6B46, 0x7ACF, 0x4854, 0x59DD, 0x2D62, 0x3CEB, 0x0E70, 0x1FF9, 0xF78F, 0xE606, 0xD49D, 0xC514, 0xB1AB, 0xA022, 0x92B9,
-    0x8330, 0x7BC7, 0x6A4E, 0x58D5, 0x495C, 0x3DE3, 0x2C6A, 0x1EF1, 0x0F78
-};
+//!
+//! Calculates the Adler-32 checksum (RFC 1950).
+//!
+//! \b Exceptions
+//! - `std::invalid_argument` if count is greater than `data.size() - pos` or if `pos` is greater than `data.size()`
+//!
+uint32_t omw::adler32(const std::vector<uint8_t>& data, std::vector<uint8_t>::size_type pos, std::vector<uint8_t>::size_type count)
+{
+    if (((data.size() - pos) < count) || (pos > data.size())) throw std::invalid_argument("omw::adler32");
+    return omw::adler32(data.data() + pos, count);
+}
 
-uint16_t omw::crc16::kermit(const uint8_t* data, size_t count)
+//!
+//! Calculates the Fletcher-16 checksum over bytes (modulo 255, both sums start at `0`). The result is `(sum2 << 8) | sum1`.
+//!
+uint16_t omw::fletcher16(const uint8_t* data, size_t count)
 {
-    uint16_t crc = 0;
+    omw::Fletcher16State state;
+    state.update(data, count);
+    return state.finalize();
+}
 
-    if (data)
-    {
-        for (size_t i = 0; i < count; ++i) { crc = (crc >> 8) ^ omw::crc16::tableKermit[(crc ^ data[i]) & 0xff]; }
-    }
+//!
+//! Calculates the Fletcher-16 checksum over bytes (modulo 255, both sums start at `0`). The result is `(sum2 << 8) | sum1`.
+//!
+//! \b Exceptions
+//! - `std::invalid_argument` if count is greater than `data.size() - pos` or if `pos` is greater than `data.size()`
+//!
+uint16_t omw::fletcher16(const std::vector<uint8_t>& data, std::vector<uint8_t>::size_type pos, std::vector<uint8_t>::size_type count)
+{
+    if (((data.size() - pos) < count) || (pos > data.size())) throw std::invalid_argument("omw::fletcher16");
+    return omw::fletcher16(data.data() + pos, count);
+}
 
-    return crc;
+//!
+//! Calculates the Fletcher-32 checksum over little endian 16-bit words (modulo 65535, both sums start at `0`). If `count` is odd, the last
+//! word is padded with a `0x00` byte. The result is `(sum2 << 16) | sum1`.
+//!
+uint32_t omw::fletcher32(const uint8_t* data, size_t count)
+{
+    omw::Fletcher32State state;
+    state.update(data, count);
+    return state.finalize();
 }
 
-uint16_t omw::crc16::kermit(const std::vector<uint8_t>& data, std::vector<uint8_t>::size_type pos, std::vector<uint8_t>::size_type count) { return uint16_t(); }
+//!
+//! Calculates the Fletcher-32 checksum over little endian 16-bit words (modulo 65535, both sums start at `0`). If `count` is odd, the last
+//! word is padded with a `0x00` byte. The result is `(sum2 << 16) | sum1`.
+//!
+//! \b Exceptions
+//! - `std::invalid_argument` if count is greater than `data.size() - pos` or if `pos` is greater than `data.size()`
+//!
+uint32_t omw::fletcher32(const std::vector<uint8_t>& data, std::vector<uint8_t>::size_type pos, std::vector<uint8_t>::size_type count)
+{
+    if (((data.size() - pos) < count) || (pos > data.size())) throw std::invalid_argument("omw::fletcher32");
+    return omw::fletcher32(data.data() + pos, count);
+}
 
-#endif // OMWi_CHECKSUM_CRC_PREVIEW
+//!
+//! Calculates the 32-bit FNV-1a hash.
+//!
+//! Since C++14 there are also `constexpr` overloads for strings, which allow to hash at compile time:
+//! ```
+//! switch (omw::fnv1a32(cmd.c_str()))
+//! {
+//! case omw::fnv1a32("start"):
+//!     break;
+//! }
+//! ```
+//!
+uint32_t omw::fnv1a32(const uint8_t* data, size_t count)
+{
+    omw::Fnv1a32State state;
+    state.update(data, count);
+    return state.finalize();
+}
 
+//!
+//! Calculates the 32-bit FNV-1a hash.
+//!
+//! \b Exceptions
+//! - `std::invalid_argument` if count is greater than `data.size() - pos` or if `pos` is greater than `data.size()`
+//!
+uint32_t omw::fnv1a32(const std::vector<uint8_t>& data, std::vector<uint8_t>::size_type pos, std::vector<uint8_t>::size_type count)
+{
+    if (((data.size() - pos) < count) || (pos > data.size())) throw std::invalid_argument("omw::fnv1a32");
+    return omw::fnv1a32(data.data() + pos, count);
+}
 
+//!
+//! Calculates the 64-bit FNV-1a hash. See also `omw::fnv1a32()`.
+//!
+uint64_t omw::fnv1a64(const uint8_t* data, size_t count)
+{
+    omw::Fnv1a64State state;
+    state.update(data, count);
+    return state.finalize();
+}
 
 //!
-//! Calculates a XOR checksum.
+//! Calculates the 64-bit FNV-1a hash.
 //!
-//! The parity word of no data equals `0`.
+//! \b Exceptions
+//! - `std::invalid_argument` if count is greater than `data.size() - pos` or if `pos` is greater than `data.size()`
 //!
-uint8_t omw::parityWord(const uint8_t* data, size_t count)
+uint64_t omw::fnv1a64(const std::vector<uint8_t>& data, std::vector<uint8_t>::size_type pos, std::vector<uint8_t>::size_type count)
 {
-    uint8_t r = 0;
+    if (((data.size() - pos) < count) || (pos > data.size())) throw std::invalid_argument("omw::fnv1a64");
+    return omw::fnv1a64(data.data() + pos, count);
+}
 
-    if (data)
+//!
+//! Calculates the XXH64 hash, compatible with the reference implementation (https://github.com/Cyan4973/xxHash).
+//!
+uint64_t omw::xxh64(const uint8_t* data, size_t count, uint64_t seed)
+{
+    if (!data) count = 0;
+
+    uint64_t h;
+    size_t i = 0;
+
+    if (count >= 32)
     {
-        while (count--) { r ^= data[count]; }
+        uint64_t acc[4];
+        ::xxh64Init(acc, seed);
+        i = ::xxh64Stripes(acc, data, count);
+        h = ::xxh64MergeAccs(acc);
     }
+    else h = seed + ::xxhPrime64_5;
 
-    return r;
+    h += count;
+
+    return ::xxh64Finalize(h, data + i, count - i);
 }
 
 //!
-//! Calculates a XOR checksum.
-//!
-//! The parity word of no data equals `0`.
+//! Calculates the XXH64 hash, compatible with the reference implementation (https://github.com/Cyan4973/xxHash).
 //!
 //! \b Exceptions
 //! - `std::invalid_argument` if count is greater than `data.size() - pos` or if `pos` is greater than `data.size()`
 //!
-uint8_t omw::parityWord(const std::vector<uint8_t>& data, std::vector<uint8_t>::size_type pos, std::vector<uint8_t>::size_type count)
+uint64_t omw::xxh64(const std::vector<uint8_t>& data, std::vector<uint8_t>::size_type pos, std::vector<uint8_t>::size_type count, uint64_t seed)
 {
-    if (((data.size() - pos) < count) || (pos > data.size())) throw std::invalid_argument("omw::parityWord");
-    return omw::parityWord(data.data() + pos, count);
+    if (((data.size() - pos) < count) || (pos > data.size())) throw std::invalid_argument("omw::xxh64");
+    return omw::xxh64(data.data() + pos, count, seed);
 }
 
+//!
+//! Calculates the 64-bit XXH3 hash (`XXH3_64bits_withSeed()`), compatible with the reference implementation
+//! (https://github.com/Cyan4973/xxHash).
+//!
+//! Inputs longer than 240 bytes are processed with AVX2 (if supported by the CPU) or SSE2 on x86-64.
+//!
+uint64_t omw::xxh3(const uint8_t* data, size_t count, uint64_t seed)
+{
+    if (!data) count = 0;
+
+    if (count <= ::xxh3MidSizeMax) return ::xxh3Short(data, count, seed);
+
+    if (seed == 0) return ::xxh3Long(data, count, ::xxh3DefaultSecret);
 
+    alignas(32) uint8_t secret[::xxh3SecretSize];
+    ::xxh3InitSecret(secret, seed);
+    return ::xxh3Long(data, count, secret);
+}
 
 //!
-//! Tested, OK. Is in _preview_ namespace because of the not complete CRC library concept/interface.
+//! Calculates the 64-bit XXH3 hash (`XXH3_64bits_withSeed()`), compatible with the reference implementation
+//! (https://github.com/Cyan4973/xxHash).
+//!
+//! \b Exceptions
+//! - `std::invalid_argument` if count is greater than `data.size() - pos` or if `pos` is greater than `data.size()`
 //!
-uint16_t omw::preview::crc16_kermit(const uint8_t* data, size_t count)
+uint64_t omw::xxh3(const std::vector<uint8_t>& data, std::vector<uint8_t>::size_type pos, std::vector<uint8_t>::size_type count, uint64_t seed)
+{
+    if (((data.size() - pos) < count) || (pos > data.size())) throw std::invalid_argument("omw::xxh3");
+    return omw::xxh3(data.data() + pos, count, seed);
+}
+
+
+
+/*!
+ * \class omw::Adler32State
+ *
+ * `#include <omw/checksum.h>`
+ *
+ * Streaming calculation of `omw::adler32()`.
+ *
+ * The hash state classes (`omw::Adler32State`, `omw::Fletcher16State`, `omw::Fletcher32State`, `omw::Fnv1a32State`, `omw::Fnv1a64State`,
+ * `omw::Xxh64State` and `omw::Xxh3State`) share the same interface as `omw::CrcState`: data is appended with `update()`, `finalize()`
+ * returns the hash of all data so far and does not alter the state.
+ *
+ * \b Exceptions
+ * - `update(const std::vector<uint8_t>&, ...)`: `std::invalid_argument` if count is greater than `data.size() - pos` or if `pos` is greater
+ *   than `data.size()`
+ */
+
+omw::Adler32State::Adler32State()
+    : m_a(1), m_b(0)
+{}
+
+void omw::Adler32State::reset()
+{
+    m_a = 1;
+    m_b = 0;
+}
+
+void omw::Adler32State::update(const uint8_t* data, size_t count)
+{
+    constexpr uint32_t base = 65521;
+    constexpr size_t nmax = 5552; // largest n such that 255n(n+1)/2 + (n+1)(base-1) <= 2^32-1
+
+    if (!data) count = 0;
+
+    while (count > 0)
+    {
+        const size_t n = (count < nmax ? count : nmax);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            m_a += data[i];
+            m_b += m_a;
+        }
+
+        m_a %= base;
+        m_b %= base;
+        data += n;
+        count -= n;
+    }
+}
+
+void omw::Adler32State::update(const std::vector<uint8_t>& data, std::vector<uint8_t>::size_type pos, std::vector<uint8_t>::size_type count)
+{
+    if (((data.size() - pos) < count) || (pos > data.size())) throw std::invalid_argument("omw::Adler32State::update");
+    update(data.data() + pos, count);
+}
+
+uint32_t omw::Adler32State::finalize() const { return ((m_b << 16) | m_a); }
+
+/*!
+ * \class omw::Fletcher16State
+ *
+ * `#include <omw/checksum.h>`
+ *
+ * Streaming calculation of `omw::fletcher16()`, see `omw::Adler32State`.
+ */
+
+omw::Fletcher16State::Fletcher16State()
+    : m_sum1(0), m_sum2(0)
+{}
+
+void omw::Fletcher16State::reset()
+{
+    m_sum1 = 0;
+    m_sum2 = 0;
+}
+
+void omw::Fletcher16State::update(const uint8_t* data, size_t count)
+{
+    constexpr size_t nmax = 5802; // largest n for which sum2 can not overflow
+
+    if (!data) count = 0;
+
+    while (count > 0)
+    {
+        const size_t n = (count < nmax ? count : nmax);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            m_sum1 += data[i];
+            m_sum2 += m_sum1;
+        }
+
+        m_sum1 %= 255;
+        m_sum2 %= 255;
+        data += n;
+        count -= n;
+    }
+}
+
+void omw::Fletcher16State::update(const std::vector<uint8_t>& data, std::vector<uint8_t>::size_type pos, std::vector<uint8_t>::size_type count)
+{
+    if (((data.size() - pos) < count) || (pos > data.size())) throw std::invalid_argument("omw::Fletcher16State::update");
+    update(data.data() + pos, count);
+}
+
+uint16_t omw::Fletcher16State::finalize() const { return static_cast<uint16_t>((m_sum2 << 8) | m_sum1); }
+
+/*!
+ * \class omw::Fletcher32State
+ *
+ * `#include <omw/checksum.h>`
+ *
+ * Streaming calculation of `omw::fletcher32()`, see `omw::Adler32State`. The chunks don't have to be aligned to 16-bit words.
+ */
+
+omw::Fletcher32State::Fletcher32State()
+    : m_sum1(0), m_sum2(0), m_odd(false), m_lowByte(0)
+{}
+
+void omw::Fletcher32State::reset()
+{
+    m_sum1 = 0;
+    m_sum2 = 0;
+    m_odd = false;
+    m_lowByte = 0;
+}
+
+void omw::Fletcher32State::update(const uint8_t* data, size_t count)
+{
+    constexpr size_t nmax = 359; // largest number of words for which sum2 can not overflow
+
+    if (!data || (count == 0)) return;
+
+    if (m_odd)
+    {
+        m_sum1 = (m_sum1 + (static_cast<uint32_t>(data[0]) << 8) + m_lowByte) % 65535;
+        m_sum2 = (m_sum2 + m_sum1) % 65535;
+        m_odd = false;
+        ++data;
+        --count;
+    }
+
+    size_t words = count / 2;
+
+    while (words > 0)
+    {
+        const size_t n = (words < nmax ? words : nmax);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            m_sum1 += static_cast<uint32_t>(data[2 * i]) | (static_cast<uint32_t>(data[(2 * i) + 1]) << 8);
+            m_sum2 += m_sum1;
+        }
+
+        m_sum1 %= 65535;
+        m_sum2 %= 65535;
+        data += 2 * n;
+        words -= n;
+    }
+
+    if (count % 2)
+    {
+        m_odd = true;
+        m_lowByte = *data;
+    }
+}
+
+void omw::Fletcher32State::update(const std::vector<uint8_t>& data, std::vector<uint8_t>::size_type pos, std::vector<uint8_t>::size_type count)
+{
+    if (((data.size() - pos) < count) || (pos > data.size())) throw std::invalid_argument("omw::Fletcher32State::update");
+    update(data.data() + pos, count);
+}
+
+uint32_t omw::Fletcher32State::finalize() const
+{
+    uint32_t sum1 = m_sum1;
+    uint32_t sum2 = m_sum2;
+
+    if (m_odd)
+    {
+        sum1 = (sum1 + m_lowByte) % 65535;
+        sum2 = (sum2 + sum1) % 65535;
+    }
+
+    return ((sum2 << 16) | sum1);
+}
+
+/*!
+ * \class omw::Fnv1a32State
+ *
+ * `#include <omw/checksum.h>`
+ *
+ * Streaming calculation of `omw::fnv1a32()`, see `omw::Adler32State`.
+ */
+
+omw::Fnv1a32State::Fnv1a32State()
+    : m_hash(0x811C9DC5)
+{}
+
+void omw::Fnv1a32State::reset() { m_hash = 0x811C9DC5; }
+
+void omw::Fnv1a32State::update(const uint8_t* data, size_t count)
+{
+    if (data)
+    {
+        for (size_t i = 0; i < count; ++i) m_hash = (m_hash ^ data[i]) * 0x01000193;
+    }
+}
+
+void omw::Fnv1a32State::update(const std::vector<uint8_t>& data, std::vector<uint8_t>::size_type pos, std::vector<uint8_t>::size_type count)
 {
-    uint16_t crc = 0;
+    if (((data.size() - pos) < count) || (pos > data.size())) throw std::invalid_argument("omw::Fnv1a32State::update");
+    update(data.data() + pos, count);
+}
+
+/*!
+ * \class omw::Fnv1a64State
+ *
+ * `#include <omw/checksum.h>`
+ *
+ * Streaming calculation of `omw::fnv1a64()`, see `omw::Adler32State`.
+ */
+
+omw::Fnv1a64State::Fnv1a64State()
+    : m_hash(0xCBF29CE484222325)
+{}
 
+void omw::Fnv1a64State::reset() { m_hash = 0xCBF29CE484222325; }
+
+void omw::Fnv1a64State::update(const uint8_t* data, size_t count)
+{
     if (data)
     {
-        for (size_t i = 0; i < count; ++i) { crc = (crc >> 8) ^ ::tableKermit___[(crc ^ data[i]) & 0xff]; }
+        for (size_t i = 0; i < count; ++i) m_hash = (m_hash ^ data[i]) * 0x00000100000001B3;
     }
+}
 
-    return crc;
+void omw::Fnv1a64State::update(const std::vector<uint8_t>& data, std::vector<uint8_t>::size_type pos, std::vector<uint8_t>::size_type count)
+{
+    if (((data.size() - pos) < count) || (pos > data.size())) throw std::invalid_argument("omw::Fnv1a64State::update");
+    update(data.data() + pos, count);
+}
+
+/*!
+ * \class omw::Xxh64State
+ *
+ * `#include <omw/checksum.h>`
+ *
+ * Streaming calculation of `omw::xxh64()`, see `omw::Adler32State`.
+ */
+
+omw::Xxh64State::Xxh64State()
+    : m_seed(0), m_acc(), m_length(0), m_buffer(), m_bufferSize(0)
+{
+    reset(0);
+}
+
+omw::Xxh64State::Xxh64State(uint64_t seed)
+    : m_seed(seed), m_acc(), m_length(0), m_buffer(), m_bufferSize(0)
+{
+    reset(seed);
+}
+
+void omw::Xxh64State::reset() { reset(m_seed); }
+
+void omw::Xxh64State::reset(uint64_t seed)
+{
+    m_seed = seed;
+    ::xxh64Init(m_acc, seed);
+    m_length = 0;
+    m_bufferSize = 0;
+}
+
+void omw::Xxh64State::update(const uint8_t* data, size_t count)
+{
+    if (!data) return;
+
+    m_length += count;
+
+    if (m_bufferSize > 0)
+    {
+        const size_t n = ((sizeof(m_buffer) - m_bufferSize) < count ? (sizeof(m_buffer) - m_bufferSize) : count);
+        std::memcpy(m_buffer + m_bufferSize, data, n);
+        m_bufferSize += n;
+        data += n;
+        count -= n;
+
+        if (m_bufferSize < sizeof(m_buffer)) return;
+
+        ::xxh64Stripes(m_acc, m_buffer, sizeof(m_buffer));
+        m_bufferSize = 0;
+    }
+
+    const size_t n = ::xxh64Stripes(m_acc, data, count);
+
+    if (n < count)
+    {
+        std::memcpy(m_buffer, data + n, count - n);
+        m_bufferSize = count - n;
+    }
+}
+
+void omw::Xxh64State::update(const std::vector<uint8_t>& data, std::vector<uint8_t>::size_type pos, std::vector<uint8_t>::size_type count)
+{
+    if (((data.size() - pos) < count) || (pos > data.size())) throw std::invalid_argument("omw::Xxh64State::update");
+    update(data.data() + pos, count);
+}
+
+uint64_t omw::Xxh64State::finalize() const
+{
+    uint64_t h;
+
+    if (m_length >= 32) h = ::xxh64MergeAccs(m_acc);
+    else h = m_seed + ::xxhPrime64_5;
+
+    h += m_length;
+
+    return ::xxh64Finalize(h, m_buffer, m_bufferSize);
+}
+
+/*!
+ * \class omw::Xxh3State
+ *
+ * `#include <omw/checksum.h>`
+ *
+ * Streaming calculation of `omw::xxh3()`, see `omw::Adler32State`.
+ */
+
+omw::Xxh3State::Xxh3State()
+    : m_seed(0), m_acc(), m_length(0), m_stripes(0), m_buffer(), m_bufferSize(0), m_secret()
+{
+    reset(0);
+}
+
+omw::Xxh3State::Xxh3State(uint64_t seed)
+    : m_seed(seed), m_acc(), m_length(0), m_stripes(0), m_buffer(), m_bufferSize(0), m_secret()
+{
+    reset(seed);
+}
+
+void omw::Xxh3State::reset() { reset(m_seed); }
+
+void omw::Xxh3State::reset(uint64_t seed)
+{
+    m_seed = seed;
+    ::xxh3InitAcc(m_acc);
+    ::xxh3InitSecret(m_secret, seed);
+    m_length = 0;
+    m_stripes = 0;
+    m_bufferSize = 0;
+}
+
+void omw::Xxh3State::update(const uint8_t* data, size_t count)
+{
+    if (!data) return;
+
+    m_length += count;
+
+    // keep at least one byte buffered, the last stripe is processed differently
+    if (count <= (bufferSize - m_bufferSize))
+    {
+        std::memcpy(m_buffer + m_bufferSize, data, count);
+        m_bufferSize += count;
+        return;
+    }
+
+    const uint8_t* const end = data + count;
+
+    if (m_bufferSize > 0)
+    {
+        const size_t n = bufferSize - m_bufferSize;
+        std::memcpy(m_buffer + m_bufferSize, data, n);
+        data += n;
+        ::xxh3ConsumeStripes(m_acc, m_stripes, m_buffer, bufferSize / ::xxh3StripeLen, m_secret);
+        m_bufferSize = 0;
+    }
+
+    if (static_cast<size_t>(end - data) > bufferSize)
+    {
+        const size_t stripes = static_cast<size_t>(end - 1 - data) / ::xxh3StripeLen;
+        ::xxh3ConsumeStripes(m_acc, m_stripes, data, stripes, m_secret);
+        data += stripes * ::xxh3StripeLen;
+
+        // the last stripe may overlap with already processed data
+        std::memcpy(m_buffer + bufferSize - ::xxh3StripeLen, data - ::xxh3StripeLen, ::xxh3StripeLen);
+    }
+
+    std::memcpy(m_buffer, data, static_cast<size_t>(end - data));
+    m_bufferSize = static_cast<size_t>(end - data);
+}
+
+void omw::Xxh3State::update(const std::vector<uint8_t>& data, std::vector<uint8_t>::size_type pos, std::vector<uint8_t>::size_type count)
+{
+    if (((data.size() - pos) < count) || (pos > data.size())) throw std::invalid_argument("omw::Xxh3State::update");
+    update(data.data() + pos, count);
 }
+
+uint64_t omw::Xxh3State::finalize() const
+{
+    if (m_length <= ::xxh3MidSizeMax) return ::xxh3Short(m_buffer, m_bufferSize, m_seed);
+
+    alignas(32) uint64_t acc[8];
+    std::memcpy(acc, m_acc, sizeof(acc));
+
+    uint8_t lastStripe[::xxh3StripeLen];
+    const uint8_t* lastStripePtr;
+
+    if (m_bufferSize >= ::xxh3StripeLen)
+    {
+        size_t stripesSoFar = m_stripes;
+        ::xxh3ConsumeStripes(acc, stripesSoFar, m_buffer, (m_bufferSize - 1) / ::xxh3StripeLen, m_secret);
+        lastStripePtr = m_buffer + m_bufferSize - ::xxh3StripeLen;
+    }
+    else
+    {
+        const size_t catchup = ::xxh3StripeLen - m_bufferSize;
+        std::memcpy(lastStripe, m_buffer + bufferSize - catchup, catchup);
+        std::memcpy(lastStripe + catchup, m_buffer, m_bufferSize);
+        lastStripePtr = lastStripe;
+    }
+
+    ::xxh3Accumulate512_scalar(acc, lastStripePtr, m_secret + secretSize - ::xxh3StripeLen - 7);
+
+    return ::xxh3MergeAccs(acc, m_secret + 11, m_length * ::xxhPrime64_1);
+}
+
+
+//!
+//! Byte wise reference implementation of `omw::crc16::kermit()`.
+//!
+uint16_t omw::preview::crc16_kermit(const uint8_t* data, size_t count) { return ::CrcEngine<omw::crc16::Kermit>::calcBytewise(data, count); }
@@ -0,0 +1,116 @@
+/*
+author          Oliver Blaser
+date            17.10.2026
+copyright       MIT - Copyright (c) 2026 Oliver Blaser
+*/
+
+/*
+ * Internal header, runtime detection of instruction set extensions.
+ *
+ * Functions compiled for an extension are marked with OMWi_TARGET("..") and must only be called if the corresponding query returned true.
+ */
+
+#ifndef IG_OMW_CPUFEATURES_H
+#define IG_OMW_CPUFEATURES_H
+
+#include "omw/defs.h"
+
+
+#if defined(OMW_PARCH_x86_64) && (defined(OMW_CXX_GCC) || defined(OMW_CXX_CLANG) || defined(OMW_CXX_MSVC))
+#define OMWi_X86_DISPATCH (1)
+#endif
+
+#if defined(OMWi_X86_DISPATCH) && !defined(OMW_CXX_MSVC)
+#define OMWi_TARGET(_ext) __attribute__((target(_ext)))
+#else
+#define OMWi_TARGET(_ext)
+#endif
+
+#ifdef OMWi_X86_DISPATCH
+#ifdef OMW_CXX_MSVC
+#include <intrin.h>
+#endif
+#include <immintrin.h>
+#endif
+
+
+namespace omw {
+namespace internal {
+    namespace cpu {
+
+#ifdef OMWi_X86_DISPATCH
+
+        struct Features
+        {
+            bool ssse3;
+            bool sse41;
+            bool sse42;
+            bool pclmul;
+            bool avx2;
+            bool bmi2;
+        };
+
+        inline Features detect()
+        {
+            Features f = { false, false, false, false, false, false };
+
+#ifdef OMW_CXX_MSVC
+            int r[4];
+
+            __cpuid(r, 0);
+            const int maxLeaf = r[0];
+
+            __cpuid(r, 1);
+            f.ssse3 = ((r[2] & (1 << 9)) != 0);
+            f.sse41 = ((r[2] & (1 << 19)) != 0);
+            f.sse42 = ((r[2] & (1 << 20)) != 0);
+            f.pclmul = ((r[2] & (1 << 1)) != 0);
+            const bool osAvx = ((r[2] & (1 << 27)) != 0) && ((r[2] & (1 << 28)) != 0) && ((_xgetbv(0) & 0x06) == 0x06);
+
+            if (maxLeaf >= 7)
+            {
+                __cpuidex(r, 7, 0);
+                f.avx2 = osAvx && ((r[1] & (1 << 5)) != 0);
+                f.bmi2 = ((r[1] & (1 << 8)) != 0);
+            }
+#else
+            __builtin_cpu_init();
+            f.ssse3 = __builtin_cpu_supports("ssse3");
+            f.sse41 = __builtin_cpu_supports("sse4.1");
+            f.sse42 = __builtin_cpu_supports("sse4.2");
+            f.pclmul = __builtin_cpu_supports("pclmul");
+            f.avx2 = __builtin_cpu_supports("avx2");
+            f.bmi2 = __builtin_cpu_supports("bmi2");
+#endif
+
+            return f;
+        }
+
+        inline const Features& features()
+        {
+            static const Features f = detect();
+            return f;
+        }
+
+        inline bool hasSsse3() { return features().ssse3; }
+        inline bool hasSse42() { return features().sse42; }
+        inline bool hasPclmul() { return (features().pclmul && features().sse41); }
+        inline bool hasAvx2() { return features().avx2; }
+        inline bool hasBmi2() { return features().bmi2; }
+
+#else // OMWi_X86_DISPATCH
+
+        inline bool hasSsse3() { return false; }
+        inline bool hasSse42() { return false; }
+        inline bool hasPclmul() { return false; }
+        inline bool hasAvx2() { return false; }
+        inline bool hasBmi2() { return false; }
+
+#endif // OMWi_X86_DISPATCH
+
+    } // namespace cpu
+} // namespace internal
+} // namespace omw
+
+
+#endif // IG_OMW_CPUFEATURES_H
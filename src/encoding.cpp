@@ -5,10 +5,13 @@ copyright       MIT - Copyright (c) 2024 Oliver Blaser
 
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <vector>
 
+#include "cpuFeatures.h"
 #include "omw/defs.h"
 #include "omw/encoding.h"
 #include "omw/int.h"
@@ -18,260 +21,1565 @@ copyright       MIT - Copyright (c) 2024 Oliver Blaser
 
 namespace {
 
+// Reverses the byte order of `width` byte words, returns the number of processed bytes (a multiple of the vector size). `src` and `dst` may
+// be equal but must not overlap partially.
+using swap_kernel_t = size_t (*)(const uint8_t* src, uint8_t* dst, size_t size, size_t width);
+
+size_t swapKernel_none(const uint8_t*, uint8_t*, size_t, size_t) { return 0; }
+
+#ifdef OMWi_X86_DISPATCH
+
+OMWi_TARGET("ssse3") __m128i swapMask128(size_t width)
+{
+    if (width == 2) return _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+    if (width == 4) return _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+    return _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+}
+
+OMWi_TARGET("ssse3") size_t swapKernel_ssse3(const uint8_t* src, uint8_t* dst, size_t size, size_t width)
+{
+    const __m128i mask = swapMask128(width);
+    size_t i = 0;
+
+    for (; (size - i) >= 16; i += 16)
+    {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_shuffle_epi8(v, mask));
+    }
+
+    return i;
+}
+
+OMWi_TARGET("avx2") size_t swapKernel_avx2(const uint8_t* src, uint8_t* dst, size_t size, size_t width)
+{
+    const __m128i m = swapMask128(width);
+    const __m256i mask = _mm256_broadcastsi128_si256(m);
+    size_t i = 0;
+
+    for (; (size - i) >= 64; i += 64)
+    {
+        const __m256i v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        const __m256i v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i + 32));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_shuffle_epi8(v0, mask));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i + 32), _mm256_shuffle_epi8(v1, mask));
+    }
+
+    for (; (size - i) >= 16; i += 16)
+    {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_shuffle_epi8(v, m));
+    }
+
+    _mm256_zeroupper();
+
+    return i;
+}
+
+#endif // OMWi_X86_DISPATCH
+
+swap_kernel_t swapKernel()
+{
+#ifdef OMWi_X86_DISPATCH
+    static const swap_kernel_t kernel = (omw::internal::cpu::hasAvx2() ? swapKernel_avx2
+                                                                       : (omw::internal::cpu::hasSsse3() ? swapKernel_ssse3 : swapKernel_none));
+#else
+    static const swap_kernel_t kernel = swapKernel_none;
+#endif
+
+    return kernel;
+}
+
+// Exceptions
+// - `std::invalid_argument`
+template <typename T> void bigEndian_decodeBulk(const uint8_t* src, T* dst, size_t n, const char* fnName)
+{
+    if ((!src || !dst) && (n > 0)) throw std::invalid_argument(fnName);
+
+    uint8_t* const dst8 = reinterpret_cast<uint8_t*>(dst);
+    size_t i = ::swapKernel()(src, dst8, n * sizeof(T), sizeof(T)) / sizeof(T);
+
+    for (; i < n; ++i) dst[i] = omw::internal::loadBE<T>(src + (i * sizeof(T)));
+}
+
+// Exceptions
+// - `std::invalid_argument`
+template <typename T> void bigEndian_encodeBulk(uint8_t* dst, const T* src, size_t n, const char* fnName)
+{
+    if ((!src || !dst) && (n > 0)) throw std::invalid_argument(fnName);
+
+    const uint8_t* const src8 = reinterpret_cast<const uint8_t*>(src);
+    size_t i = ::swapKernel()(src8, dst, n * sizeof(T), sizeof(T)) / sizeof(T);
+
+    for (; i < n; ++i) omw::internal::storeBE<T>(dst + (i * sizeof(T)), src[i]);
+}
+
+// Exceptions
+// - `std::invalid_argument`
+template <typename T> void littleEndian_decodeBulk(const uint8_t* src, T* dst, size_t n, const char* fnName)
+{
+    if ((!src || !dst) && (n > 0)) throw std::invalid_argument(fnName);
+
+#if defined(OMW_BYTE_ORDER_LITTLE)
+    if ((n > 0) && (src != reinterpret_cast<const uint8_t*>(dst))) std::memmove(dst, src, n * sizeof(T));
+#else
+    for (size_t i = 0; i < n; ++i) dst[i] = omw::internal::loadLE<T>(src + (i * sizeof(T)));
+#endif
+}
+
+// Exceptions
+// - `std::invalid_argument`
+template <typename T> void littleEndian_encodeBulk(uint8_t* dst, const T* src, size_t n, const char* fnName)
+{
+    if ((!src || !dst) && (n > 0)) throw std::invalid_argument(fnName);
+
+#if defined(OMW_BYTE_ORDER_LITTLE)
+    if ((n > 0) && (dst != reinterpret_cast<const uint8_t*>(src))) std::memmove(dst, src, n * sizeof(T));
+#else
+    for (size_t i = 0; i < n; ++i) omw::internal::storeLE<T>(dst + (i * sizeof(T)), src[i]);
+#endif
+}
+
+// Exceptions
+// - `std::invalid_argument`
+// - `std::out_of_range`
+// - `std::overflow_error`
+template <typename T> T varint_decode(const uint8_t* data, size_t count, size_t* length, const char* fnName)
+{
+    constexpr unsigned bits = 8 * sizeof(T);
+
+    if (!data || (count == 0)) throw std::invalid_argument(fnName);
+
+    T r = 0;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        const unsigned shift = static_cast<unsigned>(7 * i);
+        const uint8_t b = data[i];
+
+        if ((shift >= bits) || ((shift + 7) > bits && ((b & 0x7F) >> (bits - shift)) != 0)) throw std::overflow_error(fnName);
+
+        r |= static_cast<T>(b & 0x7F) << shift;
+
+        if ((b & 0x80) == 0)
+        {
+            if (length) *length = i + 1;
+            return r;
+        }
+    }
+
+    throw std::out_of_range(fnName);
+}
+
+template <typename T> size_t varint_encode(uint8_t* buffer, T value, const char* fnName)
+{
+    if (!buffer) throw std::invalid_argument(fnName);
+
+    size_t n = 0;
+
+    while (value >= 0x80)
+    {
+        buffer[n++] = static_cast<uint8_t>(value | 0x80);
+        value >>= 7;
+    }
+    buffer[n++] = static_cast<uint8_t>(value);
+
+    return n;
+}
+
+#ifdef OMWi_X86_DISPATCH
+
+// Masked VByte (Plaisance, Kurz, Lemire), the continuation bits of 12 input bytes select an entry which shuffles the leading complete
+// varints into 16-bit lanes (values of up to 2 bytes) or 32-bit lanes (values of up to 4 bytes).
+struct MaskedVByteEntry
+{
+    uint8_t shuffle[16];
+    uint8_t values;   // number of decoded values, 0 if the first value has to be decoded by the scalar code
+    uint8_t consumed; // number of consumed input bytes
+    bool lanes16;
+};
+
+struct MaskedVByteTable
+{
+    MaskedVByteTable();
+
+    MaskedVByteEntry entry[4096];
+};
+
+MaskedVByteTable::MaskedVByteTable()
+{
+    for (unsigned mask = 0; mask < 4096; ++mask)
+    {
+        size_t len[12];
+        size_t start[12];
+        size_t nValues = 0;
+        size_t pos = 0;
+
+        while (pos < 12)
+        {
+            size_t l = 1;
+            while (((pos + l - 1) < 12) && (mask & (1u << (pos + l - 1)))) ++l;
+            if ((pos + l) > 12) break; // incomplete
+
+            start[nValues] = pos;
+            len[nValues] = l;
+            ++nValues;
+            pos += l;
+        }
+
+        size_t n16 = 0;
+        while ((n16 < nValues) && (n16 < 8) && (len[n16] <= 2)) ++n16;
+
+        size_t n32 = 0;
+        while ((n32 < nValues) && (n32 < 4) && (len[n32] <= 4)) ++n32;
+
+        MaskedVByteEntry& e = entry[mask];
+        const bool lanes16 = (n16 >= n32);
+        const size_t values = (lanes16 ? n16 : n32);
+        const size_t laneSize = (lanes16 ? 2 : 4);
+
+        e.lanes16 = lanes16;
+        e.values = static_cast<uint8_t>(values);
+        e.consumed = 0;
+
+        for (size_t i = 0; i < 16; ++i) e.shuffle[i] = 0x80;
+
+        for (size_t v = 0; v < values; ++v)
+        {
+            for (size_t k = 0; k < len[v]; ++k) e.shuffle[v * laneSize + k] = static_cast<uint8_t>(start[v] + k);
+            e.consumed = static_cast<uint8_t>(e.consumed + len[v]);
+        }
+    }
+}
+
+const MaskedVByteTable& maskedVByteTable()
+{
+    static const MaskedVByteTable table;
+    return table;
+}
+
+// stores 4 32-bit lanes
+OMWi_TARGET("ssse3") void varint_storeLanes(uint32_t* p, __m128i v) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+OMWi_TARGET("ssse3") void varint_storeLanes(uint64_t* p, __m128i v)
+{
+    const __m128i zero = _mm_setzero_si128();
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(p), _mm_unpacklo_epi32(v, zero));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(p + 2), _mm_unpackhi_epi32(v, zero));
+}
+
+// Decodes while at least 16 input bytes and 16 output values are left, advances `pos` and `i`.
+template <typename T> OMWi_TARGET("ssse3") void varint_decodeBulk_ssse3(const uint8_t* src, size_t count, T* dst, size_t n, size_t& pos, size_t& i, const char* fnName)
+{
+    const MaskedVByteTable& table = maskedVByteTable();
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i mask7F = _mm_set1_epi16(0x007F);
+    const __m128i mask7F00 = _mm_set1_epi16(0x7F00);
+    const __m128i mask7F_32 = _mm_set1_epi32(0x0000007F);
+    const __m128i mask7F00_32 = _mm_set1_epi32(0x00007F00);
+    const __m128i mask7F0000_32 = _mm_set1_epi32(0x007F0000);
+    const __m128i mask7F000000_32 = _mm_set1_epi32(0x7F000000);
+
+    while (((count - pos) >= 16) && ((n - i) >= 16))
+    {
+        const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + pos));
+        const unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(in));
+
+        if (mask == 0) // 16 single byte values
+        {
+            const __m128i lo = _mm_unpacklo_epi8(in, zero);
+            const __m128i hi = _mm_unpackhi_epi8(in, zero);
+            varint_storeLanes(dst + i, _mm_unpacklo_epi16(lo, zero));
+            varint_storeLanes(dst + i + 4, _mm_unpackhi_epi16(lo, zero));
+            varint_storeLanes(dst + i + 8, _mm_unpacklo_epi16(hi, zero));
+            varint_storeLanes(dst + i + 12, _mm_unpackhi_epi16(hi, zero));
+            pos += 16;
+            i += 16;
+            continue;
+        }
+
+        const MaskedVByteEntry& e = table.entry[mask & 0x0FFF];
+
+        if (e.values == 0)
+        {
+            size_t length;
+            dst[i++] = varint_decode<T>(src + pos, count - pos, &length, fnName);
+            pos += length;
+            continue;
+        }
+
+        const __m128i x = _mm_shuffle_epi8(in, _mm_loadu_si128(reinterpret_cast<const __m128i*>(e.shuffle)));
+
+        if (e.lanes16)
+        {
+            const __m128i v = _mm_or_si128(_mm_and_si128(x, mask7F), _mm_srli_epi16(_mm_and_si128(x, mask7F00), 1));
+            varint_storeLanes(dst + i, _mm_unpacklo_epi16(v, zero));
+            varint_storeLanes(dst + i + 4, _mm_unpackhi_epi16(v, zero));
+        }
+        else
+        {
+            __m128i v = _mm_and_si128(x, mask7F_32);
+            v = _mm_or_si128(v, _mm_srli_epi32(_mm_and_si128(x, mask7F00_32), 1));
+            v = _mm_or_si128(v, _mm_srli_epi32(_mm_and_si128(x, mask7F0000_32), 2));
+            v = _mm_or_si128(v, _mm_srli_epi32(_mm_and_si128(x, mask7F000000_32), 3));
+            varint_storeLanes(dst + i, v);
+        }
+
+        pos += e.consumed;
+        i += e.values;
+    }
+}
+
+#endif // OMWi_X86_DISPATCH
+
+// Returns the number of consumed bytes.
+//
+// Exceptions
+// - `std::invalid_argument`
+// - `std::out_of_range`
+// - `std::overflow_error`
+template <typename T> size_t varint_decodeBulk(const uint8_t* src, size_t count, T* dst, size_t n, const char* fnName)
+{
+    if ((!src && (count > 0)) || (!dst && (n > 0))) throw std::invalid_argument(fnName);
+
+    size_t pos = 0;
+    size_t i = 0;
+
+#ifdef OMWi_X86_DISPATCH
+    if (omw::internal::cpu::hasSsse3()) varint_decodeBulk_ssse3<T>(src, count, dst, n, pos, i, fnName);
+#endif
+
+    for (; i < n; ++i)
+    {
+        if (pos >= count) throw std::out_of_range(fnName);
+
+        size_t length;
+        dst[i] = varint_decode<T>(src + pos, count - pos, &length, fnName);
+        pos += length;
+    }
+
+    return pos;
+}
+
+// packed BCD lookup tables
+struct BcdTables
+{
+    BcdTables();
+
+    uint8_t toBcd[100];   // binary 0..99 to packed BCD
+    uint8_t fromBcd[256]; // packed BCD to binary, 0xFF if a nibble is not a decimal digit
+};
+
+BcdTables::BcdTables()
+{
+    for (unsigned i = 0; i < 100; ++i) toBcd[i] = static_cast<uint8_t>(((i / 10) << 4) | (i % 10));
+
+    for (unsigned i = 0; i < 256; ++i)
+    {
+        const unsigned h = (i >> 4);
+        const unsigned l = (i & 0x0F);
+        fromBcd[i] = (((h <= 9) && (l <= 9)) ? static_cast<uint8_t>(h * 10 + l) : 0xFF);
+    }
+}
+
+const BcdTables& bcdTables()
+{
+    static const BcdTables tables;
+    return tables;
+}
+
+// writes the 8 least significant decimal digits of `value` to `[p, p + 4)`
+void bcd_encode8Digits(uint8_t* p, uint32_t value, const BcdTables& t)
+{
+    const uint32_t h = value / 10000;
+    const uint32_t l = value % 10000;
+
+    p[0] = t.toBcd[(h / 100) % 100];
+    p[1] = t.toBcd[h % 100];
+    p[2] = t.toBcd[l / 100];
+    p[3] = t.toBcd[l % 100];
+}
+
+// copies the right aligned digits to the buffer
+//
+// Exceptions
+// - `std::overflow_error`
+void bcd_copy(uint8_t* buffer, size_t bufferSize, const uint8_t* digits, size_t digitsSize, const char* fnName)
+{
+    if (bufferSize >= digitsSize)
+    {
+        std::memset(buffer, 0, bufferSize - digitsSize);
+        std::memcpy(buffer + (bufferSize - digitsSize), digits, digitsSize);
+    }
+    else
+    {
+        const size_t cut = digitsSize - bufferSize;
+        for (size_t i = 0; i < cut; ++i)
+        {
+            if (digits[i] != 0) throw std::overflow_error(fnName);
+        }
+
+        if (bufferSize > 0) std::memcpy(buffer, digits + cut, bufferSize);
+    }
+}
+
+// Exceptions
+// - `std::invalid_argument`
+// - `std::overflow_error`
+template <typename T> T bcd_decode(const uint8_t* data, size_t count, const char* fnName)
+{
+    constexpr uint64_t max = static_cast<T>(-1);
+
+    if (!data || (count == 0)) throw std::invalid_argument(fnName);
+
+    // number of bytes which can't overflow the result (99, 9999, 99999999 or 18 digits)
+    constexpr size_t safeCount = ((sizeof(T) == 1) ? 1 : ((sizeof(T) == 2) ? 2 : ((sizeof(T) == 4) ? 4 : 9)));
+
+    const BcdTables& t = bcdTables();
+    uint64_t r = 0;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        const uint8_t d = t.fromBcd[data[i]];
+
+        if (d == 0xFF) throw std::invalid_argument(fnName);
+        if ((i >= safeCount) && (r > ((max - d) / 100))) throw std::overflow_error(fnName);
+
+        r = r * 100 + d;
+    }
+
+    return static_cast<T>(r);
+}
+
+void mul64(uint64_t a, uint64_t b, uint64_t& h, uint64_t& l)
+{
+    const uint64_t aL = (a & 0xFFFFFFFF);
+    const uint64_t aH = (a >> 32);
+    const uint64_t bL = (b & 0xFFFFFFFF);
+    const uint64_t bH = (b >> 32);
+
+    const uint64_t ll = aL * bL;
+    const uint64_t lh = aL * bH;
+    const uint64_t hl = aH * bL;
+    const uint64_t hh = aH * bH;
+
+    const uint64_t mid = (ll >> 32) + (lh & 0xFFFFFFFF) + (hl & 0xFFFFFFFF);
+
+    l = (mid << 32) | (ll & 0xFFFFFFFF);
+    h = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+}
+
+} // namespace
+
+
+
+/*!
+ * \namespace omw::bcd
+ *
+ * `#include <omw/encoding.h>`
+ *
+ * Converts between packed BCD formated byte buffers (two decimal digits per byte, most significant digit first) and their integral values.
+ * The conversion is done two digits at a time with lookup tables, instead of the bit serial double dabble algorithm.
+ *
+ * \section ns_omw_bcd_section_decodeFn Decode Functions
+ *
+ * Decode the `count` bytes (`2 * count` digits) at `data`, leading zeros are allowed.
+ *
+ * \b Exceptions
+ * - `std::invalid_argument` if the data pointer is `NULL`, count equals zero or a nibble is not a decimal digit
+ * - `std::overflow_error` if the value doesn't fit into the return type
+ *
+ * \section ns_omw_bcd_section_encodeFn Encode Functions
+ *
+ * Write the value right aligned to `[buffer, buffer + bufferSize)`, unused leading digits are set to zero.
+ *
+ * \b Exceptions
+ * - `std::invalid_argument` if the destination pointer is `NULL`
+ * - `std::overflow_error` if the value has more than `2 * bufferSize` digits
+ */
+
+//!
+//! See \ref ns_omw_bcd_section_decodeFn.
+//!
+uint8_t omw::bcd::decode8(const uint8_t* data, size_t count) { return ::bcd_decode<uint8_t>(data, count, "omw::bcd::decode8"); }
+
+//!
+//! See \ref ns_omw_bcd_section_decodeFn.
+//!
+uint16_t omw::bcd::decode16(const uint8_t* data, size_t count) { return ::bcd_decode<uint16_t>(data, count, "omw::bcd::decode16"); }
+
+//!
+//! See \ref ns_omw_bcd_section_decodeFn.
+//!
+uint32_t omw::bcd::decode32(const uint8_t* data, size_t count) { return ::bcd_decode<uint32_t>(data, count, "omw::bcd::decode32"); }
+
+//!
+//! See \ref ns_omw_bcd_section_decodeFn.
+//!
+uint64_t omw::bcd::decode64(const uint8_t* data, size_t count) { return ::bcd_decode<uint64_t>(data, count, "omw::bcd::decode64"); }
+
+//!
+//! See \ref ns_omw_bcd_section_decodeFn.
+//!
+omw::uint128_t omw::bcd::decode128(const uint8_t* data, size_t count)
+{
+    const char* const fnName = "omw::bcd::decode128";
+
+    if (!data || (count == 0)) throw std::invalid_argument(fnName);
+
+    const ::BcdTables& t = ::bcdTables();
+    uint64_t h = 0;
+    uint64_t l = 0;
+    size_t i = 0;
+
+    // 16 digits per 64-bit chunk, r = r * 100^k + chunk
+    while (i < count)
+    {
+        const size_t k = (((count - i) % 8) ? ((count - i) % 8) : 8);
+        uint64_t chunk = 0;
+        uint64_t m = 1;
+
+        for (size_t j = 0; j < k; ++j)
+        {
+            const uint8_t d = t.fromBcd[data[i + j]];
+            if (d == 0xFF) throw std::invalid_argument(fnName);
+
+            chunk = chunk * 100 + d;
+            m *= 100;
+        }
+
+        uint64_t carry, hh, hl;
+        ::mul64(l, m, carry, l);
+        ::mul64(h, m, hh, hl);
+        h = hl + carry;
+        if ((hh != 0) || (h < hl)) throw std::overflow_error(fnName);
+
+        l += chunk;
+        if (l < chunk)
+        {
+            ++h;
+            if (h == 0) throw std::overflow_error(fnName);
+        }
+
+        i += k;
+    }
+
+    return omw::uint128_t(h, l);
+}
+
+//!
+//! See \ref ns_omw_bcd_section_encodeFn.
+//!
+void omw::bcd::encode(uint8_t* buffer, size_t bufferSize, uint64_t value)
+{
+    const char* const fnName = "omw::bcd::encode";
+
+    if (!buffer) throw std::invalid_argument(fnName);
+
+    const ::BcdTables& t = ::bcdTables();
+    uint8_t digits[12];
+
+    const uint64_t rem = value % 10000000000000000;
+    ::bcd_encode8Digits(digits + 0, static_cast<uint32_t>(value / 10000000000000000), t);
+    ::bcd_encode8Digits(digits + 4, static_cast<uint32_t>(rem / 100000000), t);
+    ::bcd_encode8Digits(digits + 8, static_cast<uint32_t>(rem % 100000000), t);
+
+    ::bcd_copy(buffer, bufferSize, digits, sizeof(digits), fnName);
+}
+
+//!
+//! See \ref ns_omw_bcd_section_encodeFn.
+//!
+void omw::bcd::encode(uint8_t* buffer, size_t bufferSize, const omw::uint128_t& value)
+{
+    const char* const fnName = "omw::bcd::encode";
+
+    if (!buffer) throw std::invalid_argument(fnName);
+
+    if (value.hi() == 0) return omw::bcd::encode(buffer, bufferSize, value.lo());
+
+    const ::BcdTables& t = ::bcdTables();
+    uint8_t digits[20];
+    uint32_t limb[4] = { static_cast<uint32_t>(value.hi() >> 32), static_cast<uint32_t>(value.hi()), static_cast<uint32_t>(value.lo() >> 32),
+                         static_cast<uint32_t>(value.lo()) };
+
+    // 8 digits per division by 10^8, in 32-bit limbs
+    for (size_t k = 0; k < 5; ++k)
+    {
+        uint64_t rem = 0;
+
+        for (size_t i = 0; i < 4; ++i)
+        {
+            const uint64_t cur = (rem << 32) | limb[i];
+            limb[i] = static_cast<uint32_t>(cur / 100000000);
+            rem = cur % 100000000;
+        }
+
+        ::bcd_encode8Digits(digits + 16 - 4 * k, static_cast<uint32_t>(rem), t);
+    }
+
+    ::bcd_copy(buffer, bufferSize, digits, sizeof(digits), fnName);
+}
+
+
+
+/*!
+ * \namespace omw::bigEndian
+ *
+ * `#include <omw/encoding.h>`
+ *
+ * \section ns_omw_bigEndian_section_decodeFn Decode Functions
+ *
+ * \b Exceptions
+ * - `std::invalid_argument` if the data pointer is `NULL` or count equals zero
+ * - `std::overflow_error` if the number of bytes to be decoded is grater than the size of the return type
+ *
+ * \section ns_omw_bigEndian_section_encodeFn Encode Functions
+ *
+ * Writes the encoded value to `[buffer, buffer + sizeof(value))`.
+ *
+ * \b Exceptions
+ * - `std::invalid_argument` if the destination pointer is `NULL`
+ *
+ * \section ns_omw_bigEndian_section_bulkFn Bulk Functions
+ *
+ * Decode `n` values from `[src, src + n * sizeof(T))` to `dst`, or encode `n` values from `src` to `[dst, dst + n * sizeof(T))`. The byte
+ * order is reversed with SIMD shuffles (AVX2 or SSSE3, detected at runtime) on x86-64. `src` and `dst` may point to the same memory (in place
+ * conversion), other overlaps are not allowed.
+ *
+ * \b Exceptions
+ * - `std::invalid_argument` if a pointer is `NULL` and `n` is not zero
+ */
+
+// Exceptions
+// - `std::invalid_argument`
+// - `std::overflow_error`
+template <typename T> T omw::internal::bigEndian_decode(const uint8_t* data, size_t count, const char* fnName)
+{
+    if (!data || (count == 0)) throw std::invalid_argument(fnName);
+    if (count > sizeof(T)) throw std::overflow_error(fnName);
+    if (count == sizeof(T)) return omw::internal::loadBE<T>(data);
+
+    T r = 0;
+    if (std::is_signed<T>::value && (data[0] & 0x80)) r = static_cast<T>(-1);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        omw::shiftLeftAssign(r, 8);
+        r |= static_cast<T>(data[i]);
+    }
+
+    return r;
+}
+
+template int16_t omw::internal::bigEndian_decode<int16_t>(const uint8_t* data, size_t count, const char* fnName);
+template uint16_t omw::internal::bigEndian_decode<uint16_t>(const uint8_t* data, size_t count, const char* fnName);
+template int32_t omw::internal::bigEndian_decode<int32_t>(const uint8_t* data, size_t count, const char* fnName);
+template uint32_t omw::internal::bigEndian_decode<uint32_t>(const uint8_t* data, size_t count, const char* fnName);
+template int64_t omw::internal::bigEndian_decode<int64_t>(const uint8_t* data, size_t count, const char* fnName);
+template uint64_t omw::internal::bigEndian_decode<uint64_t>(const uint8_t* data, size_t count, const char* fnName);
+
+//!
+//! See \ref ns_omw_bigEndian_section_decodeFn.
+//!
+omw::int128_t omw::bigEndian::decode_i128(const uint8_t* data, size_t count)
+{
+    const char* const fnName = "omw::bigEndian::decode_i128";
+
+    omw::int128_t r;
+
+    if (data && count > 0)
+    {
+        if (data[0] & 0x80) r.sets(-1);
+        else r.setu(0);
+
+        if (count > 16) throw std::overflow_error(fnName);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            r <<= 8;
+            r |= omw::int128_t(0, data[i]);
+        }
+    }
+    else throw std::invalid_argument(fnName);
+
+    return r;
+}
+
+//!
+//! See \ref ns_omw_bigEndian_section_decodeFn.
+//!
+omw::uint128_t omw::bigEndian::decode_ui128(const uint8_t* data, size_t count)
+{
+    const char* const fnName = "omw::bigEndian::decode_ui128";
+
+    omw::uint128_t r;
+
+    if (data && count > 0)
+    {
+        r.setu(0);
+
+        if (count > 16) throw std::overflow_error(fnName);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            r <<= 8;
+            r |= omw::uint128_t(0, data[i]);
+        }
+    }
+    else throw std::invalid_argument(fnName);
+
+    return r;
+}
+
+//!
+//! See \ref ns_omw_bigEndian_section_encodeFn.
+//!
+void omw::bigEndian::encode_16(uint8_t* buffer, int16_t value) { omw::bigEndian::encode_16(buffer, static_cast<uint16_t>(value)); }
+
+//!
+//! See \ref ns_omw_bigEndian_section_encodeFn.
+//!
+void omw::bigEndian::encode_16(uint8_t* buffer, uint16_t value)
+{
+    if (buffer)
+    {
+        buffer[0] = static_cast<uint8_t>((value >> 8) & 0xFF);
+        buffer[1] = static_cast<uint8_t>(value & 0xFF);
+    }
+    else throw std::invalid_argument("omw::bigEndian::encode_16");
+}
+
+//!
+//! See \ref ns_omw_bigEndian_section_encodeFn.
+//!
+void omw::bigEndian::encode_32(uint8_t* buffer, int32_t value) { omw::bigEndian::encode_32(buffer, static_cast<uint32_t>(value)); }
+
+//!
+//! See \ref ns_omw_bigEndian_section_encodeFn.
+//!
+void omw::bigEndian::encode_32(uint8_t* buffer, uint32_t value)
+{
+    if (buffer)
+    {
+        buffer[0] = static_cast<uint8_t>((value >> 24) & 0xFF);
+        buffer[1] = static_cast<uint8_t>((value >> 16) & 0xFF);
+        buffer[2] = static_cast<uint8_t>((value >> 8) & 0xFF);
+        buffer[3] = static_cast<uint8_t>(value & 0xFF);
+    }
+    else throw std::invalid_argument("omw::bigEndian::encode_32");
+}
+
+//!
+//! See \ref ns_omw_bigEndian_section_encodeFn.
+//!
+void omw::bigEndian::encode_64(uint8_t* buffer, int64_t value) { omw::bigEndian::encode_64(buffer, static_cast<uint64_t>(value)); }
+
+//!
+//! See \ref ns_omw_bigEndian_section_encodeFn.
+//!
+void omw::bigEndian::encode_64(uint8_t* buffer, uint64_t value)
+{
+    if (buffer)
+    {
+        buffer[0] = static_cast<uint8_t>((value >> 56) & 0xFF);
+        buffer[1] = static_cast<uint8_t>((value >> 48) & 0xFF);
+        buffer[2] = static_cast<uint8_t>((value >> 40) & 0xFF);
+        buffer[3] = static_cast<uint8_t>((value >> 32) & 0xFF);
+        buffer[4] = static_cast<uint8_t>((value >> 24) & 0xFF);
+        buffer[5] = static_cast<uint8_t>((value >> 16) & 0xFF);
+        buffer[6] = static_cast<uint8_t>((value >> 8) & 0xFF);
+        buffer[7] = static_cast<uint8_t>(value & 0xFF);
+    }
+    else throw std::invalid_argument("omw::bigEndian::encode_64");
+}
+
+//!
+//! See \ref ns_omw_bigEndian_section_encodeFn.
+//!
+void omw::bigEndian::encode_128(uint8_t* buffer, const omw::Base_Int128& value)
+{
+    if (buffer)
+    {
+        const uint64_t h = value.hi();
+        const uint64_t l = value.lo();
+
+        buffer[0] = static_cast<uint8_t>((h >> 56) & 0xFF);
+        buffer[1] = static_cast<uint8_t>((h >> 48) & 0xFF);
+        buffer[2] = static_cast<uint8_t>((h >> 40) & 0xFF);
+        buffer[3] = static_cast<uint8_t>((h >> 32) & 0xFF);
+        buffer[4] = static_cast<uint8_t>((h >> 24) & 0xFF);
+        buffer[5] = static_cast<uint8_t>((h >> 16) & 0xFF);
+        buffer[6] = static_cast<uint8_t>((h >> 8) & 0xFF);
+        buffer[7] = static_cast<uint8_t>(h & 0xFF);
+
+        buffer[8] = static_cast<uint8_t>((l >> 56) & 0xFF);
+        buffer[9] = static_cast<uint8_t>((l >> 48) & 0xFF);
+        buffer[10] = static_cast<uint8_t>((l >> 40) & 0xFF);
+        buffer[11] = static_cast<uint8_t>((l >> 32) & 0xFF);
+        buffer[12] = static_cast<uint8_t>((l >> 24) & 0xFF);
+        buffer[13] = static_cast<uint8_t>((l >> 16) & 0xFF);
+        buffer[14] = static_cast<uint8_t>((l >> 8) & 0xFF);
+        buffer[15] = static_cast<uint8_t>(l & 0xFF);
+    }
+    else throw std::invalid_argument("omw::bigEndian::encode_128");
+}
+
+//!
+//! See \ref ns_omw_bigEndian_section_bulkFn.
+//!
+void omw::bigEndian::decode_i16(const uint8_t* src, int16_t* dst, size_t n)
+{
+    ::bigEndian_decodeBulk<uint16_t>(src, reinterpret_cast<uint16_t*>(dst), n, "omw::bigEndian::decode_i16");
+}
+
+//!
+//! See \ref ns_omw_bigEndian_section_bulkFn.
+//!
+void omw::bigEndian::decode_ui16(const uint8_t* src, uint16_t* dst, size_t n) { ::bigEndian_decodeBulk<uint16_t>(src, dst, n, "omw::bigEndian::decode_ui16"); }
+
+//!
+//! See \ref ns_omw_bigEndian_section_bulkFn.
+//!
+void omw::bigEndian::decode_i32(const uint8_t* src, int32_t* dst, size_t n)
+{
+    ::bigEndian_decodeBulk<uint32_t>(src, reinterpret_cast<uint32_t*>(dst), n, "omw::bigEndian::decode_i32");
+}
+
+//!
+//! See \ref ns_omw_bigEndian_section_bulkFn.
+//!
+void omw::bigEndian::decode_ui32(const uint8_t* src, uint32_t* dst, size_t n) { ::bigEndian_decodeBulk<uint32_t>(src, dst, n, "omw::bigEndian::decode_ui32"); }
+
+//!
+//! See \ref ns_omw_bigEndian_section_bulkFn.
+//!
+void omw::bigEndian::decode_i64(const uint8_t* src, int64_t* dst, size_t n)
+{
+    ::bigEndian_decodeBulk<uint64_t>(src, reinterpret_cast<uint64_t*>(dst), n, "omw::bigEndian::decode_i64");
+}
+
+//!
+//! See \ref ns_omw_bigEndian_section_bulkFn.
+//!
+void omw::bigEndian::decode_ui64(const uint8_t* src, uint64_t* dst, size_t n) { ::bigEndian_decodeBulk<uint64_t>(src, dst, n, "omw::bigEndian::decode_ui64"); }
+
+//!
+//! See \ref ns_omw_bigEndian_section_bulkFn.
+//!
+void omw::bigEndian::encode_16(uint8_t* dst, const int16_t* src, size_t n)
+{
+    ::bigEndian_encodeBulk<uint16_t>(dst, reinterpret_cast<const uint16_t*>(src), n, "omw::bigEndian::encode_16");
+}
+
+//!
+//! See \ref ns_omw_bigEndian_section_bulkFn.
+//!
+void omw::bigEndian::encode_16(uint8_t* dst, const uint16_t* src, size_t n) { ::bigEndian_encodeBulk<uint16_t>(dst, src, n, "omw::bigEndian::encode_16"); }
+
+//!
+//! See \ref ns_omw_bigEndian_section_bulkFn.
+//!
+void omw::bigEndian::encode_32(uint8_t* dst, const int32_t* src, size_t n)
+{
+    ::bigEndian_encodeBulk<uint32_t>(dst, reinterpret_cast<const uint32_t*>(src), n, "omw::bigEndian::encode_32");
+}
+
+//!
+//! See \ref ns_omw_bigEndian_section_bulkFn.
+//!
+void omw::bigEndian::encode_32(uint8_t* dst, const uint32_t* src, size_t n) { ::bigEndian_encodeBulk<uint32_t>(dst, src, n, "omw::bigEndian::encode_32"); }
+
+//!
+//! See \ref ns_omw_bigEndian_section_bulkFn.
+//!
+void omw::bigEndian::encode_64(uint8_t* dst, const int64_t* src, size_t n)
+{
+    ::bigEndian_encodeBulk<uint64_t>(dst, reinterpret_cast<const uint64_t*>(src), n, "omw::bigEndian::encode_64");
+}
+
+//!
+//! See \ref ns_omw_bigEndian_section_bulkFn.
+//!
+void omw::bigEndian::encode_64(uint8_t* dst, const uint64_t* src, size_t n) { ::bigEndian_encodeBulk<uint64_t>(dst, src, n, "omw::bigEndian::encode_64"); }
+
+
+
+/*!
+ * \namespace omw::littleEndian
+ *
+ * `#include <omw/encoding.h>`
+ *
+ * Same API as `omw::bigEndian`, with the least significant byte at the lowest address. On little endian hosts the full width functions
+ * and the bulk functions are plain memory copies.
+ *
+ * \section ns_omw_littleEndian_section_decodeFn Decode Functions
+ *
+ * \b Exceptions
+ * - `std::invalid_argument` if the data pointer is `NULL` or count equals zero
+ * - `std::overflow_error` if the number of bytes to be decoded is grater than the size of the return type
+ *
+ * \section ns_omw_littleEndian_section_encodeFn Encode Functions
+ *
+ * Writes the encoded value to `[buffer, buffer + sizeof(value))`.
+ *
+ * \b Exceptions
+ * - `std::invalid_argument` if the destination pointer is `NULL`
+ *
+ * \section ns_omw_littleEndian_section_bulkFn Bulk Functions
+ *
+ * Decode `n` values from `[src, src + n * sizeof(T))` to `dst`, or encode `n` values from `src` to `[dst, dst + n * sizeof(T))`. `src` and
+ * `dst` may point to the same memory (in place conversion), other overlaps are not allowed.
+ *
+ * \b Exceptions
+ * - `std::invalid_argument` if a pointer is `NULL` and `n` is not zero
+ */
+
+/*!
+ * \namespace omw::nativeEndian
+ *
+ * `#include <omw/encoding.h>`
+ *
+ * Alias of `omw::littleEndian` or `omw::bigEndian`, depending on the byte order of the target (see `OMW_BYTE_ORDER_LITTLE` and
+ * `OMW_BYTE_ORDER_BIG`). Not defined if the byte order is unknown.
+ */
+
 // Exceptions
 // - `std::invalid_argument`
 // - `std::overflow_error`
-template <typename T> T bigEndian_decodes(const uint8_t* data, size_t count, const std::string& fnName)
+template <typename T> T omw::internal::littleEndian_decode(const uint8_t* data, size_t count, const char* fnName)
+{
+    if (!data || (count == 0)) throw std::invalid_argument(fnName);
+    if (count > sizeof(T)) throw std::overflow_error(fnName);
+    if (count == sizeof(T)) return omw::internal::loadLE<T>(data);
+
+    T r = 0;
+    if (std::is_signed<T>::value && (data[count - 1] & 0x80)) r = static_cast<T>(-1);
+
+    for (size_t i = count; i > 0; --i)
+    {
+        omw::shiftLeftAssign(r, 8);
+        r |= static_cast<T>(data[i - 1]);
+    }
+
+    return r;
+}
+
+template int16_t omw::internal::littleEndian_decode<int16_t>(const uint8_t* data, size_t count, const char* fnName);
+template uint16_t omw::internal::littleEndian_decode<uint16_t>(const uint8_t* data, size_t count, const char* fnName);
+template int32_t omw::internal::littleEndian_decode<int32_t>(const uint8_t* data, size_t count, const char* fnName);
+template uint32_t omw::internal::littleEndian_decode<uint32_t>(const uint8_t* data, size_t count, const char* fnName);
+template int64_t omw::internal::littleEndian_decode<int64_t>(const uint8_t* data, size_t count, const char* fnName);
+template uint64_t omw::internal::littleEndian_decode<uint64_t>(const uint8_t* data, size_t count, const char* fnName);
+
+//!
+//! See \ref ns_omw_littleEndian_section_decodeFn.
+//!
+omw::int128_t omw::littleEndian::decode_i128(const uint8_t* data, size_t count)
+{
+    const char* const fnName = "omw::littleEndian::decode_i128";
+
+    omw::int128_t r;
+
+    if (data && count > 0)
+    {
+        if (count > 16) throw std::overflow_error(fnName);
+
+        if (count == 16) r.set(omw::internal::loadLE<uint64_t>(data + 8), omw::internal::loadLE<uint64_t>(data));
+        else
+        {
+            if (data[count - 1] & 0x80) r.sets(-1);
+            else r.setu(0);
+
+            for (size_t i = count; i > 0; --i)
+            {
+                r <<= 8;
+                r |= omw::int128_t(0, data[i - 1]);
+            }
+        }
+    }
+    else throw std::invalid_argument(fnName);
+
+    return r;
+}
+
+//!
+//! See \ref ns_omw_littleEndian_section_decodeFn.
+//!
+omw::uint128_t omw::littleEndian::decode_ui128(const uint8_t* data, size_t count)
+{
+    const char* const fnName = "omw::littleEndian::decode_ui128";
+
+    omw::uint128_t r;
+
+    if (data && count > 0)
+    {
+        if (count > 16) throw std::overflow_error(fnName);
+
+        if (count == 16) r.set(omw::internal::loadLE<uint64_t>(data + 8), omw::internal::loadLE<uint64_t>(data));
+        else
+        {
+            r.setu(0);
+
+            for (size_t i = count; i > 0; --i)
+            {
+                r <<= 8;
+                r |= omw::uint128_t(0, data[i - 1]);
+            }
+        }
+    }
+    else throw std::invalid_argument(fnName);
+
+    return r;
+}
+
+//!
+//! See \ref ns_omw_littleEndian_section_encodeFn.
+//!
+void omw::littleEndian::encode_16(uint8_t* buffer, int16_t value) { omw::littleEndian::encode_16(buffer, static_cast<uint16_t>(value)); }
+
+//!
+//! See \ref ns_omw_littleEndian_section_encodeFn.
+//!
+void omw::littleEndian::encode_16(uint8_t* buffer, uint16_t value)
+{
+    if (buffer) omw::internal::storeLE<uint16_t>(buffer, value);
+    else throw std::invalid_argument("omw::littleEndian::encode_16");
+}
+
+//!
+//! See \ref ns_omw_littleEndian_section_encodeFn.
+//!
+void omw::littleEndian::encode_32(uint8_t* buffer, int32_t value) { omw::littleEndian::encode_32(buffer, static_cast<uint32_t>(value)); }
+
+//!
+//! See \ref ns_omw_littleEndian_section_encodeFn.
+//!
+void omw::littleEndian::encode_32(uint8_t* buffer, uint32_t value)
+{
+    if (buffer) omw::internal::storeLE<uint32_t>(buffer, value);
+    else throw std::invalid_argument("omw::littleEndian::encode_32");
+}
+
+//!
+//! See \ref ns_omw_littleEndian_section_encodeFn.
+//!
+void omw::littleEndian::encode_64(uint8_t* buffer, int64_t value) { omw::littleEndian::encode_64(buffer, static_cast<uint64_t>(value)); }
+
+//!
+//! See \ref ns_omw_littleEndian_section_encodeFn.
+//!
+void omw::littleEndian::encode_64(uint8_t* buffer, uint64_t value)
+{
+    if (buffer) omw::internal::storeLE<uint64_t>(buffer, value);
+    else throw std::invalid_argument("omw::littleEndian::encode_64");
+}
+
+//!
+//! See \ref ns_omw_littleEndian_section_encodeFn.
+//!
+void omw::littleEndian::encode_128(uint8_t* buffer, const omw::Base_Int128& value)
+{
+    if (buffer)
+    {
+        omw::internal::storeLE<uint64_t>(buffer, value.lo());
+        omw::internal::storeLE<uint64_t>(buffer + 8, value.hi());
+    }
+    else throw std::invalid_argument("omw::littleEndian::encode_128");
+}
+
+//!
+//! See \ref ns_omw_littleEndian_section_bulkFn.
+//!
+void omw::littleEndian::decode_i16(const uint8_t* src, int16_t* dst, size_t n)
+{
+    ::littleEndian_decodeBulk<uint16_t>(src, reinterpret_cast<uint16_t*>(dst), n, "omw::littleEndian::decode_i16");
+}
+
+//!
+//! See \ref ns_omw_littleEndian_section_bulkFn.
+//!
+void omw::littleEndian::decode_ui16(const uint8_t* src, uint16_t* dst, size_t n)
+{
+    ::littleEndian_decodeBulk<uint16_t>(src, dst, n, "omw::littleEndian::decode_ui16");
+}
+
+//!
+//! See \ref ns_omw_littleEndian_section_bulkFn.
+//!
+void omw::littleEndian::decode_i32(const uint8_t* src, int32_t* dst, size_t n)
+{
+    ::littleEndian_decodeBulk<uint32_t>(src, reinterpret_cast<uint32_t*>(dst), n, "omw::littleEndian::decode_i32");
+}
+
+//!
+//! See \ref ns_omw_littleEndian_section_bulkFn.
+//!
+void omw::littleEndian::decode_ui32(const uint8_t* src, uint32_t* dst, size_t n)
+{
+    ::littleEndian_decodeBulk<uint32_t>(src, dst, n, "omw::littleEndian::decode_ui32");
+}
+
+//!
+//! See \ref ns_omw_littleEndian_section_bulkFn.
+//!
+void omw::littleEndian::decode_i64(const uint8_t* src, int64_t* dst, size_t n)
+{
+    ::littleEndian_decodeBulk<uint64_t>(src, reinterpret_cast<uint64_t*>(dst), n, "omw::littleEndian::decode_i64");
+}
+
+//!
+//! See \ref ns_omw_littleEndian_section_bulkFn.
+//!
+void omw::littleEndian::decode_ui64(const uint8_t* src, uint64_t* dst, size_t n)
+{
+    ::littleEndian_decodeBulk<uint64_t>(src, dst, n, "omw::littleEndian::decode_ui64");
+}
+
+//!
+//! See \ref ns_omw_littleEndian_section_bulkFn.
+//!
+void omw::littleEndian::encode_16(uint8_t* dst, const int16_t* src, size_t n)
+{
+    ::littleEndian_encodeBulk<uint16_t>(dst, reinterpret_cast<const uint16_t*>(src), n, "omw::littleEndian::encode_16");
+}
+
+//!
+//! See \ref ns_omw_littleEndian_section_bulkFn.
+//!
+void omw::littleEndian::encode_16(uint8_t* dst, const uint16_t* src, size_t n)
+{
+    ::littleEndian_encodeBulk<uint16_t>(dst, src, n, "omw::littleEndian::encode_16");
+}
+
+//!
+//! See \ref ns_omw_littleEndian_section_bulkFn.
+//!
+void omw::littleEndian::encode_32(uint8_t* dst, const int32_t* src, size_t n)
 {
-    T r;
+    ::littleEndian_encodeBulk<uint32_t>(dst, reinterpret_cast<const uint32_t*>(src), n, "omw::littleEndian::encode_32");
+}
 
-    if (data && count > 0)
-    {
-        if (data[0] & 0x80) r = -1;
-        else r = 0;
+//!
+//! See \ref ns_omw_littleEndian_section_bulkFn.
+//!
+void omw::littleEndian::encode_32(uint8_t* dst, const uint32_t* src, size_t n)
+{
+    ::littleEndian_encodeBulk<uint32_t>(dst, src, n, "omw::littleEndian::encode_32");
+}
 
-        if (count > sizeof(T)) throw std::overflow_error(fnName);
+//!
+//! See \ref ns_omw_littleEndian_section_bulkFn.
+//!
+void omw::littleEndian::encode_64(uint8_t* dst, const int64_t* src, size_t n)
+{
+    ::littleEndian_encodeBulk<uint64_t>(dst, reinterpret_cast<const uint64_t*>(src), n, "omw::littleEndian::encode_64");
+}
 
-        for (size_t i = 0; i < count; ++i)
-        {
-            omw::shiftLeftAssign(r, 8);
-            r |= static_cast<T>(data[i]);
-        }
-    }
-    else throw std::invalid_argument(fnName);
+//!
+//! See \ref ns_omw_littleEndian_section_bulkFn.
+//!
+void omw::littleEndian::encode_64(uint8_t* dst, const uint64_t* src, size_t n)
+{
+    ::littleEndian_encodeBulk<uint64_t>(dst, src, n, "omw::littleEndian::encode_64");
+}
 
-    return r;
+
+
+/*!
+ * \class omw::ByteReader
+ *
+ * `#include <omw/encoding.h>`
+ *
+ * Reading cursor over a non-owning byte buffer, the buffer has to outlive the reader. Every read advances the position by the number of
+ * consumed bytes.
+ *
+ * The typed reads `getBE<T>()` and `getLE<T>()` support the integral types (except `bool`), `omw::int128_t` and `omw::uint128_t`. The
+ * overloads with reference parameters read several values in one go with a single bounds check:
+ *
+ * ```
+ * omw::ByteReader reader(packet);
+ * uint8_t type;
+ * uint16_t id;
+ * uint32_t timestamp;
+ * reader.getBE(type, id, timestamp);
+ * const std::string name = reader.getStringBE<uint8_t>(); // uint8_t length prefix
+ * ```
+ *
+ * Varints are unsigned LEB128 (7 bits per byte, least significant group first, MSB set if more bytes follow) as used by Protocol Buffers.
+ *
+ * If a function throws, the position is not changed.
+ *
+ * \b Exceptions
+ * - `std::invalid_argument` if the data pointer passed to the constructor is `NULL` and size is not zero
+ * - `std::out_of_range` if there are not enough remaining bytes, or by `seek()` if `pos` is greater than `size()`
+ * - `std::overflow_error` by `getVarint()` if the encoded value doesn't fit into 64 bits
+ */
+
+omw::ByteReader::ByteReader()
+    : m_data(nullptr), m_size(0), m_pos(0)
+{}
+
+omw::ByteReader::ByteReader(const uint8_t* data, size_t size)
+    : m_data(data), m_size(size), m_pos(0)
+{
+    if (!data && (size > 0)) throw std::invalid_argument("omw::ByteReader::ByteReader");
 }
 
-// Exceptions
-// - `std::invalid_argument`
-// - `std::overflow_error`
-template <typename T> T bigEndian_decodeu(const uint8_t* data, size_t count, const std::string& fnName)
+omw::ByteReader::ByteReader(const std::vector<uint8_t>& data)
+    : m_data(data.data()), m_size(data.size()), m_pos(0)
+{}
+
+void omw::ByteReader::seek(size_t pos)
 {
-    T r;
+    if (pos > m_size) throw std::out_of_range("omw::ByteReader::seek");
+    m_pos = pos;
+}
 
-    if (data && count > 0)
-    {
-        r = 0;
+void omw::ByteReader::skip(size_t count) { m_take(count, "omw::ByteReader::skip"); }
 
-        if (count > sizeof(T)) throw std::overflow_error(fnName);
+//! Returns a pointer to the next `count` bytes and advances the position, no data is copied.
+const uint8_t* omw::ByteReader::getBytes(size_t count) { return m_take(count, "omw::ByteReader::getBytes"); }
 
-        for (size_t i = 0; i < count; ++i)
-        {
-            omw::shiftLeftAssign(r, 8);
-            r |= static_cast<T>(data[i]);
-        }
-    }
-    else throw std::invalid_argument(fnName);
+//! Returns a reader over the next `count` bytes (e.g. a length delimited section) and advances the position of this reader past them.
+omw::ByteReader omw::ByteReader::getReader(size_t count) { return omw::ByteReader(m_take(count, "omw::ByteReader::getReader"), count); }
+
+std::string omw::ByteReader::getString(size_t count)
+{
+    const uint8_t* const p = m_take(count, "omw::ByteReader::getString");
+    return std::string(reinterpret_cast<const char*>(p), count);
+}
+
+//! Reads a string with a varint length prefix.
+std::string omw::ByteReader::getStringVarint()
+{
+    const size_t start = m_pos;
+    return m_getString(start, getVarint(), "omw::ByteReader::getStringVarint");
+}
+
+//! See `omw::varint::decode_ui64()`.
+uint64_t omw::ByteReader::getVarint()
+{
+    if (atEnd()) throw std::out_of_range("omw::ByteReader::getVarint");
+
+    size_t length;
+    const uint64_t r = omw::varint::decode_ui64(m_data + m_pos, remaining(), &length);
+    m_pos += length;
 
     return r;
 }
 
-} // namespace
+std::string omw::ByteReader::m_getString(size_t start, uint64_t count, const char* fnName)
+{
+    if (count > remaining())
+    {
+        m_pos = start;
+        throw std::out_of_range(fnName);
+    }
+
+    return getString(count);
+}
 
 
 
-/* !
- * \namespace omw::bcd
+/*!
+ * \class omw::ByteWriter
  *
  * `#include <omw/encoding.h>`
  *
- * Converts between BCD formated byte buffers and their integral values.
+ * Writing cursor over a non-owning byte buffer of fixed size, the buffer has to outlive the writer. Same types and encodings as
+ * `omw::ByteReader`. The vector constructor writes into the existing elements of the vector, it's size is not changed.
+ *
+ * `putBE()` and `putLE()` take one or more values which are written with a single bounds check. Note that the type of the arguments
+ * determines the encoded width (`putBE(1)` writes an `int`), use typed variables or explicit template arguments.
+ *
+ * ```
+ * std::vector<uint8_t> packet(64);
+ * omw::ByteWriter writer(packet);
+ * writer.putBE<uint8_t, uint16_t>(type, id);
+ * writer.putStringBE<uint8_t>(name);
+ * packet.resize(writer.pos());
+ * ```
+ *
+ * If a function throws, the position is not changed and nothing has been written.
+ *
+ * \b Exceptions
+ * - `std::invalid_argument` if the data pointer passed to the constructor is `NULL` and size is not zero
+ * - `std::out_of_range` if there is not enough space remaining, or by `seek()` if `pos` is greater than `size()`
+ * - `std::overflow_error` by `putStringBE()` and `putStringLE()` if the string length doesn't fit into the length prefix type
  */
 
+omw::ByteWriter::ByteWriter()
+    : m_data(nullptr), m_size(0), m_pos(0)
+{}
+
+omw::ByteWriter::ByteWriter(uint8_t* data, size_t size)
+    : m_data(data), m_size(size), m_pos(0)
+{
+    if (!data && (size > 0)) throw std::invalid_argument("omw::ByteWriter::ByteWriter");
+}
+
+omw::ByteWriter::ByteWriter(std::vector<uint8_t>& data)
+    : m_data(data.data()), m_size(data.size()), m_pos(0)
+{}
+
+void omw::ByteWriter::seek(size_t pos)
+{
+    if (pos > m_size) throw std::out_of_range("omw::ByteWriter::seek");
+    m_pos = pos;
+}
+
+//! Advances the position by `count` bytes, the skipped bytes are left untouched.
+void omw::ByteWriter::skip(size_t count) { m_take(count, "omw::ByteWriter::skip"); }
+
+void omw::ByteWriter::putBytes(const uint8_t* data, size_t count)
+{
+    if (!data && (count > 0)) throw std::invalid_argument("omw::ByteWriter::putBytes");
+    if (count > 0) std::memcpy(m_take(count, "omw::ByteWriter::putBytes"), data, count);
+}
+
+//! Writes the characters of the string, without length prefix or null terminator.
+void omw::ByteWriter::putString(const std::string& str)
+{
+    if (!str.empty()) std::memcpy(m_take(str.length(), "omw::ByteWriter::putString"), str.data(), str.length());
+}
+
+//! Writes the string with a varint length prefix.
+void omw::ByteWriter::putStringVarint(const std::string& str)
+{
+    uint8_t prefix[omw::varint::maxSize64];
+    const size_t n = omw::varint::encode_64(prefix, str.length());
+
+    if ((n + str.length()) > remaining()) throw std::out_of_range("omw::ByteWriter::putStringVarint");
+
+    putBytes(prefix, n);
+    putString(str);
+}
+
+void omw::ByteWriter::putVarint(uint64_t value)
+{
+    uint8_t buffer[omw::varint::maxSize64];
+    const size_t n = omw::varint::encode_64(buffer, value);
+    std::memcpy(m_take(n, "omw::ByteWriter::putVarint"), buffer, n);
+}
+
 
 
 /*!
- * \namespace omw::bigEndian
+ * \namespace omw::varint
  *
  * `#include <omw/encoding.h>`
  *
- * \section ns_omw_bigEndian_section_decodeFn Decode Functions
+ * Variable length integers, unsigned LEB128 (7 bits per byte, least significant group first, MSB set if more bytes follow) as used by
+ * Protocol Buffers, DWARF and WebAssembly. Signed values are ZigZag encoded (`0, -1, 1, -2, ...` map to `0, 1, 2, 3, ...`) so that small
+ * magnitudes result in short encodings.
+ *
+ * \section ns_omw_varint_section_decodeFn Decode Functions
+ *
+ * Decode one value from `[data, data + count)`. If `length` is not `NULL`, the number of consumed bytes is written to it.
  *
  * \b Exceptions
  * - `std::invalid_argument` if the data pointer is `NULL` or count equals zero
- * - `std::overflow_error` if the number of bytes to be decoded is grater than the size of the return type
+ * - `std::out_of_range` if the varint is not terminated within `count` bytes
+ * - `std::overflow_error` if the value doesn't fit into the return type
  *
- * \section ns_omw_bigEndian_section_encodeFn Encode Functions
+ * \section ns_omw_varint_section_encodeFn Encode Functions
  *
- * Writes the encoded value to `[buffer, buffer + sizeof(value))`.
+ * Write the encoded value to `buffer` and return the number of written bytes. The buffer has to be at least `maxSize32`, `maxSize64` or
+ * `maxSize128` bytes big.
  *
  * \b Exceptions
  * - `std::invalid_argument` if the destination pointer is `NULL`
+ *
+ * \section ns_omw_varint_section_bulkFn Bulk Functions
+ *
+ * Decode `n` consecutive varints from `[src, src + count)` to `dst`, return the number of consumed bytes. On x86-64 with SSSE3 (detected at
+ * runtime) the values are decoded with the Masked VByte algorithm, up to 16 values per step.
+ *
+ * \b Exceptions
+ * - `std::invalid_argument` if `src` is `NULL` and `count` is not zero, or `dst` is `NULL` and `n` is not zero
+ * - `std::out_of_range` if the input ends before `n` values are decoded
+ * - `std::overflow_error` if a value doesn't fit into the destination type
  */
 
-//!
-//! See \ref ns_omw_bigEndian_section_decodeFn.
-//!
-int16_t omw::bigEndian::decode_i16(const uint8_t* data, size_t count) { return ::bigEndian_decodes<int16_t>(data, count, "omw::bigEndian::decode_i16"); }
-
-//!
-//! See \ref ns_omw_bigEndian_section_decodeFn.
-//!
-uint16_t omw::bigEndian::decode_ui16(const uint8_t* data, size_t count) { return ::bigEndian_decodeu<uint16_t>(data, count, "omw::bigEndian::decode_ui16"); }
-
-//!
-//! See \ref ns_omw_bigEndian_section_decodeFn.
-//!
-int32_t omw::bigEndian::decode_i32(const uint8_t* data, size_t count) { return ::bigEndian_decodes<int32_t>(data, count, "omw::bigEndian::decode_i32"); }
+omw::uint128_t omw::varint::zigzagEncode(const omw::int128_t& value)
+{
+    const uint64_t m = (value.isNegative() ? UINT64_MAX : 0);
+    return omw::uint128_t(((value.hi() << 1) | (value.lo() >> 63)) ^ m, (value.lo() << 1) ^ m);
+}
 
-//!
-//! See \ref ns_omw_bigEndian_section_decodeFn.
-//!
-uint32_t omw::bigEndian::decode_ui32(const uint8_t* data, size_t count) { return ::bigEndian_decodeu<uint32_t>(data, count, "omw::bigEndian::decode_ui32"); }
+omw::int128_t omw::varint::zigzagDecode(const omw::uint128_t& value)
+{
+    const uint64_t m = ((value.lo() & 1) ? UINT64_MAX : 0);
+    return omw::int128_t((value.hi() >> 1) ^ m, ((value.lo() >> 1) | (value.hi() << 63)) ^ m);
+}
 
 //!
-//! See \ref ns_omw_bigEndian_section_decodeFn.
+//! See \ref ns_omw_varint_section_decodeFn.
 //!
-int64_t omw::bigEndian::decode_i64(const uint8_t* data, size_t count) { return ::bigEndian_decodes<int64_t>(data, count, "omw::bigEndian::decode_i64"); }
+uint32_t omw::varint::decode_ui32(const uint8_t* data, size_t count, size_t* length)
+{
+    return ::varint_decode<uint32_t>(data, count, length, "omw::varint::decode_ui32");
+}
 
 //!
-//! See \ref ns_omw_bigEndian_section_decodeFn.
+//! See \ref ns_omw_varint_section_decodeFn.
 //!
-uint64_t omw::bigEndian::decode_ui64(const uint8_t* data, size_t count) { return ::bigEndian_decodeu<uint64_t>(data, count, "omw::bigEndian::decode_ui64"); }
+uint64_t omw::varint::decode_ui64(const uint8_t* data, size_t count, size_t* length)
+{
+    return ::varint_decode<uint64_t>(data, count, length, "omw::varint::decode_ui64");
+}
 
 //!
-//! See \ref ns_omw_bigEndian_section_decodeFn.
+//! See \ref ns_omw_varint_section_decodeFn.
 //!
-omw::int128_t omw::bigEndian::decode_i128(const uint8_t* data, size_t count)
+omw::uint128_t omw::varint::decode_ui128(const uint8_t* data, size_t count, size_t* length)
 {
-    const char* const fnName = "omw::bigEndian::decode_i128";
+    const char* const fnName = "omw::varint::decode_ui128";
 
-    omw::int128_t r;
+    if (!data || (count == 0)) throw std::invalid_argument(fnName);
 
-    if (data && count > 0)
+    uint64_t h = 0;
+    uint64_t l = 0;
+
+    for (size_t i = 0; i < count; ++i)
     {
-        if (data[0] & 0x80) r.sets(-1);
-        else r.setu(0);
+        const unsigned shift = static_cast<unsigned>(7 * i);
+        const uint64_t b = data[i];
+        const uint64_t group = (b & 0x7F);
 
-        if (count > 16) throw std::overflow_error(fnName);
+        if ((shift >= 128) || ((shift == 126) && (group > 3))) throw std::overflow_error(fnName);
 
-        for (size_t i = 0; i < count; ++i)
+        if (shift < 64)
         {
-            r <<= 8;
-            r |= omw::int128_t(0, data[i]);
+            l |= (group << shift);
+            if (shift > 57) h |= (group >> (64 - shift));
+        }
+        else h |= (group << (shift - 64));
+
+        if ((b & 0x80) == 0)
+        {
+            if (length) *length = i + 1;
+            return omw::uint128_t(h, l);
         }
     }
-    else throw std::invalid_argument(fnName);
 
-    return r;
+    throw std::out_of_range(fnName);
 }
 
 //!
-//! See \ref ns_omw_bigEndian_section_decodeFn.
+//! See \ref ns_omw_varint_section_decodeFn.
 //!
-omw::uint128_t omw::bigEndian::decode_ui128(const uint8_t* data, size_t count)
+int32_t omw::varint::decodeZigzag_i32(const uint8_t* data, size_t count, size_t* length)
 {
-    const char* const fnName = "omw::bigEndian::decode_ui128";
-
-    omw::uint128_t r;
-
-    if (data && count > 0)
-    {
-        r.setu(0);
-
-        if (count > 16) throw std::overflow_error(fnName);
+    return omw::varint::zigzagDecode(::varint_decode<uint32_t>(data, count, length, "omw::varint::decodeZigzag_i32"));
+}
 
-        for (size_t i = 0; i < count; ++i)
-        {
-            r <<= 8;
-            r |= omw::uint128_t(0, data[i]);
-        }
-    }
-    else throw std::invalid_argument(fnName);
+//!
+//! See \ref ns_omw_varint_section_decodeFn.
+//!
+int64_t omw::varint::decodeZigzag_i64(const uint8_t* data, size_t count, size_t* length)
+{
+    return omw::varint::zigzagDecode(::varint_decode<uint64_t>(data, count, length, "omw::varint::decodeZigzag_i64"));
+}
 
-    return r;
+//!
+//! See \ref ns_omw_varint_section_decodeFn.
+//!
+omw::int128_t omw::varint::decodeZigzag_i128(const uint8_t* data, size_t count, size_t* length)
+{
+    return omw::varint::zigzagDecode(omw::varint::decode_ui128(data, count, length));
 }
 
 //!
-//! See \ref ns_omw_bigEndian_section_encodeFn.
+//! See \ref ns_omw_varint_section_encodeFn.
 //!
-void omw::bigEndian::encode_16(uint8_t* buffer, int16_t value) { omw::bigEndian::encode_16(buffer, static_cast<uint16_t>(value)); }
+size_t omw::varint::encode_32(uint8_t* buffer, uint32_t value) { return ::varint_encode<uint32_t>(buffer, value, "omw::varint::encode_32"); }
 
 //!
-//! See \ref ns_omw_bigEndian_section_encodeFn.
+//! See \ref ns_omw_varint_section_encodeFn.
 //!
-void omw::bigEndian::encode_16(uint8_t* buffer, uint16_t value)
+size_t omw::varint::encode_64(uint8_t* buffer, uint64_t value) { return ::varint_encode<uint64_t>(buffer, value, "omw::varint::encode_64"); }
+
+//!
+//! See \ref ns_omw_varint_section_encodeFn.
+//!
+size_t omw::varint::encode_128(uint8_t* buffer, const omw::uint128_t& value)
 {
-    if (buffer)
+    if (!buffer) throw std::invalid_argument("omw::varint::encode_128");
+
+    uint64_t h = value.hi();
+    uint64_t l = value.lo();
+    size_t n = 0;
+
+    while (h || (l >= 0x80))
     {
-        buffer[0] = static_cast<uint8_t>((value >> 8) & 0xFF);
-        buffer[1] = static_cast<uint8_t>(value & 0xFF);
+        buffer[n++] = static_cast<uint8_t>(l | 0x80);
+        l = (l >> 7) | (h << 57);
+        h >>= 7;
     }
-    else throw std::invalid_argument("omw::bigEndian::encode_16");
+    buffer[n++] = static_cast<uint8_t>(l);
+
+    return n;
 }
 
 //!
-//! See \ref ns_omw_bigEndian_section_encodeFn.
+//! See \ref ns_omw_varint_section_encodeFn.
 //!
-void omw::bigEndian::encode_32(uint8_t* buffer, int32_t value) { omw::bigEndian::encode_32(buffer, static_cast<uint32_t>(value)); }
+size_t omw::varint::encodeZigzag_32(uint8_t* buffer, int32_t value)
+{
+    return ::varint_encode<uint32_t>(buffer, omw::varint::zigzagEncode(value), "omw::varint::encodeZigzag_32");
+}
 
 //!
-//! See \ref ns_omw_bigEndian_section_encodeFn.
+//! See \ref ns_omw_varint_section_encodeFn.
 //!
-void omw::bigEndian::encode_32(uint8_t* buffer, uint32_t value)
+size_t omw::varint::encodeZigzag_64(uint8_t* buffer, int64_t value)
 {
-    if (buffer)
-    {
-        buffer[0] = static_cast<uint8_t>((value >> 24) & 0xFF);
-        buffer[1] = static_cast<uint8_t>((value >> 16) & 0xFF);
-        buffer[2] = static_cast<uint8_t>((value >> 8) & 0xFF);
-        buffer[3] = static_cast<uint8_t>(value & 0xFF);
-    }
-    else throw std::invalid_argument("omw::bigEndian::encode_32");
+    return ::varint_encode<uint64_t>(buffer, omw::varint::zigzagEncode(value), "omw::varint::encodeZigzag_64");
 }
 
 //!
-//! See \ref ns_omw_bigEndian_section_encodeFn.
+//! See \ref ns_omw_varint_section_encodeFn.
 //!
-void omw::bigEndian::encode_64(uint8_t* buffer, int64_t value) { omw::bigEndian::encode_64(buffer, static_cast<uint64_t>(value)); }
+size_t omw::varint::encodeZigzag_128(uint8_t* buffer, const omw::int128_t& value)
+{
+    if (!buffer) throw std::invalid_argument("omw::varint::encodeZigzag_128");
+    return omw::varint::encode_128(buffer, omw::varint::zigzagEncode(value));
+}
 
 //!
-//! See \ref ns_omw_bigEndian_section_encodeFn.
+//! See \ref ns_omw_varint_section_bulkFn.
 //!
-void omw::bigEndian::encode_64(uint8_t* buffer, uint64_t value)
+size_t omw::varint::decode_ui32(const uint8_t* src, size_t count, uint32_t* dst, size_t n)
 {
-    if (buffer)
-    {
-        buffer[0] = static_cast<uint8_t>((value >> 56) & 0xFF);
-        buffer[1] = static_cast<uint8_t>((value >> 48) & 0xFF);
-        buffer[2] = static_cast<uint8_t>((value >> 40) & 0xFF);
-        buffer[3] = static_cast<uint8_t>((value >> 32) & 0xFF);
-        buffer[4] = static_cast<uint8_t>((value >> 24) & 0xFF);
-        buffer[5] = static_cast<uint8_t>((value >> 16) & 0xFF);
-        buffer[6] = static_cast<uint8_t>((value >> 8) & 0xFF);
-        buffer[7] = static_cast<uint8_t>(value & 0xFF);
-    }
-    else throw std::invalid_argument("omw::bigEndian::encode_64");
+    return ::varint_decodeBulk<uint32_t>(src, count, dst, n, "omw::varint::decode_ui32");
 }
 
 //!
-//! See \ref ns_omw_bigEndian_section_encodeFn.
+//! See \ref ns_omw_varint_section_bulkFn.
 //!
-void omw::bigEndian::encode_128(uint8_t* buffer, const omw::Base_Int128& value)
+size_t omw::varint::decode_ui64(const uint8_t* src, size_t count, uint64_t* dst, size_t n)
 {
-    if (buffer)
-    {
-        const uint64_t h = value.hi();
-        const uint64_t l = value.lo();
+    return ::varint_decodeBulk<uint64_t>(src, count, dst, n, "omw::varint::decode_ui64");
+}
 
-        buffer[0] = static_cast<uint8_t>((h >> 56) & 0xFF);
-        buffer[1] = static_cast<uint8_t>((h >> 48) & 0xFF);
-        buffer[2] = static_cast<uint8_t>((h >> 40) & 0xFF);
-        buffer[3] = static_cast<uint8_t>((h >> 32) & 0xFF);
-        buffer[4] = static_cast<uint8_t>((h >> 24) & 0xFF);
-        buffer[5] = static_cast<uint8_t>((h >> 16) & 0xFF);
-        buffer[6] = static_cast<uint8_t>((h >> 8) & 0xFF);
-        buffer[7] = static_cast<uint8_t>(h & 0xFF);
+//!
+//! See \ref ns_omw_varint_section_bulkFn.
+//!
+size_t omw::varint::decodeZigzag_i32(const uint8_t* src, size_t count, int32_t* dst, size_t n)
+{
+    uint32_t* const u = reinterpret_cast<uint32_t*>(dst);
+    const size_t r = ::varint_decodeBulk<uint32_t>(src, count, u, n, "omw::varint::decodeZigzag_i32");
+    for (size_t i = 0; i < n; ++i) dst[i] = omw::varint::zigzagDecode(u[i]);
+    return r;
+}
 
-        buffer[8] = static_cast<uint8_t>((l >> 56) & 0xFF);
-        buffer[9] = static_cast<uint8_t>((l >> 48) & 0xFF);
-        buffer[10] = static_cast<uint8_t>((l >> 40) & 0xFF);
-        buffer[11] = static_cast<uint8_t>((l >> 32) & 0xFF);
-        buffer[12] = static_cast<uint8_t>((l >> 24) & 0xFF);
-        buffer[13] = static_cast<uint8_t>((l >> 16) & 0xFF);
-        buffer[14] = static_cast<uint8_t>((l >> 8) & 0xFF);
-        buffer[15] = static_cast<uint8_t>(l & 0xFF);
-    }
-    else throw std::invalid_argument("omw::bigEndian::encode_128");
+//!
+//! See \ref ns_omw_varint_section_bulkFn.
+//!
+size_t omw::varint::decodeZigzag_i64(const uint8_t* src, size_t count, int64_t* dst, size_t n)
+{
+    uint64_t* const u = reinterpret_cast<uint64_t*>(dst);
+    const size_t r = ::varint_decodeBulk<uint64_t>(src, count, u, n, "omw::varint::decodeZigzag_i64");
+    for (size_t i = 0; i < n; ++i) dst[i] = omw::varint::zigzagDecode(u[i]);
+    return r;
 }
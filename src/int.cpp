@@ -4,35 +4,73 @@ date            27.01.2022
 copyright       MIT - Copyright (c) 2022 Oliver Blaser
 */
 
-/*
- * Operator Implementation Philosophy
- *
- * Operators declared inside a class do not use any other overloaded
- * operators. Operators declared outside a class do not use each
- * other (except comparsion operators), but can use operators declared
- * inside a class.
- */
-
 #include <stdexcept>
 
+#include "cpuFeatures.h"
 #include "omw/int.h"
 #include "omw/intdef.h"
 
 
 namespace {
 
-typedef uint64_t base_type;
-static constexpr unsigned int baseTypeWith = 64;
-static constexpr base_type baseTypeAllBits = OMW_64BIT_ALL;
-static constexpr base_type baseTypeMSB = OMW_64BIT_MSB;
-static constexpr unsigned int bitWidth = 128;
-
 static constexpr size_t nBytes128 = 16; // 16 * 8 bit = 128 bit
 
 int64_t to_i64(uint64_t value) noexcept { return *(reinterpret_cast<int64_t*>(&value)); }
-uint64_t to_ui64(int64_t value) noexcept { return *(reinterpret_cast<uint64_t*>(&value)); }
 uint32_t to_ui32(int32_t value) noexcept { return *(reinterpret_cast<uint32_t*>(&value)); }
 
+omw::uint128_t abs128(const omw::Base_Int128& value)
+{
+    omw::uint128_t r(value);
+    if (r.hi() & OMW_64BIT_MSB) r = -r;
+    return r;
+}
+
+// truncates towards zero, the remainder has the sign of `a`
+void sdivmod(const omw::Base_Int128& a, const omw::Base_Int128& b, omw::int128_t& quot, omw::int128_t& rem)
+{
+    const bool negA = ((a.hi() & OMW_64BIT_MSB) != 0);
+    const bool negQ = (negA != ((b.hi() & OMW_64BIT_MSB) != 0));
+    const omw::uint128_t ua = abs128(a);
+    const omw::uint128_t ub = abs128(b);
+
+    uint64_t qh, ql, rh, rl;
+    omw::internal::int128::udivmod(ua.hi(), ua.lo(), ub.hi(), ub.lo(), qh, ql, rh, rl);
+
+    quot.set(qh, ql);
+    rem.set(rh, rl);
+    if (negQ) quot = -quot;
+    if (negA) rem = -rem;
+}
+
+// the truncated product is written to `h` and `l`
+bool umulOverflow(const omw::Base_Int128& a, const omw::Base_Int128& b, uint64_t& h, uint64_t& l)
+{
+#ifdef OMW_INT128_NATIVE
+    using namespace omw::internal::int128;
+    native_u128 r;
+    const bool ovf = __builtin_mul_overflow(join(a.hi(), a.lo()), join(b.hi(), b.lo()), &r);
+    split(r, h, l);
+    return ovf;
+#else
+    uint64_t c1h, c1l, c2h, c2l;
+
+    omw::internal::int128::mul64(a.lo(), b.lo(), h, l);
+    omw::internal::int128::mul64(a.hi(), b.lo(), c1h, c1l);
+    omw::internal::int128::mul64(a.lo(), b.hi(), c2h, c2l);
+
+    bool ovf = (((a.hi() != 0) && (b.hi() != 0)) || (c1h != 0) || (c2h != 0));
+
+    const uint64_t cross = c1l + c2l;
+    if (cross < c1l) ovf = true;
+
+    const uint64_t hOld = h;
+    h += cross;
+    if (h < hOld) ovf = true;
+
+    return ovf;
+#endif
+}
+
 void quad_ui32_to_128(uint64_t& h, uint64_t& l, uint32_t valueHH, uint32_t valueLH, uint32_t valueHL, uint32_t valueLL)
 {
     h = valueHH;
@@ -52,63 +90,17 @@ void quad_i32_to_128(uint64_t& h, uint64_t& l, int32_t valueHH, uint32_t valueLH
 } // namespace
 
 
-omw::Base_Int128::Base_Int128()
-    : m_h(0), m_l(0)
-{}
-
-omw::Base_Int128::Base_Int128(const omw::Base_Int128& other)
-    : m_h(0), m_l(0)
-{
-    m_copy(other);
-}
-
-//!
-//! Uses `omw::Base_Int128::sets(int64_t)` to initialize.
-//!
-omw::Base_Int128::Base_Int128(int64_t value)
-    : m_h(0), m_l(0)
-{
-    sets(value);
-}
-
-omw::Base_Int128::Base_Int128(uint64_t valueH, uint64_t valueL)
-    : m_h(valueH), m_l(valueL)
-{}
-
 omw::Base_Int128::Base_Int128(uint32_t valueHH, uint32_t valueLH, uint32_t valueHL, uint32_t valueLL)
     : m_h(0), m_l(0)
 {
     set(valueHH, valueLH, valueHL, valueLL);
 }
 
-void omw::Base_Int128::set(uint64_t valueH, uint64_t valueL)
-{
-    m_h = valueH;
-    m_l = valueL;
-}
-
 void omw::Base_Int128::set(uint32_t valueHH, uint32_t valueLH, uint32_t valueHL, uint32_t valueLL)
 {
     quad_ui32_to_128(m_h, m_l, valueHH, valueLH, valueHL, valueLL);
 }
 
-//!
-//! Extends the sign bit.
-//!
-void omw::Base_Int128::sets(int64_t value)
-{
-    m_l = ::to_ui64(value);
-
-    if (m_l & baseTypeMSB) m_h = baseTypeAllBits;
-    else m_h = 0;
-}
-
-void omw::Base_Int128::sets(int64_t valueH, uint64_t valueL)
-{
-    m_h = ::to_ui64(valueH);
-    m_l = valueL;
-}
-
 void omw::Base_Int128::sets(int32_t valueHH, uint32_t valueLH, uint32_t valueHL, uint32_t valueLL)
 {
     quad_i32_to_128(m_h, m_l, valueHH, valueLH, valueHL, valueLL);
@@ -130,22 +122,13 @@ void omw::Base_Int128::sets(const uint8_t* data, size_t count)
     {
         if (count > nBytes128) throw std::overflow_error("omw::Base_Int128::sets");
 
-        if (data[0] & 0x80) set(baseTypeAllBits, baseTypeAllBits);
+        if (data[0] & 0x80) set(OMW_64BIT_ALL, OMW_64BIT_ALL);
         else setu(0);
 
         m_readBuffer(data, count);
     }
 }
 
-//!
-//! Does not extend the sign bit.
-//!
-void omw::Base_Int128::setu(uint64_t value)
-{
-    m_h = 0;
-    m_l = value;
-}
-
 //! @param data Pointer to a big endian byte buffer
 //! @param count Number of bytes to read
 //!
@@ -168,13 +151,6 @@ void omw::Base_Int128::setu(const uint8_t* data, size_t count)
 
 int64_t omw::Base_Int128::highs() const { return ::to_i64(m_h); }
 
-omw::Base_Int128& omw::Base_Int128::m_copy(const omw::Base_Int128& other)
-{
-    m_h = other.hi();
-    m_l = other.lo();
-    return *this;
-}
-
 void omw::Base_Int128::m_readBuffer(const uint8_t* data, size_t count)
 {
     for (size_t i = 0; i < count; ++i)
@@ -184,409 +160,650 @@ void omw::Base_Int128::m_readBuffer(const uint8_t* data, size_t count)
     }
 }
 
-omw::Base_Int128& omw::Base_Int128::operator+=(const omw::Base_Int128& b)
-{
-    const base_type l_old = m_l;
-    m_h += b.hi();
-    m_l += b.lo();
-    if (m_l < l_old) { ++m_h; }
-    return *this;
-}
 
-omw::Base_Int128& omw::Base_Int128::operator-=(const omw::Base_Int128& b)
+
+omw::SignedInt128::SignedInt128(uint32_t valueHH, uint32_t valueLH, uint32_t valueHL, uint32_t valueLL)
+    : omw::Base_Int128(valueHH, valueLH, valueHL, valueLL)
+{}
+
+//! @return `-1` if the value is negative, `1` otherwise
+//!
+//! Caution: This is not the mathematical sign (signum) function.
+//!
+int omw::SignedInt128::sign() const { return (isNegative() ? -1 : 1); }
+
+//!
+//! See `omw::operator/(const omw::SignedInt128&, const omw::Base_Int128&)`.
+//!
+omw::SignedInt128& omw::SignedInt128::operator/=(const omw::Base_Int128& b)
 {
-    if (m_l < b.lo()) { --m_h; }
-    m_h -= b.hi();
-    m_l -= b.lo();
+    if (!b) throw std::domain_error("omw::SignedInt128::operator/=");
+    omw::SignedInt128 rem;
+    sdivmod(*this, b, *this, rem);
     return *this;
 }
 
-omw::Base_Int128& omw::Base_Int128::operator&=(const omw::Base_Int128& b)
+//!
+//! See `omw::operator%(const omw::SignedInt128&, const omw::Base_Int128&)`.
+//!
+omw::SignedInt128& omw::SignedInt128::operator%=(const omw::Base_Int128& b)
 {
-    m_h &= b.hi();
-    m_l &= b.lo();
+    if (!b) throw std::domain_error("omw::SignedInt128::operator%=");
+    omw::SignedInt128 quot;
+    sdivmod(*this, b, quot, *this);
     return *this;
 }
 
-omw::Base_Int128& omw::Base_Int128::operator|=(const omw::Base_Int128& b)
+
+
+omw::UnsignedInt128::UnsignedInt128(uint32_t valueHH, uint32_t valueLH, uint32_t valueHL, uint32_t valueLL)
+    : omw::Base_Int128(valueHH, valueLH, valueHL, valueLL)
+{}
+
+//!
+//! See `omw::operator/(const omw::UnsignedInt128&, const omw::Base_Int128&)`.
+//!
+omw::UnsignedInt128& omw::UnsignedInt128::operator/=(const omw::Base_Int128& b)
 {
-    m_h |= b.hi();
-    m_l |= b.lo();
+    if (!b) throw std::domain_error("omw::UnsignedInt128::operator/=");
+    uint64_t rh, rl;
+    omw::internal::int128::udivmod(m_h, m_l, b.hi(), b.lo(), m_h, m_l, rh, rl);
     return *this;
 }
 
-omw::Base_Int128& omw::Base_Int128::operator^=(const omw::Base_Int128& b)
+//!
+//! See `omw::operator%(const omw::UnsignedInt128&, const omw::Base_Int128&)`.
+//!
+omw::UnsignedInt128& omw::UnsignedInt128::operator%=(const omw::Base_Int128& b)
 {
-    m_h ^= b.hi();
-    m_l ^= b.lo();
+    if (!b) throw std::domain_error("omw::UnsignedInt128::operator%=");
+    uint64_t qh, ql;
+    omw::internal::int128::udivmod(m_h, m_l, b.hi(), b.lo(), qh, ql, m_h, m_l);
     return *this;
 }
 
-omw::Base_Int128& omw::Base_Int128::operator<<=(unsigned int count)
-{
-    if (count)
-    {
-        if (count < baseTypeWith)
-        {
-            base_type carry = m_l >> (baseTypeWith - count);
-            m_h <<= count;
-            m_h |= carry;
-            m_l <<= count;
-        }
-        else if (count == baseTypeWith)
-        {
-            m_h = m_l;
-            m_l = 0;
-        }
-        else if (count < bitWidth)
-        {
-            m_h = m_l;
-            m_h <<= (count - baseTypeWith);
-            m_l = 0;
-        }
-        else // count >= 128
-        {
-            m_h = 0;
-            m_l = 0;
-        }
-    }
 
-    return *this;
-}
 
-omw::Base_Int128& omw::Base_Int128::operator++()
+//!
+//! `b` is interpreted as signed. The quotient is truncated towards zero, `OMW_INT128_MIN / -1` results in
+//! `OMW_INT128_MIN` (see `omw::divOverflow()`).
+//!
+//! \b Exceptions
+//! - `std::domain_error` if `b` is 0
+//!
+omw::SignedInt128 omw::operator/(const omw::SignedInt128& a, const omw::Base_Int128& b)
 {
-    ++m_l;
-    if (m_l == 0) { ++m_h; }
-    return *this;
+    if (!b) throw std::domain_error("omw::operator/");
+    omw::SignedInt128 quot, rem;
+    sdivmod(a, b, quot, rem);
+    return quot;
 }
 
-omw::Base_Int128& omw::Base_Int128::operator--()
+//!
+//! `b` is interpreted as unsigned.
+//!
+//! \b Exceptions
+//! - `std::domain_error` if `b` is 0
+//!
+omw::UnsignedInt128 omw::operator/(const omw::UnsignedInt128& a, const omw::Base_Int128& b)
 {
-    --m_l;
-    if (m_l == baseTypeAllBits) { --m_h; }
-    return *this;
+    if (!b) throw std::domain_error("omw::operator/");
+    uint64_t qh, ql, rh, rl;
+    omw::internal::int128::udivmod(a.hi(), a.lo(), b.hi(), b.lo(), qh, ql, rh, rl);
+    return omw::UnsignedInt128(qh, ql);
 }
 
-omw::Base_Int128 omw::Base_Int128::operator++(int)
+//!
+//! `b` is interpreted as signed. The remainder has the sign of `a`.
+//!
+//! \b Exceptions
+//! - `std::domain_error` if `b` is 0
+//!
+omw::SignedInt128 omw::operator%(const omw::SignedInt128& a, const omw::Base_Int128& b)
 {
-    const omw::Base_Int128 tmp(*this);
-    ++m_l;
-    if (m_l == 0) { ++m_h; }
-    return tmp;
+    if (!b) throw std::domain_error("omw::operator%");
+    omw::SignedInt128 quot, rem;
+    sdivmod(a, b, quot, rem);
+    return rem;
 }
 
-omw::Base_Int128 omw::Base_Int128::operator--(int)
+//!
+//! `b` is interpreted as unsigned.
+//!
+//! \b Exceptions
+//! - `std::domain_error` if `b` is 0
+//!
+omw::UnsignedInt128 omw::operator%(const omw::UnsignedInt128& a, const omw::Base_Int128& b)
 {
-    const omw::Base_Int128 tmp(*this);
-    --m_l;
-    if (m_l == baseTypeAllBits) { --m_h; }
-    return tmp;
+    if (!b) throw std::domain_error("omw::operator%");
+    uint64_t qh, ql, rh, rl;
+    omw::internal::int128::udivmod(a.hi(), a.lo(), b.hi(), b.lo(), qh, ql, rh, rl);
+    return omw::UnsignedInt128(rh, rl);
 }
 
-
-
-omw::SignedInt128::SignedInt128()
-    : omw::Base_Int128()
-{}
-
-omw::SignedInt128::SignedInt128(const omw::SignedInt128& other)
-    : omw::Base_Int128(other)
-{}
-
 //!
-//! Uses `omw::Base_Int128::sets(int64_t)` to initialize.
+//! Calculates the quotient and the remainder with a single division, see `omw::operator/(const omw::SignedInt128&, const omw::Base_Int128&)`
+//! and `omw::operator%(const omw::SignedInt128&, const omw::Base_Int128&)`.
+//!
+//! \b Exceptions
+//! - `std::domain_error` if `b` is 0
 //!
-omw::SignedInt128::SignedInt128(int64_t value)
-    : omw::Base_Int128()
+omw::DivModResult<omw::int128_t> omw::divmod(const omw::int128_t& a, const omw::int128_t& b)
 {
-    sets(value);
+    if (!b) throw std::domain_error("omw::divmod");
+    omw::DivModResult<omw::int128_t> r;
+    sdivmod(a, b, r.quot, r.rem);
+    return r;
 }
 
-omw::SignedInt128::SignedInt128(uint64_t valueH, uint64_t valueL)
-    : omw::Base_Int128(valueH, valueL)
-{}
-
-omw::SignedInt128::SignedInt128(uint32_t valueHH, uint32_t valueLH, uint32_t valueHL, uint32_t valueLL)
-    : omw::Base_Int128(valueHH, valueLH, valueHL, valueLL)
-{}
-
-omw::SignedInt128::SignedInt128(const omw::Base_Int128& other)
-    : omw::Base_Int128(other)
-{}
-
-bool omw::SignedInt128::isNegative() const { return (m_h & OMW_64BIT_MSB); }
-
-//! @return `-1` if the value is negative, `1` otherwise
 //!
-//! Caution: This is not the mathematical sign (signum) function.
+//! Calculates the quotient and the remainder with a single division.
 //!
-int omw::SignedInt128::sign() const { return (isNegative() ? -1 : 1); }
+//! \b Exceptions
+//! - `std::domain_error` if `b` is 0
+//!
+omw::DivModResult<omw::uint128_t> omw::divmod(const omw::uint128_t& a, const omw::uint128_t& b)
+{
+    if (!b) throw std::domain_error("omw::divmod");
+    uint64_t qh, ql, rh, rl;
+    omw::internal::int128::udivmod(a.hi(), a.lo(), b.hi(), b.lo(), qh, ql, rh, rl);
+    omw::DivModResult<omw::uint128_t> r;
+    r.quot.set(qh, ql);
+    r.rem.set(rh, rl);
+    return r;
+}
 
-omw::SignedInt128& omw::SignedInt128::operator=(const omw::SignedInt128& b)
+//! @param a Dividend
+//! @param b Divisor
+//! @param [out] remainder Is set to the remainder if not `nullptr`
+//! @return Quotient
+//!
+//! \b Exceptions
+//! - `std::domain_error` if `b` is 0
+//!
+omw::uint128_t omw::div128by64(const omw::uint128_t& a, uint64_t b, uint64_t* remainder)
 {
-    m_copy(b);
-    return *this;
+    if (b == 0) throw std::domain_error("omw::div128by64");
+    uint64_t qh, ql, rh, rl;
+    omw::internal::int128::udivmod(a.hi(), a.lo(), 0, b, qh, ql, rh, rl);
+    if (remainder) *remainder = rl;
+    return omw::uint128_t(qh, ql);
 }
 
-omw::SignedInt128& omw::SignedInt128::operator>>=(unsigned int count)
+//! @return `true` if the result overflowed
+//!
+//! The overflow checked functions mirror the `__builtin_*_overflow()` functions of GCC and Clang. `result` is always set to
+//! the truncated (wrapped) result.
+//!
+bool omw::addOverflow(const omw::int128_t& a, const omw::int128_t& b, omw::int128_t& result)
 {
-    if (count)
-    {
-        base_type mask_h;
-        base_type mask_l;
-
-#ifdef OMWi_INT_RIGHTSHIFT_DEBUG
-        oldValue_h = m_h;
-        oldValue_l = m_l;
-#endif
+    const bool negA = a.isNegative();
+    const bool negB = b.isNegative();
+    result = a + b;
+    return ((negA == negB) && (result.isNegative() != negA));
+}
 
-        if (m_h & baseTypeMSB)
-        {
-            mask_h = baseTypeAllBits;
-            mask_l = baseTypeAllBits;
-        }
-        else
-        {
-            mask_h = 0;
-            mask_l = 0;
-        }
-
-        if (count < baseTypeWith)
-        {
-            base_type carry = m_h << (baseTypeWith - count);
-            m_l >>= count;
-            m_l |= carry;
-            m_h >>= count;
-
-            mask_h <<= (baseTypeWith - count);
-            mask_l = 0;
-        }
-        else if (count == baseTypeWith)
-        {
-            m_l = m_h;
-            m_h = 0;
-
-            mask_l = 0;
-        }
-        else if (count < bitWidth)
-        {
-            m_l = m_h;
-            m_l >>= (count - baseTypeWith);
-            m_h = 0;
-
-            mask_l <<= (bitWidth - count);
-        }
-        else // count >= 128
-        {
-            m_l = 0;
-            m_h = 0;
-        }
-
-#ifdef OMWi_INT_RIGHTSHIFT_DEBUG
-        lastMask_h = mask_h;
-        lastMask_l = mask_l;
-#endif
+//! @return `true` if the result overflowed
+//!
+bool omw::addOverflow(const omw::uint128_t& a, const omw::uint128_t& b, omw::uint128_t& result)
+{
+    const omw::uint128_t tmp = a;
+    result = a + b;
+    return (result < tmp);
+}
 
-        m_h |= mask_h;
-        m_l |= mask_l;
-    }
+//! @return `true` if the result overflowed
+//!
+bool omw::subOverflow(const omw::int128_t& a, const omw::int128_t& b, omw::int128_t& result)
+{
+    const bool negA = a.isNegative();
+    const bool negB = b.isNegative();
+    result = a - b;
+    return ((negA != negB) && (result.isNegative() != negA));
+}
 
-    return *this;
+//! @return `true` if the result overflowed
+//!
+bool omw::subOverflow(const omw::uint128_t& a, const omw::uint128_t& b, omw::uint128_t& result)
+{
+    const bool ovf = (a < b);
+    result = a - b;
+    return ovf;
 }
 
+//! @return `true` if the result overflowed
+//!
+bool omw::mulOverflow(const omw::int128_t& a, const omw::int128_t& b, omw::int128_t& result)
+{
+    const bool neg = (a.isNegative() != b.isNegative());
 
+    uint64_t h, l;
+    const bool ovf = umulOverflow(abs128(a), abs128(b), h, l);
 
-omw::UnsignedInt128::UnsignedInt128()
-    : omw::Base_Int128()
-{}
+    result.set(h, l);
+    if (neg) result = -result;
 
-omw::UnsignedInt128::UnsignedInt128(const omw::UnsignedInt128& other)
-    : omw::Base_Int128(other)
-{}
+    // the magnitude has to fit into 127 bits, or be exactly 2^127 for a negative result
+    return (ovf || ((h & OMW_64BIT_MSB) && !(neg && (h == OMW_64BIT_MSB) && (l == 0))));
+}
 
+//! @return `true` if the result overflowed
 //!
-//! Uses `omw::Base_Int128::sets(int64_t)` to initialize.
+bool omw::mulOverflow(const omw::uint128_t& a, const omw::uint128_t& b, omw::uint128_t& result)
+{
+    uint64_t h, l;
+    const bool ovf = umulOverflow(a, b, h, l);
+    result.set(h, l);
+    return ovf;
+}
+
+//! @return `true` if the result overflowed (`OMW_INT128_MIN / -1`)
+//!
+//! \b Exceptions
+//! - `std::domain_error` if `b` is 0
 //!
-omw::UnsignedInt128::UnsignedInt128(int64_t value)
-    : omw::Base_Int128()
+bool omw::divOverflow(const omw::int128_t& a, const omw::int128_t& b, omw::int128_t& result)
 {
-    sets(value);
+    if (!b) throw std::domain_error("omw::divOverflow");
+    const bool ovf = ((a == OMW_INT128_MIN) && (b == omw::int128_t(-1)));
+    omw::int128_t rem;
+    sdivmod(a, b, result, rem);
+    return ovf;
 }
 
-omw::UnsignedInt128::UnsignedInt128(uint64_t valueH, uint64_t valueL)
-    : omw::Base_Int128(valueH, valueL)
-{}
 
-omw::UnsignedInt128::UnsignedInt128(uint32_t valueHH, uint32_t valueLH, uint32_t valueHL, uint32_t valueLL)
-    : omw::Base_Int128(valueHH, valueLH, valueHL, valueLL)
-{}
 
-omw::UnsignedInt128::UnsignedInt128(const omw::Base_Int128& other)
-    : omw::Base_Int128(other)
-{}
+namespace {
+
+// Portable bit extract/deposit, loops over the set bits of the mask.
 
-omw::UnsignedInt128& omw::UnsignedInt128::operator=(const omw::UnsignedInt128& b)
+template <typename T> T bitExtract_portable(T value, T mask)
 {
-    m_copy(b);
-    return *this;
+    T r = 0;
+    for (T bit = 1; mask != 0; bit = static_cast<T>(bit << 1))
+    {
+        if (value & mask & static_cast<T>(0 - mask)) r |= bit;
+        mask &= static_cast<T>(mask - 1);
+    }
+    return r;
 }
 
-omw::UnsignedInt128& omw::UnsignedInt128::operator>>=(unsigned int count)
+template <typename T> T bitDeposit_portable(T value, T mask)
 {
-    if (count)
+    T r = 0;
+    for (T bit = 1; mask != 0; bit = static_cast<T>(bit << 1))
     {
-        if (count < baseTypeWith)
-        {
-            base_type carry = m_h << (baseTypeWith - count);
-            m_l >>= count;
-            m_l |= carry;
-            m_h >>= count;
-        }
-        else if (count == baseTypeWith)
-        {
-            m_l = m_h;
-            m_h = 0;
-        }
-        else if (count < bitWidth)
-        {
-            m_l = m_h;
-            m_l >>= (count - baseTypeWith);
-            m_h = 0;
-        }
-        else // count >= 128
-        {
-            m_l = 0;
-            m_h = 0;
-        }
+        if (value & bit) r |= static_cast<T>(mask & (0 - mask));
+        mask &= static_cast<T>(mask - 1);
     }
-
-    return *this;
+    return r;
 }
 
+using bitop32_t = uint32_t (*)(uint32_t value, uint32_t mask);
+using bitop64_t = uint64_t (*)(uint64_t value, uint64_t mask);
 
+#ifdef OMWi_X86_DISPATCH
 
-#ifndef ___OMWi_REGION_operators
-
-#define OMWi_IMPLEMENT_OPERATOR_UNARY_PLUS(a) return a
-
-#define OMWi_IMPLEMENT_OPERATOR_UNARY_MINUS(a) \
-    omw::Base_Int128 r(~a.hi(), ~a.lo());      \
-    ++r;                                       \
-    return r
-
-// SIA = Sign Independent Arithmetic
-#define OMWi_IMPLEMENT_SIA_ASSIGN_ALIAS_OPERATOR(op, a, b) \
-    omw::Base_Int128 r(a);                                 \
-    r op## = b;                                            \
-    return r
-
-#define OMWi_IMPLEMENT_OPERATOR_BIT_NOT(a) return omw::Base_Int128(~a.hi(), ~a.lo())
+OMWi_TARGET("bmi2") uint32_t pext32_bmi2(uint32_t value, uint32_t mask) { return _pext_u32(value, mask); }
+OMWi_TARGET("bmi2") uint64_t pext64_bmi2(uint64_t value, uint64_t mask) { return _pext_u64(value, mask); }
+OMWi_TARGET("bmi2") uint32_t pdep32_bmi2(uint32_t value, uint32_t mask) { return _pdep_u32(value, mask); }
+OMWi_TARGET("bmi2") uint64_t pdep64_bmi2(uint64_t value, uint64_t mask) { return _pdep_u64(value, mask); }
 
-#define OMWi_DEFINE_SIA_ASSIGN_ALIAS_OPERATOR(T, op) \
-    T omw::operator op(const T & a, const omw::Base_Int128 & b) { OMWi_IMPLEMENT_SIA_ASSIGN_ALIAS_OPERATOR(op, a, b); }
+#endif // OMWi_X86_DISPATCH
 
-#define OMWi_DEFINE_ALL_TYPES_SIA_ASSIGN_ALIAS_OPERATORS(op) \
-    OMWi_DEFINE_SIA_ASSIGN_ALIAS_OPERATOR(omw::SignedInt128, op) OMWi_DEFINE_SIA_ASSIGN_ALIAS_OPERATOR(omw::UnsignedInt128, op)
-
-#define OMWi_DEFINE_DEPENDENT_COMPARSION_OPERATORS(Ta, Tb)               \
-    bool omw::operator!=(const Ta& a, const Tb& b) { return !(a == b); } \
-    bool omw::operator>(const Ta& a, const Tb& b) { return (b < a); }    \
-    bool omw::operator<=(const Ta& a, const Tb& b) { return !(a > b); }  \
-    bool omw::operator>=(const Ta& a, const Tb& b) { return !(a < b); }
+} // namespace
 
 
 
+//! Parallel bit extract (`pext`).
 //!
-//! Does nothing else than returning `a`.
+//! The bits of `value` at the positions of the set bits in `mask` are packed into the low bits of the result, e.g.
+//! `bitExtract(0xABCD, 0x0FF0) = 0xBC`. Uses the BMI2 instruction on x86-64 if supported by the CPU.
 //!
-omw::SignedInt128 omw::operator+(const omw::SignedInt128& a) { OMWi_IMPLEMENT_OPERATOR_UNARY_PLUS(a); }
+uint32_t omw::bitExtract(uint32_t value, uint32_t mask)
+{
+#ifdef OMWi_X86_DISPATCH
+    static const bitop32_t fn = (omw::internal::cpu::hasBmi2() ? ::pext32_bmi2 : ::bitExtract_portable<uint32_t>);
+#else
+    static const bitop32_t fn = ::bitExtract_portable<uint32_t>;
+#endif
+    return fn(value, mask);
+}
 
+//! See `omw::bitExtract(uint32_t, uint32_t)`.
 //!
-//! Does nothing else than returning `a`.
-//!
-omw::UnsignedInt128 omw::operator+(const omw::UnsignedInt128& a) { OMWi_IMPLEMENT_OPERATOR_UNARY_PLUS(a); }
+uint64_t omw::bitExtract(uint64_t value, uint64_t mask)
+{
+#ifdef OMWi_X86_DISPATCH
+    static const bitop64_t fn = (omw::internal::cpu::hasBmi2() ? ::pext64_bmi2 : ::bitExtract_portable<uint64_t>);
+#else
+    static const bitop64_t fn = ::bitExtract_portable<uint64_t>;
+#endif
+    return fn(value, mask);
+}
 
+//! Parallel bit deposit (`pdep`), the inverse of `omw::bitExtract()`.
 //!
-//! Returns the two's complement of `a`.
+//! The low bits of `value` are scattered to the positions of the set bits in `mask`, e.g. `bitDeposit(0xBC, 0x0FF0) = 0x0BC0`.
+//! Uses the BMI2 instruction on x86-64 if supported by the CPU.
 //!
-omw::SignedInt128 omw::operator-(const omw::SignedInt128& a) { OMWi_IMPLEMENT_OPERATOR_UNARY_MINUS(a); }
+uint32_t omw::bitDeposit(uint32_t value, uint32_t mask)
+{
+#ifdef OMWi_X86_DISPATCH
+    static const bitop32_t fn = (omw::internal::cpu::hasBmi2() ? ::pdep32_bmi2 : ::bitDeposit_portable<uint32_t>);
+#else
+    static const bitop32_t fn = ::bitDeposit_portable<uint32_t>;
+#endif
+    return fn(value, mask);
+}
 
+//! See `omw::bitDeposit(uint32_t, uint32_t)`.
 //!
-//! Returns the two's complement of `a`.
-//!
-omw::UnsignedInt128 omw::operator-(const omw::UnsignedInt128& a) { OMWi_IMPLEMENT_OPERATOR_UNARY_MINUS(a); }
+uint64_t omw::bitDeposit(uint64_t value, uint64_t mask)
+{
+#ifdef OMWi_X86_DISPATCH
+    static const bitop64_t fn = (omw::internal::cpu::hasBmi2() ? ::pdep64_bmi2 : ::bitDeposit_portable<uint64_t>);
+#else
+    static const bitop64_t fn = ::bitDeposit_portable<uint64_t>;
+#endif
+    return fn(value, mask);
+}
 
-// clang-format off
-OMWi_DEFINE_ALL_TYPES_SIA_ASSIGN_ALIAS_OPERATORS(+)
-OMWi_DEFINE_ALL_TYPES_SIA_ASSIGN_ALIAS_OPERATORS(-)
 
-omw::SignedInt128 omw::operator~(const omw::SignedInt128& a) { OMWi_IMPLEMENT_OPERATOR_BIT_NOT(a); }
-omw::UnsignedInt128 omw::operator~(const omw::UnsignedInt128& a) { OMWi_IMPLEMENT_OPERATOR_BIT_NOT(a); }
 
-OMWi_DEFINE_ALL_TYPES_SIA_ASSIGN_ALIAS_OPERATORS(&)
-OMWi_DEFINE_ALL_TYPES_SIA_ASSIGN_ALIAS_OPERATORS(|)
-OMWi_DEFINE_ALL_TYPES_SIA_ASSIGN_ALIAS_OPERATORS(^)
-    // clang-format on
+#if (OMW_CPPSTD >= OMW_CPPSTD_14)
+
+namespace {
 
-    omw::SignedInt128 omw::operator<<(const omw::SignedInt128 & a, unsigned int count)
+// add with carry, `c` is the carry in and out (0 or 1)
+inline uint64_t addc(uint64_t a, uint64_t b, unsigned char& c)
 {
-    omw::SignedInt128 r(a);
-    r <<= count;
+#ifdef OMWi_X86_DISPATCH
+    unsigned long long r;
+    c = _addcarry_u64(c, a, b, &r);
     return r;
+#else
+    const uint64_t s = a + b;
+    const uint64_t r = s + c;
+    c = static_cast<unsigned char>((s < a) | (r < s));
+    return r;
+#endif
 }
 
-omw::UnsignedInt128 omw::operator<<(const omw::UnsignedInt128& a, unsigned int count)
+// subtract with borrow, `c` is the borrow in and out (0 or 1)
+inline uint64_t subb(uint64_t a, uint64_t b, unsigned char& c)
 {
-    omw::UnsignedInt128 r(a);
-    r <<= count;
+#ifdef OMWi_X86_DISPATCH
+    unsigned long long r;
+    c = _subborrow_u64(c, a, b, &r);
     return r;
+#else
+    const uint64_t d = a - b;
+    const uint64_t r = d - c;
+    c = static_cast<unsigned char>((a < b) | (d < c));
+    return r;
+#endif
 }
 
-omw::SignedInt128 omw::operator>>(const omw::SignedInt128& a, unsigned int count)
+// the sign bit of signed values is flipped, so that they can be compared unsigned
+template <bool isSigned> inline uint64_t cmpHi(const omw::BasicInt128<isSigned>& value) { return (isSigned ? (value.hi() ^ OMW_64BIT_MSB) : value.hi()); }
+
+// branch free `a < b`
+template <bool isSigned> inline unsigned char less(const omw::BasicInt128<isSigned>& a, const omw::BasicInt128<isSigned>& b)
 {
-    omw::SignedInt128 r(a);
-    r >>= count;
-    return r;
+    unsigned char c = 0;
+    (void)subb(a.lo(), b.lo(), c);
+    (void)subb(cmpHi(a), cmpHi(b), c);
+    return c;
+}
+
+// branch free `cond ? a : b`
+template <bool isSigned> inline omw::BasicInt128<isSigned> select(unsigned char cond, const omw::BasicInt128<isSigned>& a, const omw::BasicInt128<isSigned>& b)
+{
+    const uint64_t mask = 0 - static_cast<uint64_t>(cond);
+    return omw::BasicInt128<isSigned>((a.hi() & mask) | (b.hi() & ~mask), (a.lo() & mask) | (b.lo() & ~mask));
 }
 
-omw::UnsignedInt128 omw::operator>>(const omw::UnsignedInt128& a, unsigned int count)
+template <bool isSigned> inline void addTo(omw::BasicInt128<isSigned>& acc, const omw::BasicInt128<isSigned>& value)
 {
-    omw::UnsignedInt128 r(a);
-    r >>= count;
+    unsigned char c = 0;
+    const uint64_t l = addc(acc.lo(), value.lo(), c);
+    const uint64_t h = addc(acc.hi(), value.hi(), c);
+    acc = omw::BasicInt128<isSigned>(h, l);
+}
+
+template <bool isSigned> inline omw::BasicInt128<isSigned> addElem(const omw::BasicInt128<isSigned>& a, const omw::BasicInt128<isSigned>& b)
+{
+    omw::BasicInt128<isSigned> r = a;
+    addTo(r, b);
     return r;
 }
 
+template <bool isSigned> inline omw::BasicInt128<isSigned> subElem(const omw::BasicInt128<isSigned>& a, const omw::BasicInt128<isSigned>& b)
+{
+    unsigned char c = 0;
+    const uint64_t l = subb(a.lo(), b.lo(), c);
+    const uint64_t h = subb(a.hi(), b.hi(), c);
+    return omw::BasicInt128<isSigned>(h, l);
+}
 
+template <bool isSigned> inline int8_t cmpElem(const omw::BasicInt128<isSigned>& a, const omw::BasicInt128<isSigned>& b)
+{
+    return static_cast<int8_t>(less(b, a) - less(a, b));
+}
 
-bool omw::operator==(const omw::SignedInt128& a, const omw::SignedInt128& b) { return ((a.hi() == b.hi()) && (a.lo() == b.lo())); }
+// Exceptions
+// - `std::invalid_argument`
+template <bool isSigned>
+void bulk_add(omw::BasicInt128<isSigned>* dst, const omw::BasicInt128<isSigned>* a, const omw::BasicInt128<isSigned>* b, size_t n, const char* fnName)
+{
+    if ((!dst || !a || !b) && (n > 0)) throw std::invalid_argument(fnName);
 
-bool omw::operator<(const omw::SignedInt128& a, const omw::SignedInt128& b) { return ((a.his() < b.his()) || ((a.his() == b.his()) && (a.lo() < b.lo()))); }
+    size_t i = 0;
+    for (; (i + 4) <= n; i += 4)
+    {
+        dst[i] = addElem(a[i], b[i]);
+        dst[i + 1] = addElem(a[i + 1], b[i + 1]);
+        dst[i + 2] = addElem(a[i + 2], b[i + 2]);
+        dst[i + 3] = addElem(a[i + 3], b[i + 3]);
+    }
+    for (; i < n; ++i) dst[i] = addElem(a[i], b[i]);
+}
+
+// Exceptions
+// - `std::invalid_argument`
+template <bool isSigned>
+void bulk_sub(omw::BasicInt128<isSigned>* dst, const omw::BasicInt128<isSigned>* a, const omw::BasicInt128<isSigned>* b, size_t n, const char* fnName)
+{
+    if ((!dst || !a || !b) && (n > 0)) throw std::invalid_argument(fnName);
 
-bool omw::operator==(const omw::SignedInt128& a, const omw::UnsignedInt128& b) { return (!a.isNegative() && (a.hi() == b.hi()) && (a.lo() == b.lo())); }
+    size_t i = 0;
+    for (; (i + 4) <= n; i += 4)
+    {
+        dst[i] = subElem(a[i], b[i]);
+        dst[i + 1] = subElem(a[i + 1], b[i + 1]);
+        dst[i + 2] = subElem(a[i + 2], b[i + 2]);
+        dst[i + 3] = subElem(a[i + 3], b[i + 3]);
+    }
+    for (; i < n; ++i) dst[i] = subElem(a[i], b[i]);
+}
 
-bool omw::operator<(const omw::SignedInt128& a, const omw::UnsignedInt128& b)
+// Exceptions
+// - `std::invalid_argument`
+template <bool isSigned> void bulk_compare(int8_t* dst, const omw::BasicInt128<isSigned>* a, const omw::BasicInt128<isSigned>* b, size_t n, const char* fnName)
 {
-    return ((a.hi() & OMW_64BIT_MSB) || (b.hi() & OMW_64BIT_MSB) || (a.hi() < b.hi()) || ((a.hi() == b.hi()) && (a.lo() < b.lo())));
+    if ((!dst || !a || !b) && (n > 0)) throw std::invalid_argument(fnName);
+
+    size_t i = 0;
+    for (; (i + 4) <= n; i += 4)
+    {
+        dst[i] = cmpElem(a[i], b[i]);
+        dst[i + 1] = cmpElem(a[i + 1], b[i + 1]);
+        dst[i + 2] = cmpElem(a[i + 2], b[i + 2]);
+        dst[i + 3] = cmpElem(a[i + 3], b[i + 3]);
+    }
+    for (; i < n; ++i) dst[i] = cmpElem(a[i], b[i]);
 }
 
-bool omw::operator==(const omw::UnsignedInt128& a, const omw::SignedInt128& b) { return (b == a); }
+// four independent accumulators, merged at the end
+//
+// Exceptions
+// - `std::invalid_argument`
+template <bool isMax, bool isSigned> omw::BasicInt128<isSigned> bulk_minmax(const omw::BasicInt128<isSigned>* data, size_t n, const char* fnName)
+{
+    if (!data || (n == 0)) throw std::invalid_argument(fnName);
+
+    omw::BasicInt128<isSigned> r0 = data[0];
+    omw::BasicInt128<isSigned> r1 = data[0];
+    omw::BasicInt128<isSigned> r2 = data[0];
+    omw::BasicInt128<isSigned> r3 = data[0];
+
+    size_t i = 1;
+    for (; (i + 4) <= n; i += 4)
+    {
+        r0 = select(isMax ? less(r0, data[i]) : less(data[i], r0), data[i], r0);
+        r1 = select(isMax ? less(r1, data[i + 1]) : less(data[i + 1], r1), data[i + 1], r1);
+        r2 = select(isMax ? less(r2, data[i + 2]) : less(data[i + 2], r2), data[i + 2], r2);
+        r3 = select(isMax ? less(r3, data[i + 3]) : less(data[i + 3], r3), data[i + 3], r3);
+    }
+    for (; i < n; ++i) r0 = select(isMax ? less(r0, data[i]) : less(data[i], r0), data[i], r0);
 
-bool omw::operator<(const omw::UnsignedInt128& a, const omw::SignedInt128& b)
+    r0 = select(isMax ? less(r0, r1) : less(r1, r0), r1, r0);
+    r2 = select(isMax ? less(r2, r3) : less(r3, r2), r3, r2);
+    return select(isMax ? less(r0, r2) : less(r2, r0), r2, r0);
+}
+
+// four independent carry chains, merged at the end
+//
+// Exceptions
+// - `std::invalid_argument`
+template <bool isSigned> omw::BasicInt128<isSigned> bulk_sum(const omw::BasicInt128<isSigned>* data, size_t n, const char* fnName)
 {
-    return (!(a.hi() & OMW_64BIT_MSB) && !(b.hi() & OMW_64BIT_MSB) && ((a.hi() < b.hi()) || ((a.hi() == b.hi()) && (a.lo() < b.lo()))));
+    if (!data && (n > 0)) throw std::invalid_argument(fnName);
+
+    omw::BasicInt128<isSigned> r0(0, 0);
+    omw::BasicInt128<isSigned> r1(0, 0);
+    omw::BasicInt128<isSigned> r2(0, 0);
+    omw::BasicInt128<isSigned> r3(0, 0);
+
+    size_t i = 0;
+    for (; (i + 4) <= n; i += 4)
+    {
+        addTo(r0, data[i]);
+        addTo(r1, data[i + 1]);
+        addTo(r2, data[i + 2]);
+        addTo(r3, data[i + 3]);
+    }
+    for (; i < n; ++i) addTo(r0, data[i]);
+
+    addTo(r0, r1);
+    addTo(r2, r3);
+    addTo(r0, r2);
+    return r0;
 }
 
-bool omw::operator==(const omw::UnsignedInt128& a, const omw::UnsignedInt128& b) { return ((a.hi() == b.hi()) && (a.lo() == b.lo())); }
+// Exceptions
+// - `std::invalid_argument`
+template <bool isSigned> void bulk_prefixSum(omw::BasicInt128<isSigned>* dst, const omw::BasicInt128<isSigned>* src, size_t n, const char* fnName)
+{
+    if ((!dst || !src) && (n > 0)) throw std::invalid_argument(fnName);
+
+    omw::BasicInt128<isSigned> acc(0, 0);
 
-bool omw::operator<(const omw::UnsignedInt128& a, const omw::UnsignedInt128& b) { return ((a.hi() < b.hi()) || ((a.hi() == b.hi()) && (a.lo() < b.lo()))); }
+    size_t i = 0;
+    for (; (i + 4) <= n; i += 4)
+    {
+        addTo(acc, src[i]);
+        dst[i] = acc;
+        addTo(acc, src[i + 1]);
+        dst[i + 1] = acc;
+        addTo(acc, src[i + 2]);
+        dst[i + 2] = acc;
+        addTo(acc, src[i + 3]);
+        dst[i + 3] = acc;
+    }
+    for (; i < n; ++i)
+    {
+        addTo(acc, src[i]);
+        dst[i] = acc;
+    }
+}
+
+} // namespace
 
-// clang-format off
-OMWi_DEFINE_DEPENDENT_COMPARSION_OPERATORS(omw::SignedInt128, omw::SignedInt128)
-OMWi_DEFINE_DEPENDENT_COMPARSION_OPERATORS(omw::SignedInt128, omw::UnsignedInt128)
-OMWi_DEFINE_DEPENDENT_COMPARSION_OPERATORS(omw::UnsignedInt128, omw::SignedInt128)
-OMWi_DEFINE_DEPENDENT_COMPARSION_OPERATORS(omw::UnsignedInt128, omw::UnsignedInt128)
-// clang-format on
 
 
-#endif // ___OMWi_REGION_operators
+/*!
+ * \namespace omw::bulk
+ *
+ * `#include <omw/int.h>`
+ *
+ * Operations over contiguous arrays of `omw::i128` or `omw::u128`. The loops are unrolled and the carry is propagated
+ * with `_addcarry_u64()` / `_subborrow_u64()` on x86-64, the comparisons are branch free.
+ *
+ * Arithmetic wraps around like the operators of `omw::BasicInt128`. The destination may be equal to a source (in place
+ * operation), other overlaps are not allowed.
+ *
+ * Requires C++14.
+ *
+ * \b Exceptions
+ * - `std::invalid_argument` if a pointer is `NULL` and `n` is not zero, for `min()` and `max()` also if `n` is zero
+ */
+
+//! `dst[i] = a[i] + b[i]`
+//!
+void omw::bulk::add(omw::i128* dst, const omw::i128* a, const omw::i128* b, size_t n) { ::bulk_add(dst, a, b, n, "omw::bulk::add"); }
+
+//! `dst[i] = a[i] + b[i]`
+//!
+void omw::bulk::add(omw::u128* dst, const omw::u128* a, const omw::u128* b, size_t n) { ::bulk_add(dst, a, b, n, "omw::bulk::add"); }
+
+//! `dst[i] = a[i] - b[i]`
+//!
+void omw::bulk::sub(omw::i128* dst, const omw::i128* a, const omw::i128* b, size_t n) { ::bulk_sub(dst, a, b, n, "omw::bulk::sub"); }
+
+//! `dst[i] = a[i] - b[i]`
+//!
+void omw::bulk::sub(omw::u128* dst, const omw::u128* a, const omw::u128* b, size_t n) { ::bulk_sub(dst, a, b, n, "omw::bulk::sub"); }
+
+//! `dst[i]` is set to -1, 0 or 1 if `a[i]` is less than, equal to or greater than `b[i]`.
+//!
+void omw::bulk::compare(int8_t* dst, const omw::i128* a, const omw::i128* b, size_t n) { ::bulk_compare(dst, a, b, n, "omw::bulk::compare"); }
+
+//! `dst[i]` is set to -1, 0 or 1 if `a[i]` is less than, equal to or greater than `b[i]`.
+//!
+void omw::bulk::compare(int8_t* dst, const omw::u128* a, const omw::u128* b, size_t n) { ::bulk_compare(dst, a, b, n, "omw::bulk::compare"); }
+
+//! @return The smallest value of `[data, data + n)`
+//!
+omw::i128 omw::bulk::min(const omw::i128* data, size_t n) { return ::bulk_minmax<false>(data, n, "omw::bulk::min"); }
+
+//! @return The smallest value of `[data, data + n)`
+//!
+omw::u128 omw::bulk::min(const omw::u128* data, size_t n) { return ::bulk_minmax<false>(data, n, "omw::bulk::min"); }
+
+//! @return The greatest value of `[data, data + n)`
+//!
+omw::i128 omw::bulk::max(const omw::i128* data, size_t n) { return ::bulk_minmax<true>(data, n, "omw::bulk::max"); }
+
+//! @return The greatest value of `[data, data + n)`
+//!
+omw::u128 omw::bulk::max(const omw::u128* data, size_t n) { return ::bulk_minmax<true>(data, n, "omw::bulk::max"); }
+
+//! @return The (wrapped) sum of `[data, data + n)`, 0 if `n` is zero
+//!
+omw::i128 omw::bulk::sum(const omw::i128* data, size_t n) { return ::bulk_sum(data, n, "omw::bulk::sum"); }
+
+//! @return The (wrapped) sum of `[data, data + n)`, 0 if `n` is zero
+//!
+omw::u128 omw::bulk::sum(const omw::u128* data, size_t n) { return ::bulk_sum(data, n, "omw::bulk::sum"); }
+
+//! Inclusive prefix sum, `dst[i] = src[0] + ... + src[i]`.
+//!
+void omw::bulk::prefixSum(omw::i128* dst, const omw::i128* src, size_t n) { ::bulk_prefixSum(dst, src, n, "omw::bulk::prefixSum"); }
+
+//! Inclusive prefix sum, `dst[i] = src[0] + ... + src[i]`.
+//!
+void omw::bulk::prefixSum(omw::u128* dst, const omw::u128* src, size_t n) { ::bulk_prefixSum(dst, src, n, "omw::bulk::prefixSum"); }
+
+#endif // C++14
@@ -3,13 +3,16 @@ author          Oliver Blaser
 copyright       MIT - Copyright (c) 2023 Oliver Blaser
 */
 
+#include <algorithm>
 #include <cctype>
+#include <cstring>
 #include <stdexcept>
 #include <string>
 #include <vector>
 
-#include "omw/algorithm.h"
+#include "cpuFeatures.h"
 #include "omw/defs.h"
+#include "omw/int.h"
 #include "omw/intdef.h"
 #include "omw/string.h"
 
@@ -92,6 +95,295 @@ omw::Base_Int128 hexstointeger128(const std::string& str, const std::string& fnN
     return r;
 }
 
+// decimal conversion of 128-bit integers
+
+constexpr char decimalDigitPairs[] = "0001020304050607080910111213141516171819202122232425262728293031323334353637383940414243444546474849"
+                                     "5051525354555657585960616263646566676869707172737475767778798081828384858687888990919293949596979899";
+
+constexpr uint64_t pow10_u64[20] = {
+    1,
+    10,
+    100,
+    1000,
+    10000,
+    100000,
+    1000000,
+    10000000,
+    100000000,
+    1000000000,
+    10000000000,
+    100000000000,
+    1000000000000,
+    10000000000000,
+    100000000000000,
+    1000000000000000,
+    10000000000000000,
+    100000000000000000,
+    1000000000000000000,
+    10000000000000000000u,
+};
+
+constexpr size_t maxDigitsPerWord = 19; // 10^19 is the largest power of 10 representable in 64 bits
+
+// writes the two least significant digits in front of `end`
+inline char* writeDigitPair(char* end, uint64_t value)
+{
+    const uint64_t i = 2 * value;
+    *(--end) = decimalDigitPairs[i + 1];
+    *(--end) = decimalDigitPairs[i];
+    return end;
+}
+
+// writes exactly 8 digits (with leading zeros), the four digit halves are converted independently
+char* writeEightDigits(char* end, uint32_t value)
+{
+    const uint32_t h = value / 10000;
+    const uint32_t l = value % 10000;
+    end = writeDigitPair(end, l % 100);
+    end = writeDigitPair(end, l / 100);
+    end = writeDigitPair(end, h % 100);
+    return writeDigitPair(end, h / 100);
+}
+
+// writes the digits of `value` in front of `end`, returns the pointer to the first digit
+char* u64_toCharsBackward(char* end, uint64_t value)
+{
+    while (value >= 100000000)
+    {
+        end = writeEightDigits(end, static_cast<uint32_t>(value % 100000000));
+        value /= 100000000;
+    }
+
+    while (value >= 100)
+    {
+        end = writeDigitPair(end, value % 100);
+        value /= 100;
+    }
+
+    if (value >= 10) end = writeDigitPair(end, value);
+    else *(--end) = static_cast<char>('0' + value);
+
+    return end;
+}
+
+// writes exactly 19 digits (with leading zeros)
+char* u64_toCharsBackward19(char* end, uint64_t value)
+{
+    const uint64_t top = value / 10000000000000000; // 3 digits
+    const uint64_t rest = value % 10000000000000000;
+
+    end = writeEightDigits(end, static_cast<uint32_t>(rest % 100000000));
+    end = writeEightDigits(end, static_cast<uint32_t>(rest / 100000000));
+    end = writeDigitPair(end, top % 100);
+    *(--end) = static_cast<char>('0' + (top / 100));
+
+    return end;
+}
+
+// 128 by 10^19 division with the precomputed reciprocal, `u1` has to be less than 10^19 (Moeller, Granlund: Improved division
+// by invariant integers, algorithm 4). 10^19 is normalized (MSB is set), so no shifts are needed.
+uint64_t div_pow10_19(uint64_t u1, uint64_t u0, uint64_t& r)
+{
+    constexpr uint64_t d = pow10_u64[maxDigitsPerWord];
+    constexpr uint64_t v = 0xD83C94FB6D2AC34A; // floor((2^128 - 1) / d) - 2^64
+
+    uint64_t q1 = 0, q0 = 0;
+    omw::internal::int128::mul64(v, u1, q1, q0);
+    omw::internal::int128::add(q1, q0, u1, u0);
+    ++q1;
+
+    r = u0 - q1 * d;
+
+    if (r > q0)
+    {
+        --q1;
+        r += d;
+    }
+
+    if (r >= d)
+    {
+        ++q1;
+        r -= d;
+    }
+
+    return q1;
+}
+
+// splits the value into at most three 19 digit words
+char* u128_toCharsBackward(char* end, uint64_t h, uint64_t l)
+{
+    constexpr uint64_t d = pow10_u64[maxDigitsPerWord];
+
+    if (h == 0) return u64_toCharsBackward(end, l);
+
+    // h < 2^64 < 2 * 10^19
+    const uint64_t qh = ((h >= d) ? 1 : 0);
+    if (qh) h -= d;
+
+    uint64_t r = 0;
+    const uint64_t ql = div_pow10_19(h, l, r);
+    end = u64_toCharsBackward19(end, r);
+
+    if (qh == 0) return u64_toCharsBackward(end, ql);
+
+    const uint64_t q = div_pow10_19(qh, ql, r);
+    end = u64_toCharsBackward19(end, r);
+    return u64_toCharsBackward(end, q);
+}
+
+omw::ToCharsResult int128_toChars(char* first, char* last, uint64_t h, uint64_t l, bool negative)
+{
+    char buffer[omw::toChars128_maxLength];
+    char* const end = buffer + sizeof(buffer);
+
+    if (negative)
+    {
+        uint64_t magnitudeH = 0, magnitudeL = 0;
+        omw::internal::int128::sub(magnitudeH, magnitudeL, h, l);
+        h = magnitudeH;
+        l = magnitudeL;
+    }
+
+    char* p = u128_toCharsBackward(end, h, l);
+    if (negative) *(--p) = '-';
+
+    const size_t length = static_cast<size_t>(end - p);
+    omw::ToCharsResult r;
+
+    if ((first > last) || (static_cast<size_t>(last - first) < length))
+    {
+        r.ptr = last;
+        r.ec = std::errc::value_too_large;
+    }
+    else
+    {
+        std::memcpy(first, p, length);
+        r.ptr = first + length;
+        r.ec = std::errc();
+    }
+
+    return r;
+}
+
+inline bool isDecimalDigit(char c) { return ((c >= '0') && (c <= '9')); }
+
+// `p` has to point to 8 decimal digits
+uint64_t parseEightDigits(const char* p)
+{
+    uint64_t value = 0;
+    std::memcpy(&value, p, 8);
+
+#ifdef OMW_BYTE_ORDER_BIG
+    value = ((value & 0x00000000FFFFFFFF) << 32) | ((value & 0xFFFFFFFF00000000) >> 32);
+    value = ((value & 0x0000FFFF0000FFFF) << 16) | ((value & 0xFFFF0000FFFF0000) >> 16);
+    value = ((value & 0x00FF00FF00FF00FF) << 8) | ((value & 0xFF00FF00FF00FF00) >> 8);
+#endif
+
+    // SWAR, combines neighbouring digits, pairs and quadruples
+    value = ((value & 0x0F0F0F0F0F0F0F0F) * 2561) >> 8;
+    value = ((value & 0x00FF00FF00FF00FF) * 6553601) >> 16;
+    return (((value & 0x0000FFFF0000FFFF) * 42949672960001) >> 32);
+}
+
+// parses the decimal digits at `first`, returns the pointer past the last digit
+const char* u128_fromChars(const char* first, const char* last, uint64_t& h, uint64_t& l, bool& overflow)
+{
+    const char* end = first;
+    while ((end != last) && isDecimalDigit(*end)) { ++end; }
+
+    h = 0;
+    l = 0;
+    overflow = false;
+
+    size_t chunkSize = static_cast<size_t>(end - first) % maxDigitsPerWord;
+    if (chunkSize == 0) chunkSize = maxDigitsPerWord;
+
+    const char* p = first;
+    while ((p != end) && !overflow)
+    {
+        const char* const chunkEnd = p + chunkSize;
+        uint64_t chunk = 0;
+
+        while ((chunkEnd - p) >= 8)
+        {
+            chunk = (chunk * 100000000) + parseEightDigits(p);
+            p += 8;
+        }
+
+        while (p != chunkEnd)
+        {
+            chunk = (chunk * 10) + static_cast<uint64_t>(*p - '0');
+            ++p;
+        }
+
+        // value = value * 10^chunkSize + chunk
+        uint64_t ph = 0, pl = 0, hh = 0, hl = 0;
+        omw::internal::int128::mul64(l, pow10_u64[chunkSize], ph, pl);
+        omw::internal::int128::mul64(h, pow10_u64[chunkSize], hh, hl);
+
+        h = hl + ph;
+        if ((hh != 0) || (h < ph)) overflow = true;
+
+        l = pl + chunk;
+        if (l < pl)
+        {
+            ++h;
+            if (h == 0) overflow = true;
+        }
+
+        chunkSize = maxDigitsPerWord;
+    }
+
+    return end;
+}
+
+omw::FromCharsResult int128_fromChars(const char* first, const char* last, uint64_t& h, uint64_t& l, bool isSigned)
+{
+    omw::FromCharsResult r;
+
+    const bool negative = (isSigned && (first != last) && (*first == '-'));
+    const char* const digits = (negative ? (first + 1) : first);
+
+    uint64_t valueH = 0, valueL = 0;
+    bool overflow = false;
+    const char* const end = u128_fromChars(digits, last, valueH, valueL, overflow);
+
+    if (end == digits)
+    {
+        r.ptr = first;
+        r.ec = std::errc::invalid_argument;
+        return r;
+    }
+
+    r.ptr = end;
+
+    if (isSigned && !overflow)
+    {
+        if (negative) overflow = ((valueH > OMW_64BIT_MSB) || ((valueH == OMW_64BIT_MSB) && (valueL != 0)));
+        else overflow = ((valueH & OMW_64BIT_MSB) != 0);
+    }
+
+    if (overflow) r.ec = std::errc::result_out_of_range;
+    else
+    {
+        if (negative)
+        {
+            h = 0;
+            l = 0;
+            omw::internal::int128::sub(h, l, valueH, valueL);
+        }
+        else
+        {
+            h = valueH;
+            l = valueL;
+        }
+
+        r.ec = std::errc();
+    }
+
+    return r;
+}
+
 //// out_t and in_t have to be std::vector<omw::string> and std::vector<std::string> or vice versa.
 // template <class out_t, class in_t>
 // out_t convertStringVector(const in_t& stringVector)
@@ -122,6 +414,18 @@ omw::Base_Int128 hexstointeger128(const std::string& str, const std::string& fnN
 //     return r;
 // }
 
+const omw::CharSet& newLineSet()
+{
+    static const omw::CharSet set("\r\n", 2);
+    return set;
+}
+
+const omw::CharSet& hexSet()
+{
+    static const omw::CharSet set = omw::CharSet(omw::hexStrDigitsUpper).add("abcdef", 6);
+    return set;
+}
+
 } // namespace
 
 
@@ -217,31 +521,472 @@ std::string& omw::upper_asciiExt(std::string& str)
                                           omw::StringReplacePair(omw::UTF8CP_ouml, omw::UTF8CP_Ouml),
                                           omw::StringReplacePair(omw::UTF8CP_uuml, omw::UTF8CP_Uuml) };
 
-    return omw::replaceAll(str, rp, (sizeof(rp) / sizeof(rp[0])));
+    return omw::replaceAll(str, rp, (sizeof(rp) / sizeof(rp[0])));
+}
+
+std::string omw::toLower_ascii(const std::string& str)
+{
+    std::string res = str;
+    return omw::lower_ascii(res);
+}
+
+std::string omw::toLower_asciiExt(const std::string& str)
+{
+    std::string res = str;
+    return omw::lower_asciiExt(res);
+}
+
+std::string omw::toUpper_ascii(const std::string& str)
+{
+    std::string res = str;
+    return omw::upper_ascii(res);
+}
+
+std::string omw::toUpper_asciiExt(const std::string& str)
+{
+    std::string res = str;
+    return omw::upper_asciiExt(res);
+}
+
+
+
+namespace {
+
+// Substring search kernels, `m >= 2`. Return a pointer to the first occurrence of the needle in [p, last), or `last`.
+using find_kernel_t = const char* (*)(const char* p, const char* last, const char* needle, size_t m);
+
+const char* findKernel_scalar(const char* p, const char* last, const char* needle, size_t m)
+{
+    const char first = needle[0];
+
+    while ((last - p) >= static_cast<ptrdiff_t>(m))
+    {
+        p = static_cast<const char*>(std::memchr(p, first, static_cast<size_t>(last - p) - m + 1));
+        if (!p) break;
+        if ((p[m - 1] == needle[m - 1]) && (std::memcmp(p + 1, needle + 1, m - 2) == 0)) return p;
+        ++p;
+    }
+
+    return last;
+}
+
+#ifdef OMWi_X86_DISPATCH
+
+// Candidates are the positions where the first and the last byte of the needle match, only those are compared.
+const char* findKernel_sse2(const char* p, const char* last, const char* needle, size_t m)
+{
+    const __m128i first = _mm_set1_epi8(needle[0]);
+    const __m128i back = _mm_set1_epi8(needle[m - 1]);
+
+    for (; (last - p) >= static_cast<ptrdiff_t>(m - 1 + 16); p += 16)
+    {
+        const __m128i f = _mm_cmpeq_epi8(first, _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+        const __m128i b = _mm_cmpeq_epi8(back, _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + m - 1)));
+        unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(_mm_and_si128(f, b)));
+
+        while (mask != 0)
+        {
+            const char* const candidate = p + omw::countTrailingZeros(mask);
+            if (std::memcmp(candidate + 1, needle + 1, m - 2) == 0) return candidate;
+            mask &= (mask - 1);
+        }
+    }
+
+    return findKernel_scalar(p, last, needle, m);
+}
+
+OMWi_TARGET("avx2") const char* findKernel_avx2(const char* p, const char* last, const char* needle, size_t m)
+{
+    const __m256i first = _mm256_set1_epi8(needle[0]);
+    const __m256i back = _mm256_set1_epi8(needle[m - 1]);
+
+    for (; (last - p) >= static_cast<ptrdiff_t>(m - 1 + 32); p += 32)
+    {
+        const __m256i f = _mm256_cmpeq_epi8(first, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)));
+        const __m256i b = _mm256_cmpeq_epi8(back, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + m - 1)));
+        uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_and_si256(f, b)));
+
+        while (mask != 0)
+        {
+            const char* const candidate = p + omw::countTrailingZeros(mask);
+            if (std::memcmp(candidate + 1, needle + 1, m - 2) == 0)
+            {
+                _mm256_zeroupper();
+                return candidate;
+            }
+            mask &= (mask - 1);
+        }
+    }
+
+    _mm256_zeroupper();
+
+    return findKernel_scalar(p, last, needle, m);
+}
+
+#endif // OMWi_X86_DISPATCH
+
+find_kernel_t findKernel()
+{
+#ifdef OMWi_X86_DISPATCH
+    static const find_kernel_t kernel = (omw::internal::cpu::hasAvx2() ? findKernel_avx2 : findKernel_sse2);
+#else
+    static const find_kernel_t kernel = findKernel_scalar;
+#endif
+
+    return kernel;
+}
+
+// Returns a pointer to the first occurrence of the needle in [first, last), or `last`. `m > 0`
+const char* findSubstr(const char* first, const char* last, const char* needle, size_t m)
+{
+    if (m == 1)
+    {
+        const void* const p = std::memchr(first, *needle, static_cast<size_t>(last - first));
+        return (p ? static_cast<const char*>(p) : last);
+    }
+
+    return findKernel()(first, last, needle, m);
+}
+
+// Replaces all non overlapping occurrences at or after `startPos`, `find(first, last)` returns a pointer to the next
+// occurrence or `last`. Shrinking replacements are done in place, growing ones are counted first and built into a
+// string of the final size. Either way each byte is moved at most once.
+template <class Finder>
+size_t replaceAll_impl(std::string& str, std::string::size_type startPos, size_t searchLen, const std::string& replace, const Finder& find)
+{
+    if (startPos >= str.size()) return 0;
+
+    char* const data = &str[0];
+    const char* const end = data + str.size();
+    const char* src = find(data + startPos, end);
+    size_t cnt = 0;
+
+    if (src == end) return 0;
+
+    if (replace.size() <= searchLen)
+    {
+        char* dst = data + (src - data);
+
+        while (src != end)
+        {
+            std::memcpy(dst, replace.data(), replace.size());
+            dst += replace.size();
+            src += searchLen;
+            ++cnt;
+
+            const char* const next = find(src, end);
+            if (dst != src) { std::memmove(dst, src, static_cast<size_t>(next - src)); }
+            dst += (next - src);
+            src = next;
+        }
+
+        str.resize(static_cast<std::string::size_type>(dst - data));
+    }
+    else
+    {
+        for (const char* p = src; p != end; p = find(p + searchLen, end)) { ++cnt; }
+
+        std::string r;
+        r.reserve(str.size() + cnt * (replace.size() - searchLen));
+        r.append(data, static_cast<size_t>(src - data));
+
+        while (src != end)
+        {
+            r.append(replace);
+            src += searchLen;
+
+            const char* const next = find(src, end);
+            r.append(src, static_cast<size_t>(next - src));
+            src = next;
+        }
+
+        str.swap(r);
+    }
+
+    return cnt;
+}
+
+} // namespace
+
+
+
+namespace {
+
+// Start of the maximal suffix of `x` minus 1, for the order `<` or, if `reversed`, `>`, and its period.
+ptrdiff_t maxSuffix(const uint8_t* x, ptrdiff_t m, bool reversed, size_t& period)
+{
+    ptrdiff_t ms = -1;
+    ptrdiff_t j = 0;
+    ptrdiff_t k = 1;
+    ptrdiff_t p = 1;
+
+    while ((j + k) < m)
+    {
+        const uint8_t a = x[j + k];
+        const uint8_t b = x[ms + k];
+
+        if (reversed ? (a > b) : (a < b))
+        {
+            j += k;
+            k = 1;
+            p = j - ms;
+        }
+        else if (a == b)
+        {
+            if (k != p) { ++k; }
+            else
+            {
+                j += p;
+                k = 1;
+            }
+        }
+        else
+        {
+            ms = j;
+            j = ms + 1;
+            k = 1;
+            p = 1;
+        }
+    }
+
+    period = static_cast<size_t>(p);
+
+    return ms;
+}
+
+} // namespace
+
+
+
+/*!
+ * \class omw::Searcher
+ *
+ * Used by the `omw::contains()`, `omw::replaceFirst()`, `omw::replaceAll()` and `omw::split()` overloads to search the
+ * same needle in many strings.
+ */
+
+omw::Searcher::Searcher()
+    : m_needle(), m_algo(ALGO_AUTO), m_shift(), m_ell(0), m_period(0), m_periodic(false)
+{
+    m_init(ALGO_AUTO);
+}
+
+omw::Searcher::Searcher(const std::string& needle, ALGO algorithm)
+    : m_needle(needle), m_algo(ALGO_AUTO), m_shift(), m_ell(0), m_period(0), m_periodic(false)
+{
+    m_init(algorithm);
+}
+
+//! @param needle Null terminated needle
+//! @param algorithm
+//!
+//! \b Exceptions
+//! - `std::invalid_argument` if `needle` is _null_
+//!
+omw::Searcher::Searcher(const char* needle, ALGO algorithm)
+    : m_needle(), m_algo(ALGO_AUTO), m_shift(), m_ell(0), m_period(0), m_periodic(false)
+{
+    if (!needle) throw std::invalid_argument(OMWi_DISPSTR("omw::Searcher::Searcher"));
+
+    m_needle.assign(needle);
+    m_init(algorithm);
+}
+
+//!
+//! \b Exceptions
+//! - `std::invalid_argument` if `needle` is _null_ and `count` is not 0
+//!
+omw::Searcher::Searcher(const char* needle, size_t count, ALGO algorithm)
+    : m_needle(), m_algo(ALGO_AUTO), m_shift(), m_ell(0), m_period(0), m_periodic(false)
+{
+    if (!needle && (count > 0)) throw std::invalid_argument(OMWi_DISPSTR("omw::Searcher::Searcher"));
+
+    m_needle.assign(needle, count);
+    m_init(algorithm);
+}
+
+//! @return Pointer to the first occurrence of the needle in [first, last), or `last`
+//!
+//! \b Exceptions
+//! - `std::invalid_argument` if the range is invalid
+//!
+const char* omw::Searcher::find(const char* first, const char* last) const
+{
+    if ((!first && last) || (first > last)) throw std::invalid_argument(OMWi_DISPSTR("omw::Searcher::find"));
+
+    const size_t m = m_needle.size();
+
+    if (m == 0) return first;
+    if (static_cast<size_t>(last - first) < m) return last;
+
+    const char* r;
+
+    switch (m_algo)
+    {
+    case ALGO_BMH:
+        r = m_findBmh(first, last);
+        break;
+
+    case ALGO_TWOWAY:
+        r = m_findTwoWay(first, last);
+        break;
+
+    default:
+        r = findSubstr(first, last, m_needle.data(), m);
+        break;
+    }
+
+    return r;
+}
+
+//! @return Position of the first occurrence of the needle at or after `pos`, or `std::string::npos`
+std::string::size_type omw::Searcher::find(const std::string& str, std::string::size_type pos) const
+{
+    if (pos > str.size()) return std::string::npos;
+
+    const char* const last = str.data() + str.size();
+    const char* const p = find(str.data() + pos, last);
+
+    return (((p == last) && !m_needle.empty()) ? std::string::npos : static_cast<std::string::size_type>(p - str.data()));
+}
+
+void omw::Searcher::m_init(ALGO algorithm)
+{
+    const size_t m = m_needle.size();
+
+    if (algorithm == ALGO_AUTO)
+    {
+        if (m <= 32) { m_algo = ALGO_SIMD; }
+        else if (m <= 256) { m_algo = ALGO_BMH; }
+        else { m_algo = ALGO_TWOWAY; }
+    }
+    else { m_algo = algorithm; }
+
+    if (m == 0) return;
+
+    const uint8_t* const x = reinterpret_cast<const uint8_t*>(m_needle.data());
+
+    if (m_algo == ALGO_BMH)
+    {
+        m_shift.assign(256, m);
+        for (size_t i = 0; i < (m - 1); ++i) { m_shift[x[i]] = m - 1 - i; }
+    }
+    else if (m_algo == ALGO_TWOWAY)
+    {
+        size_t p, q;
+        const ptrdiff_t i = maxSuffix(x, static_cast<ptrdiff_t>(m), false, p);
+        const ptrdiff_t j = maxSuffix(x, static_cast<ptrdiff_t>(m), true, q);
+
+        if (i > j)
+        {
+            m_ell = i;
+            m_period = p;
+        }
+        else
+        {
+            m_ell = j;
+            m_period = q;
+        }
+
+        m_periodic = ((m_period < m) && (std::memcmp(x, x + m_period, static_cast<size_t>(m_ell + 1)) == 0));
+
+        if (!m_periodic) { m_period = std::max(static_cast<size_t>(m_ell + 1), m - static_cast<size_t>(m_ell + 1)) + 1; }
+
+        m_shift.assign(256, m);
+        for (size_t k = 0; k < m; ++k) { m_shift[x[k]] = m - 1 - k; }
+    }
 }
 
-std::string omw::toLower_ascii(const std::string& str)
+const char* omw::Searcher::m_findBmh(const char* first, const char* last) const
 {
-    std::string res = str;
-    return omw::lower_ascii(res);
-}
+    const size_t m = m_needle.size();
+    const char* const x = m_needle.data();
+    const char back = x[m - 1];
 
-std::string omw::toLower_asciiExt(const std::string& str)
-{
-    std::string res = str;
-    return omw::lower_asciiExt(res);
-}
+    for (const char* p = first; static_cast<size_t>(last - p) >= m;)
+    {
+        const char c = p[m - 1];
+        if ((c == back) && (std::memcmp(p, x, m - 1) == 0)) return p;
+        p += m_shift[static_cast<uint8_t>(c)];
+    }
 
-std::string omw::toUpper_ascii(const std::string& str)
-{
-    std::string res = str;
-    return omw::upper_ascii(res);
+    return last;
 }
 
-std::string omw::toUpper_asciiExt(const std::string& str)
+// Crochemore-Perrin, the right part of the needle (from the critical position) is compared left to right, then the left
+// part right to left. For periodic needles the already matched prefix is remembered. The last byte of the window is
+// checked first against a bad character table, which skips most of the windows in practice.
+const char* omw::Searcher::m_findTwoWay(const char* first, const char* last) const
 {
-    std::string res = str;
-    return omw::upper_asciiExt(res);
+    const size_t m = m_needle.size();
+    const size_t n = static_cast<size_t>(last - first);
+    const size_t suffix = static_cast<size_t>(m_ell + 1);
+    const uint8_t* const x = reinterpret_cast<const uint8_t*>(m_needle.data());
+    const uint8_t* const y = reinterpret_cast<const uint8_t*>(first);
+    size_t j = 0;
+
+    if (m_periodic)
+    {
+        size_t memory = 0; // length of the prefix known to match
+
+        while (j <= (n - m))
+        {
+            size_t shift = m_shift[y[j + m - 1]];
+            if (shift > 0)
+            {
+                // the last period has a mismatch, no match until after it
+                if ((memory > 0) && (shift < m_period)) { shift = m - m_period; }
+                memory = 0;
+                j += shift;
+                continue;
+            }
+
+            size_t i = std::max(suffix, memory);
+            while ((i < (m - 1)) && (x[i] == y[i + j])) { ++i; }
+
+            if (i >= (m - 1))
+            {
+                i = suffix;
+                while ((i > memory) && (x[i - 1] == y[i - 1 + j])) { --i; }
+                if (i <= memory) return (first + j);
+
+                j += m_period;
+                memory = m - m_period;
+            }
+            else
+            {
+                j += (i - suffix + 1);
+                memory = 0;
+            }
+        }
+    }
+    else
+    {
+        while (j <= (n - m))
+        {
+            const size_t shift = m_shift[y[j + m - 1]];
+            if (shift > 0)
+            {
+                j += shift;
+                continue;
+            }
+
+            size_t i = suffix;
+            while ((i < (m - 1)) && (x[i] == y[i + j])) { ++i; }
+
+            if (i >= (m - 1))
+            {
+                i = suffix;
+                while ((i > 0) && (x[i - 1] == y[i - 1 + j])) { --i; }
+                if (i == 0) return (first + j);
+
+                j += m_period;
+            }
+            else { j += (i - suffix + 1); }
+        }
+    }
+
+    return last;
 }
 
 
@@ -258,6 +1003,18 @@ std::string& omw::replaceFirst(std::string& str, const std::string& search, cons
     return str;
 }
 
+//! @param [in,out] str
+//! @param search Compiled substring to be replaced
+//! @param replace String for replacement
+//! @param startPos From where to start searching
+//! @return The parameter `str`
+std::string& omw::replaceFirst(std::string& str, const omw::Searcher& search, const std::string& replace, std::string::size_type startPos)
+{
+    std::string::size_type pos = search.find(str, startPos);
+    if ((pos < str.length()) && (pos != std::string::npos)) str.replace(pos, search.size(), replace);
+    return str;
+}
+
 //! @param [in,out] str
 //! @param search Character to be replaced
 //! @param replace Character for replacement
@@ -310,19 +1067,53 @@ std::string& omw::replaceAll(std::string& str, const std::string& search, char r
 //! @param startPos From where to start searching
 //! @param [out] nReplacements Number of occurrences
 //! @return The parameter `str`
+//!
+//! Runs in linear time, the string is rebuilt in one pass instead of replacing the occurrences one by one.
+//!
 std::string& omw::replaceAll(std::string& str, const std::string& search, const std::string& replace, std::string::size_type startPos, size_t* nReplacements)
 {
+    if ((&search == &str) || (&replace == &str))
+    {
+        const std::string tmpSearch = search;
+        const std::string tmpReplace = replace;
+        return omw::replaceAll(str, tmpSearch, tmpReplace, startPos, nReplacements);
+    }
+
     size_t cnt = 0;
 
     if (search.length() > 0)
     {
-        std::string::size_type pos = str.find(search, startPos);
-        while ((pos < str.length()) && (pos != std::string::npos))
-        {
-            str.replace(pos, search.length(), replace);
-            ++cnt;
-            pos = str.find(search, pos + replace.length());
-        }
+        const char* const needle = search.data();
+        const size_t m = search.length();
+
+        cnt = replaceAll_impl(str, startPos, m, replace, [needle, m](const char* first, const char* last) { return findSubstr(first, last, needle, m); });
+    }
+    else cnt = OMW_SIZE_MAX;
+
+    if (nReplacements) *nReplacements = cnt;
+
+    return str;
+}
+
+//! @param [in,out] str
+//! @param search Compiled substring to be replaced
+//! @param replace String for replacement
+//! @param startPos From where to start searching
+//! @param [out] nReplacements Number of occurrences
+//! @return The parameter `str`
+std::string& omw::replaceAll(std::string& str, const omw::Searcher& search, const std::string& replace, std::string::size_type startPos, size_t* nReplacements)
+{
+    if (&replace == &str)
+    {
+        const std::string tmpReplace = replace;
+        return omw::replaceAll(str, search, tmpReplace, startPos, nReplacements);
+    }
+
+    size_t cnt = 0;
+
+    if (!search.empty())
+    {
+        cnt = replaceAll_impl(str, startPos, search.size(), replace, [&search](const char* first, const char* last) { return search.find(first, last); });
     }
     else cnt = OMW_SIZE_MAX;
 
@@ -347,16 +1138,32 @@ std::string& omw::replaceAll(std::string& str, const omw::StringReplacePair& pai
 //! @param [out] nReplacementsTotal Total number of occurrences
 //! @param [out] nReplacements Number of occurrences of specific replace pair
 //! @return The parameter `str`
+//!
+//! The pairs are applied one after the other, see `omw::MultiReplacer` to replace them simultaneously in a single pass.
+//!
 std::string& omw::replaceAll(std::string& str, const std::vector<omw::StringReplacePair>& pairs, std::string::size_type startPos, size_t* nReplacementsTotal,
                              std::vector<size_t>* nReplacements)
+{
+    return omw::replaceAll(str, pairs.data(), pairs.size(), startPos, nReplacementsTotal, nReplacements);
+}
+
+//! @param [in,out] str
+//! @param pairs Pointer to a replace pair array
+//! @param count
+//! @param startPos From where to start searching
+//! @param [out] nReplacementsTotal Total number of occurrences
+//! @param [out] nReplacements Number of occurrences of specific replace pair
+//! @return The parameter `str`
+std::string& omw::replaceAll(std::string& str, const omw::StringReplacePair* pairs, size_t count, std::string::size_type startPos, size_t* nReplacementsTotal,
+                             std::vector<size_t>* nReplacements)
 {
     bool allInvalid = true;
     size_t cnt = 0;
     size_t tmpCnt;
 
-    if (nReplacements) *nReplacements = std::vector<size_t>(pairs.size(), OMW_SIZE_MAX);
+    if (nReplacements) *nReplacements = std::vector<size_t>(count, OMW_SIZE_MAX);
 
-    for (size_t i = 0; i < pairs.size(); ++i)
+    for (size_t i = 0; i < count; ++i)
     {
         omw::replaceAll(str, pairs[i], startPos, &tmpCnt);
         if (nReplacements) nReplacements->at(i) = tmpCnt;
@@ -374,17 +1181,219 @@ std::string& omw::replaceAll(std::string& str, const std::vector<omw::StringRepl
     return str;
 }
 
+
+
+/*!
+ * \class omw::MultiReplacer
+ *
+ * The automaton is a DFA over character classes: every byte used in a search string has its own class, all other bytes
+ * share class 0. This keeps the transition table small for large sets of pairs.
+ *
+ * Matches are found in one forward pass. After a match is taken, the scan continues behind it, so the bytes between the
+ * end of the match and the current position (less than the longest search string) are read again. The result is built
+ * into a string of the exact final size.
+ */
+
+omw::MultiReplacer::MultiReplacer()
+    : m_pairs(), m_delta(), m_depth(), m_match(), m_class(), m_nClasses(0)
+{
+    m_build();
+}
+
+omw::MultiReplacer::MultiReplacer(const std::vector<omw::StringReplacePair>& pairs)
+    : m_pairs(pairs), m_delta(), m_depth(), m_match(), m_class(), m_nClasses(0)
+{
+    m_build();
+}
+
+//!
+//! \b Exceptions
+//! - `std::invalid_argument` if `pairs` is _null_ and `count` is not 0
+//!
+omw::MultiReplacer::MultiReplacer(const omw::StringReplacePair* pairs, size_t count)
+    : m_pairs(), m_delta(), m_depth(), m_match(), m_class(), m_nClasses(0)
+{
+    if (!pairs && (count > 0)) throw std::invalid_argument(OMWi_DISPSTR("omw::MultiReplacer::MultiReplacer"));
+
+    m_pairs.assign(pairs, pairs + count);
+    m_build();
+}
+
 //! @param [in,out] str
-//! @param pairs Pointer to a replace pair array
-//! @param count
 //! @param startPos From where to start searching
-//! @param [out] nReplacementsTotal Total number of occurrences
-//! @param [out] nReplacements Number of occurrences of specific replace pair
+//! @param [out] nReplacementsTotal Total number of occurrences, `OMW_SIZE_MAX` if all search strings are empty
+//! @param [out] nReplacements Number of occurrences of specific replace pair, `OMW_SIZE_MAX` for empty search strings
 //! @return The parameter `str`
-std::string& omw::replaceAll(std::string& str, const omw::StringReplacePair* pairs, size_t count, std::string::size_type startPos, size_t* nReplacementsTotal,
-                             std::vector<size_t>* nReplacements)
+std::string& omw::MultiReplacer::replaceAll(std::string& str, std::string::size_type startPos, size_t* nReplacementsTotal,
+                                            std::vector<size_t>* nReplacements) const
+{
+    constexpr uint32_t none = UINT32_MAX;
+
+    // (position, pair index) of the matches
+    std::vector<std::pair<std::string::size_type, uint32_t>> matches;
+
+    const std::string::size_type n = str.size();
+    std::string::size_type i = startPos;
+    uint32_t state = 0;
+    std::string::size_type candPos = 0;
+    uint32_t candPair = none;
+
+    while (true)
+    {
+        if (i >= n)
+        {
+            if (candPair == none) break;
+        }
+        else
+        {
+            state = m_delta[state * m_nClasses + m_class[static_cast<uint8_t>(str[i])]];
+            ++i;
+
+            const uint32_t m = m_match[state];
+            if (m != none)
+            {
+                const std::string::size_type len = m_pairs[m].search().size();
+                const std::string::size_type pos = i - len;
+
+                if ((candPair == none) || (pos < candPos) || ((pos == candPos) && (len > m_pairs[candPair].search().size())))
+                {
+                    candPos = pos;
+                    candPair = m;
+                }
+            }
+
+            // no later match can start at or before the candidate
+            if ((candPair == none) || ((i - m_depth[state]) <= candPos)) continue;
+        }
+
+        matches.push_back(std::make_pair(candPos, candPair));
+        i = candPos + m_pairs[candPair].search().size();
+        state = 0;
+        candPair = none;
+    }
+
+    if (!matches.empty())
+    {
+        std::string::size_type size = n;
+        for (const auto& match : matches) { size = size - m_pairs[match.second].search().size() + m_pairs[match.second].replace().size(); }
+
+        std::string r;
+        r.reserve(size);
+
+        std::string::size_type pos = 0;
+        for (const auto& match : matches)
+        {
+            const omw::StringReplacePair& pair = m_pairs[match.second];
+            r.append(str, pos, match.first - pos);
+            r.append(pair.replace());
+            pos = match.first + pair.search().size();
+        }
+        r.append(str, pos, std::string::npos);
+
+        str.swap(r);
+    }
+
+    if (nReplacements || nReplacementsTotal)
+    {
+        std::vector<size_t> cnt(m_pairs.size(), 0);
+        bool allInvalid = true;
+        size_t total = 0;
+
+        for (const auto& match : matches) { ++cnt[match.second]; }
+
+        for (size_t k = 0; k < m_pairs.size(); ++k)
+        {
+            if (m_pairs[k].search().empty()) { cnt[k] = OMW_SIZE_MAX; }
+            else
+            {
+                total += cnt[k];
+                allInvalid = false;
+            }
+        }
+
+        if (nReplacements) *nReplacements = cnt;
+        if (nReplacementsTotal) *nReplacementsTotal = (allInvalid ? OMW_SIZE_MAX : total);
+    }
+
+    return str;
+}
+
+void omw::MultiReplacer::m_build()
 {
-    return omw::replaceAll(str, std::vector<omw::StringReplacePair>(pairs, pairs + count), startPos, nReplacementsTotal, nReplacements);
+    constexpr uint32_t none = UINT32_MAX;
+
+    // character classes
+    std::memset(m_class, 0, sizeof(m_class));
+    m_nClasses = 1;
+    for (const auto& pair : m_pairs)
+    {
+        for (const char c : pair.search())
+        {
+            uint16_t& cls = m_class[static_cast<uint8_t>(c)];
+            if (cls == 0) { cls = static_cast<uint16_t>(m_nClasses++); }
+        }
+    }
+
+    // trie
+    m_delta.assign(m_nClasses, none);
+    m_depth.assign(1, 0);
+    m_match.assign(1, none);
+
+    for (size_t k = 0; k < m_pairs.size(); ++k)
+    {
+        const std::string& search = m_pairs[k].search();
+        if (search.empty()) continue;
+
+        uint32_t state = 0;
+        for (const char c : search)
+        {
+            const size_t idx = state * m_nClasses + m_class[static_cast<uint8_t>(c)];
+            if (m_delta[idx] == none)
+            {
+                m_delta[idx] = static_cast<uint32_t>(m_depth.size());
+                m_delta.resize(m_delta.size() + m_nClasses, none);
+                m_depth.push_back(m_depth[state] + 1);
+                m_match.push_back(none);
+            }
+            state = m_delta[idx];
+        }
+
+        if (m_match[state] == none) { m_match[state] = static_cast<uint32_t>(k); }
+    }
+
+    // failure links in BFS order, the missing transitions are taken from the failure state
+    std::vector<uint32_t> fail(m_depth.size(), 0);
+    std::vector<uint32_t> queue;
+    queue.reserve(m_depth.size());
+
+    for (size_t c = 0; c < m_nClasses; ++c)
+    {
+        uint32_t& next = m_delta[c];
+        if (next == none) { next = 0; }
+        else { queue.push_back(next); }
+    }
+
+    for (size_t q = 0; q < queue.size(); ++q)
+    {
+        const uint32_t state = queue[q];
+        const uint32_t f = fail[state];
+
+        // the own search string is the longest suffix
+        if (m_match[state] == none) { m_match[state] = m_match[f]; }
+
+        for (size_t c = 0; c < m_nClasses; ++c)
+        {
+            uint32_t& next = m_delta[state * m_nClasses + c];
+            const uint32_t fnext = m_delta[f * m_nClasses + c];
+
+            if (next == none) { next = fnext; }
+            else
+            {
+                fail[next] = fnext;
+                queue.push_back(next);
+            }
+        }
+    }
 }
 
 
@@ -398,20 +1407,92 @@ std::string omw::toString(bool value, bool asText)
 
 std::string omw::toString(const omw::int128_t& value)
 {
-    const omw::uint128_t tmp(value);
-    return (value.isNegative() ? "-" + omw::toString(-tmp) : omw::toString(tmp));
+    char buffer[omw::toChars128_maxLength];
+    const omw::ToCharsResult res = omw::toChars(buffer, buffer + sizeof(buffer), value);
+    return std::string(buffer, res.ptr);
 }
 
 std::string omw::toString(const omw::uint128_t& value)
 {
-    const std::string str = omw::toHexStr(omw::doubleDabble(value), 0);
-    size_t startPos = 0;
+    char buffer[omw::toChars128_maxLength];
+    const omw::ToCharsResult res = omw::toChars(buffer, buffer + sizeof(buffer), value);
+    return std::string(buffer, res.ptr);
+}
+
+
+
+//! @param first Begin of the destination buffer
+//! @param last End of the destination buffer
+//! @param value The value to convert
+//! @return `ptr` points one past the last written character, `ec` is value initialized. If the buffer is too small, `ptr`
+//! is `last` and `ec` is `std::errc::value_too_large`
+//!
+//! Writes the decimal representation without leading zeros and without a null terminator into the buffer, like
+//! `std::to_chars()`. Doesn't allocate, at most `omw::toChars128_maxLength` characters are written.
+//!
+omw::ToCharsResult omw::toChars(char* first, char* last, const omw::int128_t& value)
+{
+    return ::int128_toChars(first, last, value.hi(), value.lo(), value.isNegative());
+}
+
+//! See `omw::toChars(char*, char*, const omw::int128_t&)`.
+//!
+omw::ToCharsResult omw::toChars(char* first, char* last, const omw::uint128_t& value) { return ::int128_toChars(first, last, value.hi(), value.lo(), false); }
+
+//! @param first Begin of the string
+//! @param last End of the string
+//! @param [out] value Is set to the parsed value on success, unchanged otherwise
+//! @return `ptr` points one past the last digit, `ec` is value initialized. If there are no digits at `first`, `ptr` is
+//! `first` and `ec` is `std::errc::invalid_argument`. If the value is out of range, `ec` is `std::errc::result_out_of_range`.
+//!
+//! Parses an optional minus sign followed by decimal digits, like `std::from_chars()`. Neither leading white spaces nor a
+//! plus sign are accepted. Eight digits at a time are converted with SWAR arithmetic.
+//!
+omw::FromCharsResult omw::fromChars(const char* first, const char* last, omw::int128_t& value)
+{
+    uint64_t h = 0, l = 0;
+    const omw::FromCharsResult r = ::int128_fromChars(first, last, h, l, true);
+    if (r.ec == std::errc()) value.set(h, l);
+    return r;
+}
+
+//! See `omw::fromChars(const char*, const char*, omw::int128_t&)`, a minus sign is not accepted.
+//!
+omw::FromCharsResult omw::fromChars(const char* first, const char* last, omw::uint128_t& value)
+{
+    uint64_t h = 0, l = 0;
+    const omw::FromCharsResult r = ::int128_fromChars(first, last, h, l, false);
+    if (r.ec == std::errc()) value.set(h, l);
+    return r;
+}
+
+#if (OMW_CPPSTD >= OMW_CPPSTD_14)
+
+omw::ToCharsResult omw::toChars(char* first, char* last, const omw::i128& value)
+{
+    return ::int128_toChars(first, last, value.hi(), value.lo(), value.isNegative());
+}
+
+omw::ToCharsResult omw::toChars(char* first, char* last, const omw::u128& value) { return ::int128_toChars(first, last, value.hi(), value.lo(), false); }
 
-    while ((str[startPos] == '0') && (startPos < (str.length() - 1))) { ++startPos; }
+omw::FromCharsResult omw::fromChars(const char* first, const char* last, omw::i128& value)
+{
+    uint64_t h = 0, l = 0;
+    const omw::FromCharsResult r = ::int128_fromChars(first, last, h, l, true);
+    if (r.ec == std::errc()) value = omw::i128(h, l);
+    return r;
+}
 
-    return std::string(str, startPos);
+omw::FromCharsResult omw::fromChars(const char* first, const char* last, omw::u128& value)
+{
+    uint64_t h = 0, l = 0;
+    const omw::FromCharsResult r = ::int128_fromChars(first, last, h, l, false);
+    if (r.ec == std::errc()) value = omw::u128(h, l);
+    return r;
 }
 
+#endif // C++14
+
 std::string omw::toString(const std::pair<int32_t, int32_t>& value, char delimiter) { return ::pair_to_string(value, delimiter); }
 std::string omw::toString(const std::pair<uint32_t, uint32_t>& value, char delimiter) { return ::pair_to_string(value, delimiter); }
 std::string omw::toString(const std::pair<int64_t, int64_t>& value, char delimiter) { return ::pair_to_string(value, delimiter); }
@@ -549,15 +1630,43 @@ std::pair<double, double> omw::stodpair(const std::string& str, char delimiter)
     return std::pair<double, double>(std::stod(first), std::stod(second));
 }
 
-// omw::int128_t omw::stoi128(const std::string& str)
-//{
-//     reversed double dabble needed, wich is not implemented yet
-// }
-//
-// omw::uint128_t omw::stoui128(const std::string& str)
-//{
-//     reversed double dabble needed, wich is not implemented yet
-// }
+//! @param str Decimal string representation, an optional minus sign followed by digits
+//! @return The corresponding value
+//!
+//! \b Exceptions
+//! - `std::invalid_argument` if the string contains invalid characters
+//! - `std::out_of_range` if the value would fall out of range
+//!
+omw::int128_t omw::stoi128(const std::string& str)
+{
+    omw::int128_t r;
+    const char* const last = str.data() + str.length();
+    const omw::FromCharsResult res = omw::fromChars(str.data(), last, r);
+
+    if ((res.ec == std::errc::invalid_argument) || (res.ptr != last)) throw std::invalid_argument("omw::stoi128");
+    if (res.ec == std::errc::result_out_of_range) throw std::out_of_range("omw::stoi128");
+
+    return r;
+}
+
+//! @param str Decimal string representation, digits only
+//! @return The corresponding value
+//!
+//! \b Exceptions
+//! - `std::invalid_argument` if the string contains invalid characters
+//! - `std::out_of_range` if the value would fall out of range
+//!
+omw::uint128_t omw::stoui128(const std::string& str)
+{
+    omw::uint128_t r;
+    const char* const last = str.data() + str.length();
+    const omw::FromCharsResult res = omw::fromChars(str.data(), last, r);
+
+    if ((res.ec == std::errc::invalid_argument) || (res.ptr != last)) throw std::invalid_argument("omw::stoui128");
+    if (res.ec == std::errc::result_out_of_range) throw std::out_of_range("omw::stoui128");
+
+    return r;
+}
 
 
 
@@ -824,11 +1933,20 @@ void omw::rmNonHex(char* str)
 
 void omw::rmNonHex(std::string& str)
 {
-    for (std::string::size_type i = 0; i < str.length();)
+    const omw::CharSet& set = hexSet();
+    char* const data = &str[0];
+    const char* const last = data + str.size();
+    const char* p = set.findNot(data, last);
+    char* dst = data + (p - data);
+
+    // branch free compaction, the runs of hex digits are too short in the typical inputs to be scanned with SIMD
+    for (; p != last; ++p)
     {
-        if (omw::isHex(str[i])) { ++i; }
-        else { str.erase(i, 1); }
+        *dst = *p;
+        dst += (set.contains(*p) ? 1 : 0);
     }
+
+    str.resize(static_cast<std::string::size_type>(dst - data));
 }
 
 
@@ -895,6 +2013,90 @@ omw::StringVector omw::split(const std::string& str, const std::string& delimite
 
 
 
+//! @param str The string to split
+//! @param delimiter Compiled delimiter, if empty the string is not split
+//! @param maxTokenCount Maximal number of tokens, the last one contains the remainder of the string
+//! @return The tokens
+omw::StringVector omw::split(const std::string& str, const omw::Searcher& delimiter, omw::StringVector::size_type maxTokenCount)
+{
+    omw::StringVector r(0);
+
+    if (maxTokenCount > 0)
+    {
+        const omw::StringVector::size_type n = (delimiter.empty() ? 0 : (maxTokenCount - 1));
+        std::string::size_type pos = 0;
+
+        while (pos < std::string::npos)
+        {
+            if (r.size() < n)
+            {
+                const std::string::size_type end = delimiter.find(str, pos);
+                r.push_back(str.substr(pos, end - pos));
+                pos = end;
+                if (pos < std::string::npos) { pos += delimiter.size(); }
+            }
+            else
+            {
+                r.push_back(str.substr(pos));
+                pos = std::string::npos;
+            }
+        }
+    }
+
+    return r;
+}
+
+
+
+#if (OMW_CPPSTD >= OMW_CPPSTD_17)
+
+namespace {
+
+template <typename Delim>
+size_t splitInto_impl(std::string_view str, const Delim& delimiter, std::vector<std::string_view>& tokens, omw::StringVector::size_type maxTokenCount)
+{
+    tokens.clear();
+
+    for (const std::string_view& token : omw::SplitView(str, delimiter, maxTokenCount)) { tokens.push_back(token); }
+
+    return tokens.size();
+}
+
+} // namespace
+
+//! @param str The string to split
+//! @param delimiter The delimiter
+//! @param [out] tokens Receives the tokens, cleared first
+//! @param maxTokenCount Maximal number of tokens, the last one contains the remainder of the string
+//! @return Number of tokens
+//!
+//! Same as `omw::split()` but stores views into `str` to `tokens`. No memory is allocated if the capacity of `tokens`
+//! suffices, so the vector can be reused across calls.
+//!
+//! Requires C++17.
+//!
+size_t omw::splitInto(std::string_view str, char delimiter, std::vector<std::string_view>& tokens, omw::StringVector::size_type maxTokenCount)
+{
+    return splitInto_impl(str, delimiter, tokens, maxTokenCount);
+}
+
+//! @param str The string to split
+//! @param delimiter The delimiter, if empty the string is not split
+//! @param [out] tokens Receives the tokens, cleared first
+//! @param maxTokenCount Maximal number of tokens, the last one contains the remainder of the string
+//! @return Number of tokens
+//!
+//! See `omw::splitInto(std::string_view, char, std::vector<std::string_view>&, omw::StringVector::size_type)`.
+//!
+size_t omw::splitInto(std::string_view str, std::string_view delimiter, std::vector<std::string_view>& tokens, omw::StringVector::size_type maxTokenCount)
+{
+    return splitInto_impl(str, delimiter, tokens, maxTokenCount);
+}
+
+#endif // C++17
+
+
+
 omw::StringVector omw::splitLen(const std::string& str, std::string::size_type tokenLength, omw::StringVector::size_type maxTokenCount)
 {
     omw::StringVector r(0);
@@ -1114,6 +2316,462 @@ size_t omw::peekNewLine(const char* p, const char* end)
 
 
 
+namespace {
+
+// Tables of a `omw::CharSet` used by the scan kernels, see the private members of the class.
+struct ScanTables
+{
+    const uint8_t* rowsLo;
+    const uint8_t* rowsHi;
+    const char* chars;
+};
+
+// Scan kernels, process whole blocks from `p` and return a pointer to the first byte which is (or with `negate` is not)
+// in the set, or to the first unprocessed byte at the end.
+using scan_kernel_t = const char* (*)(const char* p, const char* last, const ScanTables& t, bool negate);
+
+// Count the line breaks (LF, CR and CR+LF) in whole blocks from `p`, `p` is advanced to the first unprocessed byte.
+using count_kernel_t = size_t (*)(const char*& p, const char* last);
+
+#ifdef OMWi_X86_DISPATCH
+
+// Sets with up to 4 members are compared byte by byte.
+const char* scanEqKernel_sse2(const char* p, const char* last, const ScanTables& t, bool negate)
+{
+    const __m128i c0 = _mm_set1_epi8(t.chars[0]);
+    const __m128i c1 = _mm_set1_epi8(t.chars[1]);
+    const __m128i c2 = _mm_set1_epi8(t.chars[2]);
+    const __m128i c3 = _mm_set1_epi8(t.chars[3]);
+    const unsigned int inv = (negate ? 0xFFFFu : 0);
+
+    for (; (last - p) >= 16; p += 16)
+    {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        const __m128i m = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, c0), _mm_cmpeq_epi8(v, c1)),
+                                       _mm_or_si128(_mm_cmpeq_epi8(v, c2), _mm_cmpeq_epi8(v, c3)));
+        const unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(m)) ^ inv;
+        if (mask != 0) return (p + omw::countTrailingZeros(mask));
+    }
+
+    return p;
+}
+
+OMWi_TARGET("avx2") const char* scanEqKernel_avx2(const char* p, const char* last, const ScanTables& t, bool negate)
+{
+    const __m256i c0 = _mm256_set1_epi8(t.chars[0]);
+    const __m256i c1 = _mm256_set1_epi8(t.chars[1]);
+    const __m256i c2 = _mm256_set1_epi8(t.chars[2]);
+    const __m256i c3 = _mm256_set1_epi8(t.chars[3]);
+    const uint32_t inv = (negate ? 0xFFFFFFFFu : 0);
+
+    for (; (last - p) >= 32; p += 32)
+    {
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+        const __m256i m = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, c0), _mm256_cmpeq_epi8(v, c1)),
+                                          _mm256_or_si256(_mm256_cmpeq_epi8(v, c2), _mm256_cmpeq_epi8(v, c3)));
+        const uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(m)) ^ inv;
+        if (mask != 0)
+        {
+            _mm256_zeroupper();
+            return (p + omw::countTrailingZeros(mask));
+        }
+    }
+
+    _mm256_zeroupper();
+
+    return p;
+}
+
+// Arbitrary sets, the low nibble of a byte selects a row bitmap and the high nibble the bit in it. `pshufb` zeroes the
+// bytes with the MSB set, which selects between the two row tables.
+OMWi_TARGET("ssse3") const char* scanNibbleKernel_ssse3(const char* p, const char* last, const ScanTables& t, bool negate)
+{
+    const __m128i rowsLo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(t.rowsLo));
+    const __m128i rowsHi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(t.rowsHi));
+    const __m128i bits = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+    const __m128i nibble = _mm_set1_epi8(0x0F);
+    const __m128i msb = _mm_set1_epi8(-128);
+    const unsigned int inv = (negate ? 0xFFFFu : 0);
+
+    for (; (last - p) >= 16; p += 16)
+    {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        const __m128i rows = _mm_or_si128(_mm_shuffle_epi8(rowsLo, v), _mm_shuffle_epi8(rowsHi, _mm_xor_si128(v, msb)));
+        const __m128i bit = _mm_shuffle_epi8(bits, _mm_and_si128(_mm_srli_epi16(v, 4), nibble));
+        const __m128i m = _mm_cmpeq_epi8(_mm_and_si128(rows, bit), bit);
+        const unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(m)) ^ inv;
+        if (mask != 0) return (p + omw::countTrailingZeros(mask));
+    }
+
+    return p;
+}
+
+OMWi_TARGET("avx2") const char* scanNibbleKernel_avx2(const char* p, const char* last, const ScanTables& t, bool negate)
+{
+    const __m256i rowsLo = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(t.rowsLo)));
+    const __m256i rowsHi = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(t.rowsHi)));
+    const __m256i bits = _mm256_broadcastsi128_si256(_mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128));
+    const __m256i nibble = _mm256_set1_epi8(0x0F);
+    const __m256i msb = _mm256_set1_epi8(-128);
+    const uint32_t inv = (negate ? 0xFFFFFFFFu : 0);
+
+    for (; (last - p) >= 32; p += 32)
+    {
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+        const __m256i rows = _mm256_or_si256(_mm256_shuffle_epi8(rowsLo, v), _mm256_shuffle_epi8(rowsHi, _mm256_xor_si256(v, msb)));
+        const __m256i bit = _mm256_shuffle_epi8(bits, _mm256_and_si256(_mm256_srli_epi16(v, 4), nibble));
+        const __m256i m = _mm256_cmpeq_epi8(_mm256_and_si256(rows, bit), bit);
+        const uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(m)) ^ inv;
+        if (mask != 0)
+        {
+            _mm256_zeroupper();
+            return (p + omw::countTrailingZeros(mask));
+        }
+    }
+
+    _mm256_zeroupper();
+
+    return p;
+}
+
+// A CR directly followed by a LF is not counted, the LF is. The byte after the block is peeked to detect a CR+LF
+// crossing the block boundary.
+size_t countKernel_sse2(const char*& p, const char* last)
+{
+    const __m128i lf = _mm_set1_epi8(0x0A);
+    const __m128i cr = _mm_set1_epi8(0x0D);
+    size_t n = 0;
+
+    for (; (last - p) >= 16; p += 16)
+    {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        const unsigned int mLf = static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, lf)));
+        unsigned int mCr = static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, cr)));
+
+        if (mCr != 0)
+        {
+            unsigned int follow = (mLf >> 1);
+            if (((last - p) > 16) && (p[16] == 0x0A)) { follow |= 0x8000u; }
+            mCr &= ~follow;
+        }
+
+        n += omw::popCount(mLf) + omw::popCount(mCr);
+    }
+
+    return n;
+}
+
+OMWi_TARGET("avx2") size_t countKernel_avx2(const char*& p, const char* last)
+{
+    const __m256i lf = _mm256_set1_epi8(0x0A);
+    const __m256i cr = _mm256_set1_epi8(0x0D);
+    size_t n = 0;
+
+    for (; (last - p) >= 32; p += 32)
+    {
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+        const uint32_t mLf = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, lf)));
+        uint32_t mCr = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, cr)));
+
+        if (mCr != 0)
+        {
+            uint32_t follow = (mLf >> 1);
+            if (((last - p) > 32) && (p[32] == 0x0A)) { follow |= 0x80000000u; }
+            mCr &= ~follow;
+        }
+
+        n += omw::popCount(mLf) + omw::popCount(mCr);
+    }
+
+    _mm256_zeroupper();
+
+    return n;
+}
+
+#else // OMWi_X86_DISPATCH
+
+const char* scanKernel_none(const char* p, const char*, const ScanTables&, bool) { return p; }
+
+size_t countKernel_none(const char*&, const char*) { return 0; }
+
+#endif // OMWi_X86_DISPATCH
+
+scan_kernel_t scanEqKernel()
+{
+#ifdef OMWi_X86_DISPATCH
+    static const scan_kernel_t kernel = (omw::internal::cpu::hasAvx2() ? scanEqKernel_avx2 : scanEqKernel_sse2);
+#else
+    static const scan_kernel_t kernel = scanKernel_none;
+#endif
+
+    return kernel;
+}
+
+scan_kernel_t scanNibbleKernel()
+{
+#ifdef OMWi_X86_DISPATCH
+    static const scan_kernel_t kernel = (omw::internal::cpu::hasAvx2()    ? scanNibbleKernel_avx2
+                                         : omw::internal::cpu::hasSsse3() ? scanNibbleKernel_ssse3
+                                                                          : nullptr);
+#else
+    static const scan_kernel_t kernel = scanKernel_none;
+#endif
+
+    return kernel;
+}
+
+count_kernel_t countKernel()
+{
+#ifdef OMWi_X86_DISPATCH
+    static const count_kernel_t kernel = (omw::internal::cpu::hasAvx2() ? countKernel_avx2 : countKernel_sse2);
+#else
+    static const count_kernel_t kernel = countKernel_none;
+#endif
+
+    return kernel;
+}
+
+} // namespace
+
+
+
+omw::CharSet::CharSet()
+    : m_bitmap(), m_rowsLo(), m_rowsHi(), m_chars(), m_count(0)
+{}
+
+omw::CharSet::CharSet(char ch)
+    : m_bitmap(), m_rowsLo(), m_rowsHi(), m_chars(), m_count(0)
+{
+    add(ch);
+}
+
+//! @param chars Null terminated string of the members
+//!
+//! \b Exceptions
+//! - `std::invalid_argument` if `chars` is _null_
+//!
+omw::CharSet::CharSet(const char* chars)
+    : m_bitmap(), m_rowsLo(), m_rowsHi(), m_chars(), m_count(0)
+{
+    if (!chars) throw std::invalid_argument(OMWi_DISPSTR("omw::CharSet::CharSet"));
+    add(chars, std::strlen(chars));
+}
+
+omw::CharSet::CharSet(const char* chars, size_t count)
+    : m_bitmap(), m_rowsLo(), m_rowsHi(), m_chars(), m_count(0)
+{
+    add(chars, count);
+}
+
+omw::CharSet::CharSet(const std::string& chars)
+    : m_bitmap(), m_rowsLo(), m_rowsHi(), m_chars(), m_count(0)
+{
+    add(chars.data(), chars.size());
+}
+
+omw::CharSet& omw::CharSet::add(char ch)
+{
+    if (!contains(ch))
+    {
+        const uint8_t b = static_cast<uint8_t>(ch);
+        const unsigned int h = (b >> 4);
+        const unsigned int l = (b & 0x0F);
+
+        m_bitmap[b >> 6] |= (uint64_t(1) << (b & 0x3F));
+        if (h < 8) { m_rowsLo[l] |= static_cast<uint8_t>(1u << h); }
+        else { m_rowsHi[l] |= static_cast<uint8_t>(1u << (h - 8)); }
+
+        // unused slots repeat the first member, so that always all 4 can be compared
+        if (m_count == 0) { std::memset(m_chars, ch, sizeof(m_chars)); }
+        else if (m_count < 4) { m_chars[m_count] = ch; }
+
+        if (m_count < 5) { ++m_count; }
+    }
+
+    return *this;
+}
+
+//!
+//! \b Exceptions
+//! - `std::invalid_argument` if `chars` is _null_ and `count` is not 0
+//!
+omw::CharSet& omw::CharSet::add(const char* chars, size_t count)
+{
+    if (!chars && (count > 0)) throw std::invalid_argument(OMWi_DISPSTR("omw::CharSet::add"));
+
+    for (size_t i = 0; i < count; ++i) { add(chars[i]); }
+
+    return *this;
+}
+
+//! Adds the bytes in the range [first, last], compared as unsigned values.
+omw::CharSet& omw::CharSet::addRange(char first, char last)
+{
+    const unsigned int l = static_cast<uint8_t>(last);
+    for (unsigned int b = static_cast<uint8_t>(first); b <= l; ++b) { add(static_cast<char>(b)); }
+    return *this;
+}
+
+size_t omw::CharSet::size() const
+{
+    size_t r = 0;
+    for (size_t i = 0; i < 4; ++i) { r += omw::popCount(m_bitmap[i]); }
+    return r;
+}
+
+//! @return Pointer to the first byte in [first, last) which is in the set, or `last`
+//!
+//! \b Exceptions
+//! - `std::invalid_argument` if the range is invalid
+//!
+const char* omw::CharSet::find(const char* first, const char* last) const
+{
+    if ((!first && last) || (first > last)) throw std::invalid_argument(OMWi_DISPSTR("omw::CharSet::find"));
+    return m_scan(first, last, false);
+}
+
+//! @return Pointer to the first byte in [first, last) which is not in the set, or `last`
+//!
+//! \b Exceptions
+//! - `std::invalid_argument` if the range is invalid
+//!
+const char* omw::CharSet::findNot(const char* first, const char* last) const
+{
+    if ((!first && last) || (first > last)) throw std::invalid_argument(OMWi_DISPSTR("omw::CharSet::findNot"));
+    return m_scan(first, last, true);
+}
+
+const char* omw::CharSet::m_scan(const char* first, const char* last, bool negate) const
+{
+    if (m_count == 0) { return (negate ? first : last); }
+
+    const ScanTables tables = { m_rowsLo, m_rowsHi, m_chars };
+    const scan_kernel_t nibbleKernel = scanNibbleKernel();
+    const char* p = first;
+
+    if (m_count <= 4) { p = scanEqKernel()(p, last, tables, negate); }
+    else if (nibbleKernel) { p = nibbleKernel(p, last, tables, negate); }
+
+    while ((p != last) && (contains(*p) == negate)) { ++p; }
+
+    return p;
+}
+
+//! @return Position of the first character at or after `pos` which is in `set`, or `std::string::npos`
+std::string::size_type omw::findFirstOf(const std::string& str, const omw::CharSet& set, std::string::size_type pos)
+{
+    if (pos >= str.size()) return std::string::npos;
+
+    const char* const last = str.data() + str.size();
+    const char* const p = set.find(str.data() + pos, last);
+
+    return ((p == last) ? std::string::npos : static_cast<std::string::size_type>(p - str.data()));
+}
+
+//! @return Position of the first character at or after `pos` which is not in `set`, or `std::string::npos`
+std::string::size_type omw::findFirstNotOf(const std::string& str, const omw::CharSet& set, std::string::size_type pos)
+{
+    if (pos >= str.size()) return std::string::npos;
+
+    const char* const last = str.data() + str.size();
+    const char* const p = set.findNot(str.data() + pos, last);
+
+    return ((p == last) ? std::string::npos : static_cast<std::string::size_type>(p - str.data()));
+}
+
+//! @return Pointer to the first CR or LF in [first, last), or `last`
+//!
+//! \b Exceptions
+//! - `std::invalid_argument` if the range is invalid
+//!
+const char* omw::findNewLine(const char* first, const char* last)
+{
+    if ((!first && last) || (first > last)) throw std::invalid_argument(OMWi_DISPSTR("omw::findNewLine"));
+    return newLineSet().find(first, last);
+}
+
+//! @return Number of lines in [first, last)
+//!
+//! Line breaks are LF, CR and CR+LF (see `omw::peekNewLine()`). A line break at the end does not start a new line, an
+//! empty range has no lines.
+//!
+//! \b Exceptions
+//! - `std::invalid_argument` if the range is invalid
+//!
+size_t omw::countLines(const char* first, const char* last)
+{
+    if ((!first && last) || (first > last)) throw std::invalid_argument(OMWi_DISPSTR("omw::countLines"));
+
+    if (first == last) return 0;
+
+    const char* p = first;
+    size_t n = countKernel()(p, last);
+
+    for (; p != last; ++p)
+    {
+        if (*p == 0x0A) { ++n; }
+        else if ((*p == 0x0D) && (((last - p) < 2) || (*(p + 1) != 0x0A))) { ++n; }
+    }
+
+    const char back = *(last - 1);
+    if ((back != 0x0A) && (back != 0x0D)) { ++n; }
+
+    return n;
+}
+
+size_t omw::countLines(const std::string& str) { return omw::countLines(str.data(), str.data() + str.size()); }
+
+//! @return The lines of `str`, without the line breaks
+//!
+//! Splits at LF, CR and CR+LF, the number of lines is `omw::countLines(str)`.
+//!
+omw::StringVector omw::splitLines(const std::string& str)
+{
+    omw::StringVector r;
+
+    const char* p = str.data();
+    const char* const last = p + str.size();
+
+    while (p != last)
+    {
+        const char* const end = newLineSet().find(p, last);
+        r.push_back(std::string(p, end));
+        p = end + omw::peekNewLine(end, last);
+    }
+
+    return r;
+}
+
+#if (OMW_CPPSTD >= OMW_CPPSTD_17)
+//! @param str The string to split
+//! @param [out] lines Receives the lines, cleared first
+//! @return Number of lines
+//!
+//! Same as `omw::splitLines()` but stores views into `str` to `lines`. No memory is allocated if the capacity of
+//! `lines` suffices.
+//!
+//! Requires C++17.
+//!
+size_t omw::splitLinesInto(std::string_view str, std::vector<std::string_view>& lines)
+{
+    lines.clear();
+
+    const char* p = str.data();
+    const char* const last = p + str.size();
+
+    while (p != last)
+    {
+        const char* const end = newLineSet().find(p, last);
+        lines.push_back(std::string_view(p, static_cast<size_t>(end - p)));
+        p = end + omw::peekNewLine(end, last);
+    }
+
+    return lines.size();
+}
+#endif // C++17
+
+
+
 //!
 //! Reads the data to construct a string from a byte buffer.
 //!
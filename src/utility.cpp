@@ -4,156 +4,284 @@ date            25.01.2022
 copyright       MIT - Copyright (c) 2022 Oliver Blaser
 */
 
-
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
+#include "cpuFeatures.h"
 #include "omw/int.h"
 #include "omw/utility.h"
 
 
-#define OMWi_IMPLEMENT_SHIFTLEFT(T) \
-    T r = value;                    \
-    shiftLeftAssign(r, n);          \
-    return r
+namespace {
 
-#define OMWi_IMPLEMENT_SHIFTRIGHT(T) \
-    T r = value;                     \
-    shiftRightAssign(r, n);          \
-    return r
+// Shift kernels of the byte buffer functions, `0 < b < 8`. Left: `data[i] = (data[i + bs] << b) | (data[i + bs + 1] >> (8 - b))`,
+// processed front to back, returns the number of processed bytes at the front. Right: `data[i] = (data[i - bs] >> b) | (data[i - bs - 1] << (8 - b))`,
+// processed back to front, returns the number of processed bytes at the back.
+using shift_kernel_t = size_t (*)(uint8_t* data, size_t size, size_t bs, unsigned int b);
 
+#ifdef OMWi_X86_DISPATCH
 
-namespace {
+// SSE2 has no 8-bit shifts, the bits crossing a byte boundary in the 16-bit lanes are masked out.
 
-template <typename Ts, typename Tu, unsigned int nBits> void shiftLeftAssign(Ts& value, unsigned int n)
+__m128i shl8_sse2(const __m128i& v0, const __m128i& v1, unsigned int b)
 {
-    if (n < nBits)
+    const __m128i ml = _mm_set1_epi8(static_cast<char>((0xFF << b) & 0xFF));
+    const __m128i mr = _mm_set1_epi8(static_cast<char>(0xFF >> (8 - b)));
+    const __m128i l = _mm_and_si128(_mm_sll_epi16(v0, _mm_cvtsi32_si128(static_cast<int>(b))), ml);
+    const __m128i r = _mm_and_si128(_mm_srl_epi16(v1, _mm_cvtsi32_si128(static_cast<int>(8 - b))), mr);
+    return _mm_or_si128(l, r);
+}
+
+size_t shiftLeftKernel_sse2(uint8_t* data, size_t size, size_t bs, unsigned int b)
+{
+    size_t i = 0;
+
+    for (; (i + bs + 17) <= size; i += 16)
     {
-        const Tu tmp = static_cast<Tu>(value);
-        value = static_cast<Ts>(tmp << n);
+        const __m128i v0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + bs));
+        const __m128i v1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + bs + 1));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(data + i), shl8_sse2(v0, v1, b));
     }
-    else value = 0;
+
+    return i;
 }
 
-template <typename Ts, typename Tu, unsigned int nBits> void shiftRightAssign_pos(Ts& value, unsigned int n)
+size_t shiftRightKernel_sse2(uint8_t* data, size_t size, size_t bs, unsigned int b)
 {
-    if (n < nBits)
+    size_t n = 0;
+
+    for (; (n + bs + 17) <= size; n += 16)
     {
-        const Tu tmp = static_cast<Tu>(value);
-        value = static_cast<Ts>(tmp >> n);
+        uint8_t* const p = data + size - n - 16;
+        const __m128i v0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p - bs));
+        const __m128i v1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p - bs - 1));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p), shl8_sse2(v1, v0, 8 - b));
     }
-    else value = 0;
+
+    return n;
 }
 
-template <typename Ts, typename Tu, unsigned int nBits> void shiftRightAssign_neg(Ts& value, unsigned int n)
+OMWi_TARGET("avx2") __m256i shl8_avx2(const __m256i& v0, const __m256i& v1, unsigned int b)
 {
-    if (n < nBits)
+    const __m256i ml = _mm256_set1_epi8(static_cast<char>((0xFF << b) & 0xFF));
+    const __m256i mr = _mm256_set1_epi8(static_cast<char>(0xFF >> (8 - b)));
+    const __m256i l = _mm256_and_si256(_mm256_sll_epi16(v0, _mm_cvtsi32_si128(static_cast<int>(b))), ml);
+    const __m256i r = _mm256_and_si256(_mm256_srl_epi16(v1, _mm_cvtsi32_si128(static_cast<int>(8 - b))), mr);
+    return _mm256_or_si256(l, r);
+}
+
+OMWi_TARGET("avx2") size_t shiftLeftKernel_avx2(uint8_t* data, size_t size, size_t bs, unsigned int b)
+{
+    size_t i = 0;
+
+    for (; (i + bs + 33) <= size; i += 32)
     {
-        if (n)
-        {
-            constexpr Tu mask = static_cast<Tu>(-1);
-            Tu tmp = static_cast<Tu>(value);
-            tmp = tmp >> n;
-            tmp |= (mask << (nBits - n));
-            value = static_cast<Ts>(tmp);
-        }
+        const __m256i v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + bs));
+        const __m256i v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + bs + 1));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(data + i), shl8_avx2(v0, v1, b));
     }
-    else value = -1;
+
+    _mm256_zeroupper();
+
+    return i;
 }
 
-template <typename Ts, typename Tu, unsigned int nBits> void shiftRightAssign(Ts& value, unsigned int n)
+OMWi_TARGET("avx2") size_t shiftRightKernel_avx2(uint8_t* data, size_t size, size_t bs, unsigned int b)
 {
-    Tu msb = 0x01;
-    msb = msb << (nBits - 1);
-    if (static_cast<Tu>(value) & msb) shiftRightAssign_neg<Ts, Tu, nBits>(value, n);
-    else shiftRightAssign_pos<Ts, Tu, nBits>(value, n);
-}
+    size_t n = 0;
 
-} // namespace
+    for (; (n + bs + 33) <= size; n += 32)
+    {
+        uint8_t* const p = data + size - n - 32;
+        const __m256i v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p - bs));
+        const __m256i v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p - bs - 1));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), shl8_avx2(v1, v0, 8 - b));
+    }
 
+    _mm256_zeroupper();
 
-void omw::shiftLeftAssign(int8_t& value, unsigned int n) { ::shiftLeftAssign<int8_t, uint8_t, 8>(value, n); }
+    return n;
+}
 
-void omw::shiftLeftAssign(int16_t& value, unsigned int n) { ::shiftLeftAssign<int16_t, uint16_t, 16>(value, n); }
+#else // OMWi_X86_DISPATCH
 
-void omw::shiftLeftAssign(int32_t& value, unsigned int n) { ::shiftLeftAssign<int32_t, uint32_t, 32>(value, n); }
+size_t shiftKernel_none(uint8_t*, size_t, size_t, unsigned int) { return 0; }
 
-void omw::shiftLeftAssign(int64_t& value, unsigned int n) { ::shiftLeftAssign<int64_t, uint64_t, 64>(value, n); }
+#endif // OMWi_X86_DISPATCH
 
-void omw::shiftLeftAssign(uint8_t& value, unsigned int n)
+shift_kernel_t shiftLeftKernel()
 {
-    if (n < 8) value = value << n;
-    else value = 0;
+#ifdef OMWi_X86_DISPATCH
+    static const shift_kernel_t kernel = (omw::internal::cpu::hasAvx2() ? shiftLeftKernel_avx2 : shiftLeftKernel_sse2);
+#else
+    static const shift_kernel_t kernel = shiftKernel_none;
+#endif
+
+    return kernel;
 }
 
-void omw::shiftLeftAssign(uint16_t& value, unsigned int n)
+shift_kernel_t shiftRightKernel()
 {
-    if (n < 16) value = value << n;
-    else value = 0;
+#ifdef OMWi_X86_DISPATCH
+    static const shift_kernel_t kernel = (omw::internal::cpu::hasAvx2() ? shiftRightKernel_avx2 : shiftRightKernel_sse2);
+#else
+    static const shift_kernel_t kernel = shiftKernel_none;
+#endif
+
+    return kernel;
 }
 
-void omw::shiftLeftAssign(uint32_t& value, unsigned int n)
+// shifts the bits towards `data[0]`
+void shiftBytesLeft(uint8_t* data, size_t size, size_t bs, unsigned int b)
 {
-    if (n < 32) value = value << n;
-    else value = 0;
+    if (bs >= size)
+    {
+        std::memset(data, 0, size);
+        return;
+    }
+
+    if (b == 0) std::memmove(data, data + bs, size - bs);
+    else
+    {
+        size_t i = ::shiftLeftKernel()(data, size, bs, b);
+
+        for (; (i + bs + 1) < size; ++i) data[i] = static_cast<uint8_t>((data[i + bs] << b) | (data[i + bs + 1] >> (8 - b)));
+        data[i] = static_cast<uint8_t>(data[i + bs] << b);
+    }
+
+    std::memset(data + size - bs, 0, bs);
 }
 
-void omw::shiftLeftAssign(uint64_t& value, unsigned int n)
+// shifts the bits away from `data[0]`
+void shiftBytesRight(uint8_t* data, size_t size, size_t bs, unsigned int b)
 {
-    if (n < 64) value = value << n;
-    else value = 0;
+    if (bs >= size)
+    {
+        std::memset(data, 0, size);
+        return;
+    }
+
+    if (b == 0) std::memmove(data + bs, data, size - bs);
+    else
+    {
+        size_t i = size - ::shiftRightKernel()(data, size, bs, b);
+
+        for (; i > (bs + 1); --i) data[i - 1] = static_cast<uint8_t>((data[i - 1 - bs] >> b) | (data[i - 2 - bs] << (8 - b)));
+        data[bs] = static_cast<uint8_t>(data[0] >> b);
+    }
+
+    std::memset(data, 0, bs);
 }
 
-void omw::shiftRightAssign(int8_t& value, unsigned int n) { ::shiftRightAssign<int8_t, uint8_t, 8>(value, n); }
+} // namespace
 
-void omw::shiftRightAssign(int16_t& value, unsigned int n) { ::shiftRightAssign<int16_t, uint16_t, 16>(value, n); }
 
-void omw::shiftRightAssign(int32_t& value, unsigned int n) { ::shiftRightAssign<int32_t, uint32_t, 32>(value, n); }
 
-void omw::shiftRightAssign(int64_t& value, unsigned int n) { ::shiftRightAssign<int64_t, uint64_t, 64>(value, n); }
+/*!
+ * \fn T omw::shiftLeft(T value, unsigned int n)
+ *
+ * Branch free and `constexpr`, see \ref grp_utility_langSupport_section_bitShiftOp in \ref grp_utility_langSupport.
+ */
+
+/*!
+ * \fn T omw::shiftRight(T value, unsigned int n)
+ *
+ * Branch free and `constexpr`, see \ref grp_utility_langSupport_section_bitShiftOp in \ref grp_utility_langSupport.
+ */
 
-void omw::shiftRightAssign(uint8_t& value, unsigned int n)
+//! @param data Pointer to the buffer
+//! @param size Size of the buffer in bytes
+//! @param n Number of bits to shift
+//!
+//! Shifts the whole buffer as one bit stream, bit 7 of `data[0]` is the most significant bit (like a big endian encoded
+//! integer). The bits are moved towards `data[0]`, vacated bits are set to 0. Uses AVX2 or SSE2 on x86-64.
+//!
+//! \b Exceptions
+//! - `std::invalid_argument` if `data` is `NULL` and `size` is not zero
+//!
+void omw::shiftLeft(uint8_t* data, size_t size, size_t n)
 {
-    if (n < 8) value = value >> n;
-    else value = 0;
+    if (!data && (size > 0)) throw std::invalid_argument("omw::shiftLeft");
+    if (size == 0) return;
+
+    ::shiftBytesLeft(data, size, n / 8, static_cast<unsigned int>(n % 8));
 }
 
-void omw::shiftRightAssign(uint16_t& value, unsigned int n)
+//! @param data Pointer to the buffer
+//! @param size Size of the buffer in bytes
+//! @param n Number of bits to shift
+//!
+//! Logical right shift of the whole buffer, see `omw::shiftLeft(uint8_t*, size_t, size_t)`.
+//!
+//! \b Exceptions
+//! - `std::invalid_argument` if `data` is `NULL` and `size` is not zero
+//!
+void omw::shiftRight(uint8_t* data, size_t size, size_t n)
 {
-    if (n < 16) value = value >> n;
-    else value = 0;
+    if (!data && (size > 0)) throw std::invalid_argument("omw::shiftRight");
+    if (size == 0) return;
+
+    ::shiftBytesRight(data, size, n / 8, static_cast<unsigned int>(n % 8));
 }
 
-void omw::shiftRightAssign(uint32_t& value, unsigned int n)
+//! @param data Pointer to the buffer
+//! @param size Size of the buffer in bytes
+//! @param n Number of bits to rotate
+//!
+//! Rotates the whole buffer as one bit stream, see `omw::shiftLeft(uint8_t*, size_t, size_t)`.
+//!
+//! \b Exceptions
+//! - `std::invalid_argument` if `data` is `NULL` and `size` is not zero
+//!
+void omw::rotateLeft(uint8_t* data, size_t size, size_t n)
 {
-    if (n < 32) value = value >> n;
-    else value = 0;
+    if (!data && (size > 0)) throw std::invalid_argument("omw::rotateLeft");
+    if (size == 0) return;
+
+    const size_t bs = (n / 8) % size;
+    const unsigned int b = static_cast<unsigned int>(n % 8);
+
+    std::rotate(data, data + bs, data + size);
+
+    if (b != 0)
+    {
+        const uint8_t carry = static_cast<uint8_t>(data[0] >> (8 - b));
+        ::shiftBytesLeft(data, size, 0, b);
+        data[size - 1] |= carry;
+    }
 }
 
-void omw::shiftRightAssign(uint64_t& value, unsigned int n)
+//! @param data Pointer to the buffer
+//! @param size Size of the buffer in bytes
+//! @param n Number of bits to rotate
+//!
+//! Rotates the whole buffer as one bit stream, see `omw::shiftLeft(uint8_t*, size_t, size_t)`.
+//!
+//! \b Exceptions
+//! - `std::invalid_argument` if `data` is `NULL` and `size` is not zero
+//!
+void omw::rotateRight(uint8_t* data, size_t size, size_t n)
 {
-    if (n < 64) value = value >> n;
-    else value = 0;
-}
+    if (!data && (size > 0)) throw std::invalid_argument("omw::rotateRight");
+    if (size == 0) return;
+
+    const size_t bs = (n / 8) % size;
+    const unsigned int b = static_cast<unsigned int>(n % 8);
+
+    std::rotate(data, data + size - bs, data + size);
 
-int8_t omw::shiftLeft(int8_t value, unsigned int n) { OMWi_IMPLEMENT_SHIFTLEFT(int8_t); }
-int16_t omw::shiftLeft(int16_t value, unsigned int n) { OMWi_IMPLEMENT_SHIFTLEFT(int16_t); }
-int32_t omw::shiftLeft(int32_t value, unsigned int n) { OMWi_IMPLEMENT_SHIFTLEFT(int32_t); }
-int64_t omw::shiftLeft(int64_t value, unsigned int n) { OMWi_IMPLEMENT_SHIFTLEFT(int64_t); }
-uint8_t omw::shiftLeft(uint8_t value, unsigned int n) { OMWi_IMPLEMENT_SHIFTLEFT(uint8_t); }
-uint16_t omw::shiftLeft(uint16_t value, unsigned int n) { OMWi_IMPLEMENT_SHIFTLEFT(uint16_t); }
-uint32_t omw::shiftLeft(uint32_t value, unsigned int n) { OMWi_IMPLEMENT_SHIFTLEFT(uint32_t); }
-uint64_t omw::shiftLeft(uint64_t value, unsigned int n) { OMWi_IMPLEMENT_SHIFTLEFT(uint64_t); }
-int8_t omw::shiftRight(int8_t value, unsigned int n) { OMWi_IMPLEMENT_SHIFTRIGHT(int8_t); }
-int16_t omw::shiftRight(int16_t value, unsigned int n) { OMWi_IMPLEMENT_SHIFTRIGHT(int16_t); }
-int32_t omw::shiftRight(int32_t value, unsigned int n) { OMWi_IMPLEMENT_SHIFTRIGHT(int32_t); }
-int64_t omw::shiftRight(int64_t value, unsigned int n) { OMWi_IMPLEMENT_SHIFTRIGHT(int64_t); }
-uint8_t omw::shiftRight(uint8_t value, unsigned int n) { OMWi_IMPLEMENT_SHIFTRIGHT(uint8_t); }
-uint16_t omw::shiftRight(uint16_t value, unsigned int n) { OMWi_IMPLEMENT_SHIFTRIGHT(uint16_t); }
-uint32_t omw::shiftRight(uint32_t value, unsigned int n) { OMWi_IMPLEMENT_SHIFTRIGHT(uint32_t); }
-uint64_t omw::shiftRight(uint64_t value, unsigned int n) { OMWi_IMPLEMENT_SHIFTRIGHT(uint64_t); }
+    if (b != 0)
+    {
+        const uint8_t carry = static_cast<uint8_t>(data[size - 1] << (8 - b));
+        ::shiftBytesRight(data, size, 0, b);
+        data[0] |= carry;
+    }
+}
 
 
 
@@ -10,6 +10,7 @@ copyright       MIT - Copyright (c) 2023 Oliver Blaser
 #include <vector>
 
 #include "catch2/catch.hpp"
+#include "testUtil.h"
 
 #include <omw/algorithm.h>
 #include <omw/cli.h>
@@ -202,3 +203,87 @@ TEST_CASE("algorithm.h levenshteinDistance() vector")
         CHECK(omw::levenshteinDistance(x.a(), x.b()) == x.r());
     }
 }
+
+TEST_CASE("algorithm.h levenshteinDistance() long strings")
+{
+    // reference, full matrix
+    const auto refDistance = [](const std::string& a, const std::string& b) {
+        std::vector<std::vector<size_t>> m(a.size() + 1, std::vector<size_t>(b.size() + 1, 0));
+        for (size_t j = 0; j <= b.size(); ++j) m[0][j] = j;
+        for (size_t i = 1; i <= a.size(); ++i)
+        {
+            m[i][0] = i;
+            for (size_t j = 1; j <= b.size(); ++j)
+            {
+                m[i][j] = std::min(std::min(m[i - 1][j - 1] + (a[i - 1] == b[j - 1] ? 0 : 1), m[i][j - 1] + 1), m[i - 1][j] + 1);
+            }
+        }
+        return m[a.size()][b.size()];
+    };
+
+    tu::Rng64 rng;
+
+    // lengths around the block boundaries, small alphabet for many matches
+    const size_t lengths[] = { 0, 1, 2, 5, 31, 63, 64, 65, 100, 127, 128, 129, 200 };
+
+    for (size_t la : lengths)
+    {
+        for (size_t lb : lengths)
+        {
+            std::string a, b;
+            for (size_t i = 0; i < la; ++i) a += static_cast<char>('a' + (rng() % 4));
+            for (size_t i = 0; i < lb; ++i) b += ((i < la) && ((rng() % 4) != 0)) ? a[i] : static_cast<char>('a' + (rng() % 5));
+            if (la > 0) a[la / 2] = static_cast<char>(0xFF);
+
+            const size_t r = refDistance(a, b);
+            REQUIRE(omw::levenshteinDistance(a, b) == r);
+            REQUIRE(omw::levenshteinDistance(b, a) == r);
+
+            const std::vector<char> va(a.begin(), a.end());
+            const std::vector<char> vb(b.begin(), b.end());
+            REQUIRE(omw::levenshteinDistance(va, vb) == r);
+        }
+    }
+
+    CHECK(omw::levenshteinDistance(std::string(1000, 'a'), std::string(1000, 'b')) == 1000);
+    CHECK(omw::levenshteinDistance(std::string(1000, 'a'), std::string(10, 'a')) == 990);
+    CHECK(omw::levenshteinDistance(std::string(500, 'a') + "x" + std::string(500, 'b'), std::string(500, 'a') + std::string(500, 'b')) == 1);
+}
+
+#ifdef CATCH_CONFIG_ENABLE_BENCHMARKING
+TEST_CASE("algorithm.h levenshteinDistance() benchmark", "[.][benchmark]")
+{
+    std::vector<std::string> identifiers;
+    tu::Rng64 rng(12345);
+    for (size_t i = 0; i < 10000; ++i)
+    {
+        std::string id;
+        const size_t len = 8 + (rng() % 24);
+        for (size_t k = 0; k < len; ++k) id += static_cast<char>('a' + (rng() % 26));
+        identifiers.push_back(id);
+    }
+
+    const std::string key = "levenshteinDistance";
+    const std::vector<char> vkey(key.begin(), key.end());
+
+    BENCHMARK("identifiers 10k")
+    {
+        size_t r = 0;
+        for (const auto& id : identifiers) r += omw::levenshteinDistance(key, id);
+        return r;
+    };
+
+    BENCHMARK("identifiers 10k, generic")
+    {
+        size_t r = 0;
+        for (const auto& id : identifiers) r += omw::levenshteinDistance<char>(vkey.data(), vkey.size(), id.data(), id.size());
+        return r;
+    };
+
+    const std::string a(2000, 'a');
+    std::string b = a;
+    for (size_t i = 0; i < b.size(); i += 7) b[i] = 'b';
+
+    BENCHMARK("2000 x 2000") { return omw::levenshteinDistance(a, b); };
+}
+#endif // CATCH_CONFIG_ENABLE_BENCHMARKING
@@ -6,12 +6,62 @@ copyright       MIT - Copyright (c) 2022 Oliver Blaser
 
 #include <cstddef>
 #include <cstdint>
+#include <cstdio>
+#include <ios>
 #include <vector>
 
 #include "catch2/catch.hpp"
 #include "testUtil.h"
 
 #include <omw/checksum.h>
+#include <omw/checksumParallel.h>
+#include <omw/io/file.h>
+
+
+namespace {
+
+// bit by bit reference implementation
+template <class UI> UI crc_bitwise(const omw::CrcParameter<UI>& param, const uint8_t* data, size_t count)
+{
+    constexpr unsigned width = 8 * sizeof(UI);
+    constexpr UI msb = static_cast<UI>(static_cast<UI>(1) << (width - 1));
+
+    const auto reflect = [](UI value, unsigned n) {
+        UI r = 0;
+        for (unsigned i = 0; i < n; ++i)
+        {
+            r = static_cast<UI>(r << 1);
+            if (value & 0x01) r |= 0x01;
+            value = static_cast<UI>(value >> 1);
+        }
+        return r;
+    };
+
+    UI crc = param.init();
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        const uint8_t byte = (param.refIn() ? static_cast<uint8_t>(reflect(data[i], 8)) : data[i]);
+        crc ^= static_cast<UI>(static_cast<UI>(byte) << (width - 8));
+        for (int bit = 0; bit < 8; ++bit) crc = static_cast<UI>((crc & msb) ? ((crc << 1) ^ param.poly()) : (crc << 1));
+    }
+
+    if (param.refOut()) crc = reflect(crc, width);
+
+    return static_cast<UI>(crc ^ param.xorOut());
+}
+
+std::vector<uint8_t> pseudoRandomData(size_t count)
+{
+    std::vector<uint8_t> data(count);
+    tu::Rng64 rng(0x12345678);
+
+    for (size_t i = 0; i < count; ++i) data[i] = static_cast<uint8_t>(rng() >> 56);
+
+    return data;
+}
+
+} // namespace
 
 
 
@@ -53,6 +103,55 @@ TEST_CASE("checksum.h parityWord(vector)")
     TESTUTIL_TRYCATCH_CHECK(omw::parityWord(vec, vec.size() + 1, 0), std::invalid_argument);
 }
 
+TEST_CASE("checksum.h parityWord16(), parityWord32()")
+{
+    const uint8_t data[] = { 0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC, 0xDE };
+
+    CHECK(omw::parityWord16(nullptr, 3) == 0);
+    CHECK(omw::parityWord16(data, 0) == 0);
+    CHECK(omw::parityWord16(data, 2) == 0x1234);
+    CHECK(omw::parityWord16(data, 4) == 0x444C);
+    CHECK(omw::parityWord16(data, 5) == 0xDE4C);
+    CHECK(omw::parityWord32(nullptr, 3) == 0);
+    CHECK(omw::parityWord32(data, 0) == 0);
+    CHECK(omw::parityWord32(data, 4) == 0x12345678);
+    CHECK(omw::parityWord32(data, 7) == 0x88888878);
+
+    const std::vector<uint8_t> vec(data, data + sizeof(data));
+    CHECK(omw::parityWord16(vec, 1, 4) == 0x4CCC);
+    CHECK(omw::parityWord32(vec, 3, 4) == 0x789ABCDE);
+    CHECK_THROWS_AS(omw::parityWord16(vec, vec.size() - 1, 2), std::invalid_argument);
+    CHECK_THROWS_AS(omw::parityWord32(vec, vec.size() + 1, 0), std::invalid_argument);
+
+    // the wide kernels against byte wise references
+    const std::vector<uint8_t> v = ::pseudoRandomData(1100);
+    for (size_t pos = 0; pos < 8; ++pos)
+    {
+        for (size_t count = 0; count <= 300; ++count)
+        {
+            const uint8_t* const p = v.data() + pos;
+            uint8_t r8 = 0;
+            uint16_t r16 = 0;
+            uint32_t r32 = 0;
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                r8 ^= p[i];
+                r16 ^= static_cast<uint16_t>(p[i] << (8 * (1 - (i % 2))));
+                r32 ^= (static_cast<uint32_t>(p[i]) << (8 * (3 - (i % 4))));
+            }
+
+            CHECK(omw::parityWord(p, count) == r8);
+            CHECK(omw::parityWord16(p, count) == r16);
+            CHECK(omw::parityWord32(p, count) == r32);
+        }
+    }
+
+    uint8_t r8 = 0;
+    for (const auto& e : v) r8 ^= e;
+    CHECK(omw::parityWord(v, 0, v.size()) == r8);
+}
+
 
 
 TEST_CASE("checksum.h omw::preview::crc16_kermit()")
@@ -78,3 +177,552 @@ TEST_CASE("checksum.h omw::preview::crc16_kermit()")
           0x42, 0x5D, 0x0C, 0x66, 0xA8, 0x53, 0xE5, 0xFF, 0xF1, 0x89, 0x1A, 0x3A, 0xF4, 0x96, 0x33, 0x39 };
     CHECK(omw::preview::crc16_kermit(v.data(), v.size()) == 0xA75E);
 }
+
+
+
+TEST_CASE("checksum.h omw::crc16")
+{
+    const uint8_t* data = reinterpret_cast<const uint8_t*>("123456789");
+
+    CHECK(omw::crc16::kermit(nullptr, 0) == 0x0000);
+    CHECK(omw::crc16::kermit(data, 0) == 0x0000);
+    CHECK(omw::crc16::kermit(data, 9) == 0x2189);
+
+    CHECK(omw::crc16::modbus(nullptr, 0) == 0xFFFF);
+    CHECK(omw::crc16::modbus(data, 0) == 0xFFFF);
+    CHECK(omw::crc16::modbus(data, 9) == 0x4B37);
+
+    data = reinterpret_cast<const uint8_t*>("d1klmQLr8dYjDKfq7qawiMGmT07MViBUFCEUkMCG");
+    CHECK(omw::crc16::kermit(data, 40) == 0x5454);
+
+    // all lengths around the slicing block size, and misaligned starts
+    const std::vector<uint8_t> v = ::pseudoRandomData(100);
+    for (size_t pos = 0; pos < 8; ++pos)
+    {
+        for (size_t count = 0; count <= (v.size() - pos); ++count)
+        {
+            CHECK(omw::crc16::kermit(v.data() + pos, count) == omw::preview::crc16_kermit(v.data() + pos, count));
+            CHECK(omw::crc16::kermit(v.data() + pos, count) == ::crc_bitwise(omw::crc16::kermitParam, v.data() + pos, count));
+            CHECK(omw::crc16::modbus(v.data() + pos, count) == ::crc_bitwise(omw::crc16::modbusParam, v.data() + pos, count));
+        }
+    }
+}
+
+TEST_CASE("checksum.h omw::crc16 (vector)")
+{
+    const std::vector<uint8_t> vec = { '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '0' };
+
+    CHECK(omw::crc16::kermit(vec, 0, 0) == 0x0000);
+    CHECK(omw::crc16::kermit(vec, vec.size(), 0) == 0x0000);
+    CHECK(omw::crc16::kermit(vec, 1, 9) == 0x2189);
+    CHECK(omw::crc16::modbus(vec, 1, 9) == 0x4B37);
+
+    TESTUTIL_TRYCATCH_DECLARE_VAL(uint16_t, 0x1234);
+    TESTUTIL_TRYCATCH_CHECK(omw::crc16::kermit(vec, vec.size() - 1, 2), std::invalid_argument);
+    TESTUTIL_TRYCATCH_CHECK(omw::crc16::kermit(vec, vec.size() + 1, 0), std::invalid_argument);
+    TESTUTIL_TRYCATCH_CHECK(omw::crc16::modbus(vec, vec.size(), 1), std::invalid_argument);
+}
+
+
+
+TEST_CASE("checksum.h omw::crc8, omw::crc32, omw::crc64")
+{
+    const uint8_t* data = reinterpret_cast<const uint8_t*>("123456789");
+
+    CHECK(omw::crc8::smbus(nullptr, 0) == 0x00);
+    CHECK(omw::crc8::smbus(data, 9) == 0xF4);
+
+    CHECK(omw::crc32::ieee(nullptr, 0) == 0x00000000);
+    CHECK(omw::crc32::ieee(data, 9) == 0xCBF43926);
+    CHECK(omw::crc32::castagnoli(nullptr, 0) == 0x00000000);
+    CHECK(omw::crc32::castagnoli(data, 9) == 0xE3069283);
+
+    CHECK(omw::crc64::ecma(nullptr, 0) == 0x0000000000000000);
+    CHECK(omw::crc64::ecma(data, 9) == 0x6C40DF5F0B497347);
+    CHECK(omw::crc64::xz(nullptr, 0) == 0x0000000000000000);
+    CHECK(omw::crc64::xz(data, 9) == 0x995DC9BBDF1939FA);
+
+    const std::vector<uint8_t> v = ::pseudoRandomData(100);
+    for (size_t pos = 0; pos < 8; ++pos)
+    {
+        for (size_t count = 0; count <= (v.size() - pos); ++count)
+        {
+            const uint8_t* const p = v.data() + pos;
+            CHECK(omw::crc8::smbus(p, count) == ::crc_bitwise(omw::crc8::smbusParam, p, count));
+            CHECK(omw::crc32::ieee(p, count) == ::crc_bitwise(omw::crc32::ieeeParam, p, count));
+            CHECK(omw::crc32::castagnoli(p, count) == ::crc_bitwise(omw::crc32::castagnoliParam, p, count));
+            CHECK(omw::crc64::ecma(p, count) == ::crc_bitwise(omw::crc64::ecmaParam, p, count));
+            CHECK(omw::crc64::xz(p, count) == ::crc_bitwise(omw::crc64::xzParam, p, count));
+        }
+    }
+
+    const std::vector<uint8_t> vec(data, data + 9);
+    CHECK(omw::crc8::smbus(vec, 0, vec.size()) == 0xF4);
+    CHECK(omw::crc32::ieee(vec, 0, vec.size()) == 0xCBF43926);
+    CHECK(omw::crc32::castagnoli(vec, 0, vec.size()) == 0xE3069283);
+    CHECK(omw::crc64::ecma(vec, 0, vec.size()) == 0x6C40DF5F0B497347);
+    CHECK(omw::crc64::xz(vec, 0, vec.size()) == 0x995DC9BBDF1939FA);
+
+    TESTUTIL_TRYCATCH_DECLARE_VAL(uint64_t, 0x1234);
+    TESTUTIL_TRYCATCH_CHECK(omw::crc32::ieee(vec, vec.size() - 1, 2), std::invalid_argument);
+    TESTUTIL_TRYCATCH_CHECK(omw::crc64::xz(vec, vec.size() + 1, 0), std::invalid_argument);
+}
+
+#if (OMW_CPPSTD >= OMW_CPPSTD_14)
+
+namespace {
+
+// CRC-32/MPEG-2, non-reflected with init and xor out values
+struct Crc32Mpeg2
+{
+    static constexpr omw::CrcParameter<uint32_t> parameter() { return omw::CrcParameter<uint32_t>(0xFFFFFFFF, 0x04C11DB7, false, false, 0x00000000); }
+};
+
+// refIn differing from refOut, checked against the reference
+struct Crc16RefInOnly
+{
+    static constexpr omw::CrcParameter<uint16_t> parameter() { return omw::CrcParameter<uint16_t>(0x1234, 0x1021, true, false, 0xFFFF); }
+};
+struct Crc16RefOutOnly
+{
+    static constexpr omw::CrcParameter<uint16_t> parameter() { return omw::CrcParameter<uint16_t>(0x1234, 0x1021, false, true, 0xFFFF); }
+};
+
+} // namespace
+
+TEST_CASE("checksum.h omw::Crc")
+{
+    const uint8_t* data = reinterpret_cast<const uint8_t*>("123456789");
+
+    CHECK(omw::Crc<::Crc32Mpeg2>::calc(data, 9) == 0x0376E6E7);
+    CHECK(omw::Crc<::Crc32Mpeg2>::calcBytewise(data, 9) == 0x0376E6E7);
+    CHECK(omw::Crc<omw::crc16::Kermit>::table()[1] == 0x1189);
+    CHECK(omw::Crc<omw::crc16::Kermit>::table()[255] == 0x0F78);
+    CHECK(omw::Crc<omw::crc32::Ieee>::table()[1] == 0x77073096);
+
+    const std::vector<uint8_t> v = ::pseudoRandomData(100);
+    for (size_t count = 0; count <= v.size(); ++count)
+    {
+        CHECK(omw::Crc<::Crc16RefInOnly>::calc(v.data(), count) == ::crc_bitwise(::Crc16RefInOnly::parameter(), v.data(), count));
+        CHECK(omw::Crc<::Crc16RefOutOnly>::calc(v.data(), count) == ::crc_bitwise(::Crc16RefOutOnly::parameter(), v.data(), count));
+        CHECK(omw::Crc<::Crc32Mpeg2>::calc(v.data(), count) == ::crc_bitwise(::Crc32Mpeg2::parameter(), v.data(), count));
+        CHECK(omw::Crc<omw::crc64::Xz>::calcBytewise(v.data(), count) == ::crc_bitwise(omw::crc64::xzParam, v.data(), count));
+    }
+
+    // register level, in chunks
+    using crc_t = omw::Crc<omw::crc32::Ieee>;
+    for (size_t split = 0; split <= v.size(); ++split)
+    {
+        crc_t::value_type crc = crc_t::begin();
+        crc = crc_t::update(crc, v.data(), split);
+        crc = crc_t::update(crc, v.data() + split, v.size() - split);
+        CHECK(crc_t::finalize(crc) == omw::crc32::ieee(v.data(), v.size()));
+    }
+}
+
+
+
+TEST_CASE("checksum.h omw::Crc hardware accelerated CRC-32")
+{
+    // compares the (possibly) hardware accelerated update() to the table engine
+    using ieee_t = omw::Crc<omw::crc32::Ieee>;
+    using castagnoli_t = omw::Crc<omw::crc32::Castagnoli>;
+
+    const std::vector<uint8_t> v = ::pseudoRandomData(1100);
+    const size_t counts[] = { 0, 1, 7, 8, 15, 16, 17, 63, 64, 65, 79, 80, 127, 128, 129, 255, 256, 257, 1000, 1024, 1099 };
+
+    for (size_t pos = 0; pos < 3; ++pos)
+    {
+        for (const size_t count : counts)
+        {
+            if ((pos + count) > v.size()) continue;
+            const uint8_t* const p = v.data() + pos;
+
+            CHECK(ieee_t::update(ieee_t::begin(), p, count) == ieee_t::updateSlicing(ieee_t::begin(), p, count));
+            CHECK(ieee_t::update(0x12345678, p, count) == ieee_t::updateSlicing(0x12345678, p, count));
+            CHECK(castagnoli_t::update(castagnoli_t::begin(), p, count) == castagnoli_t::updateSlicing(castagnoli_t::begin(), p, count));
+            CHECK(castagnoli_t::update(0x12345678, p, count) == castagnoli_t::updateSlicing(0x12345678, p, count));
+        }
+    }
+}
+
+
+
+namespace {
+
+template <class P> void checkCrcState(const std::vector<uint8_t>& v)
+{
+    using state_t = omw::CrcState<P>;
+    using crc_t = omw::Crc<P>;
+
+    const size_t splits[] = { 0, 1, 3, 8, 17, 64, 100, 255, 256, 300 };
+
+    for (const size_t split : splits)
+    {
+        const size_t lengthB = v.size() - split;
+        const auto crcA = crc_t::calc(v.data(), split);
+        const auto crcB = crc_t::calc(v.data() + split, lengthB);
+        const auto expected = crc_t::calc(v.data(), v.size());
+
+        state_t a, b;
+        a.update(v.data(), split);
+        b.update(v, split, lengthB);
+        CHECK(a.finalize() == crcA);
+        CHECK(b.finalize() == crcB);
+        CHECK(a.length() == split);
+        CHECK(b.length() == lengthB);
+
+        CHECK(state_t::combine(crcA, crcB, lengthB) == expected);
+
+        a.append(b);
+        CHECK(a.finalize() == expected);
+        CHECK(a.length() == v.size());
+
+        state_t c;
+        c.update(v.data(), split);
+        (void)c.finalize();
+        c.update(v.data() + split, lengthB);
+        CHECK(c.finalize() == expected);
+
+        c.reset();
+        CHECK(c.finalize() == crc_t::calc(nullptr, 0));
+        CHECK(c.length() == 0);
+    }
+}
+
+} // namespace
+
+TEST_CASE("checksum.h omw::CrcState")
+{
+    const std::vector<uint8_t> v = ::pseudoRandomData(300);
+
+    checkCrcState<omw::crc8::Smbus>(v);
+    checkCrcState<omw::crc16::Kermit>(v);
+    checkCrcState<omw::crc16::Modbus>(v);
+    checkCrcState<omw::crc32::Ieee>(v);
+    checkCrcState<omw::crc32::Castagnoli>(v);
+    checkCrcState<omw::crc64::Ecma>(v);
+    checkCrcState<omw::crc64::Xz>(v);
+    checkCrcState<Crc32Mpeg2>(v);
+    checkCrcState<Crc16RefInOnly>(v);
+    checkCrcState<Crc16RefOutOnly>(v);
+
+    // zlib's crc32_combine() reference
+    const uint32_t crcA = omw::crc32::ieee(reinterpret_cast<const uint8_t*>("12345"), 5);
+    const uint32_t crcB = omw::crc32::ieee(reinterpret_cast<const uint8_t*>("6789"), 4);
+    CHECK(omw::CrcState<omw::crc32::Ieee>::combine(crcA, crcB, 4) == 0xCBF43926);
+
+    omw::CrcState<omw::crc16::Kermit> state;
+    CHECK_THROWS_AS(state.update(v, 301, 0), std::invalid_argument);
+    CHECK_THROWS_AS(state.update(v, 0, 301), std::invalid_argument);
+    CHECK_THROWS_AS(state.update(v, 100, 201), std::invalid_argument);
+    CHECK(state.length() == 0);
+}
+
+
+
+TEST_CASE("checksum.h omw::crcParallel()")
+{
+    const std::vector<uint8_t> v = ::pseudoRandomData(5 * 1024 * 1024 + 13);
+
+    const uint32_t ieee = omw::crc32::ieee(v.data(), v.size());
+    const uint64_t xz = omw::crc64::xz(v.data(), v.size());
+    const uint16_t kermit = omw::crc16::kermit(v.data(), v.size());
+
+    for (unsigned threads = 0; threads <= 5; ++threads)
+    {
+        CHECK(omw::crcParallel<omw::crc32::Ieee>(v.data(), v.size(), threads) == ieee);
+        CHECK(omw::crcParallel<omw::crc64::Xz>(v.data(), v.size(), threads) == xz);
+        CHECK(omw::crcParallel<omw::crc16::Kermit>(v.data(), v.size(), threads) == kermit);
+    }
+
+    CHECK(omw::crcParallel<omw::crc32::Ieee>(v.data(), 100, 4) == omw::crc32::ieee(v.data(), 100));
+    CHECK(omw::crcParallel<omw::crc32::Ieee>(nullptr, 0) == omw::crc32::ieee(nullptr, 0));
+
+    const char* const filename = "checksum.omwunittestfile-bin";
+    omw::io::BinFileInterface file(filename);
+    file.openWrite();
+    file.write(v.data(), v.size());
+    file.close();
+
+    for (unsigned threads = 0; threads <= 5; ++threads)
+    {
+        CHECK(omw::crcParallel<omw::crc32::Ieee>(file, threads) == ieee);
+        CHECK(omw::crcParallel<Crc16RefOutOnly>(file, threads) == omw::Crc<Crc16RefOutOnly>::calc(v.data(), v.size()));
+    }
+
+    std::remove(filename);
+
+    CHECK_THROWS_AS(omw::crcParallel<omw::crc32::Ieee>(file), std::ios::failure);
+}
+
+#endif // C++14
+
+
+
+namespace {
+
+// feeds the data in chunks of `chunk` bytes to the state
+template <class State> decltype(State().finalize()) hashChunked(State state, const std::vector<uint8_t>& data, size_t count, size_t chunk)
+{
+    size_t i = 0;
+
+    while (i < count)
+    {
+        const size_t n = ((count - i) < chunk ? (count - i) : chunk);
+        state.update(data.data() + i, n);
+        i += n;
+    }
+
+    return state.finalize();
+}
+
+} // namespace
+
+TEST_CASE("checksum.h omw::adler32(), omw::fletcher16(), omw::fletcher32()")
+{
+    const uint8_t* data = reinterpret_cast<const uint8_t*>("Wikipedia");
+    CHECK(omw::adler32(data, 9) == 0x11E60398);
+    CHECK(omw::adler32(nullptr, 0) == 1);
+
+    data = reinterpret_cast<const uint8_t*>("abcdefgh");
+    CHECK(omw::fletcher16(data, 5) == 0xC8F0);
+    CHECK(omw::fletcher16(data, 6) == 0x2057);
+    CHECK(omw::fletcher16(data, 8) == 0x0627);
+    CHECK(omw::fletcher32(data, 5) == 0xF04FC729);
+    CHECK(omw::fletcher32(data, 6) == 0x56502D2A);
+    CHECK(omw::fletcher32(data, 8) == 0xEBE19591);
+    CHECK(omw::fletcher16(nullptr, 0) == 0);
+    CHECK(omw::fletcher32(nullptr, 0) == 0);
+
+    // deferred modulo against per byte reduction, all 0xFF is the worst case for overflows
+    std::vector<uint8_t> v = ::pseudoRandomData(100000);
+    for (int k = 0; k < 2; ++k)
+    {
+        uint32_t a = 1, b = 0, f1 = 0, f2 = 0, g1 = 0, g2 = 0;
+        for (size_t i = 0; i < v.size(); ++i)
+        {
+            a = (a + v[i]) % 65521;
+            b = (b + a) % 65521;
+            f1 = (f1 + v[i]) % 255;
+            f2 = (f2 + f1) % 255;
+
+            if (i % 2)
+            {
+                g1 = (g1 + (static_cast<uint32_t>(v[i]) << 8) + v[i - 1]) % 65535;
+                g2 = (g2 + g1) % 65535;
+            }
+        }
+
+        CHECK(omw::adler32(v, 0, v.size()) == ((b << 16) | a));
+        CHECK(omw::fletcher16(v, 0, v.size()) == ((f2 << 8) | f1));
+        CHECK(omw::fletcher32(v, 0, v.size()) == ((g2 << 16) | g1));
+
+        for (const size_t chunk : { 1, 3, 1000, 7777 })
+        {
+            CHECK(::hashChunked(omw::Adler32State(), v, v.size(), chunk) == ((b << 16) | a));
+            CHECK(::hashChunked(omw::Fletcher16State(), v, v.size(), chunk) == ((f2 << 8) | f1));
+            CHECK(::hashChunked(omw::Fletcher32State(), v, v.size(), chunk) == ((g2 << 16) | g1));
+            CHECK(::hashChunked(omw::Fletcher32State(), v, v.size() - 1, chunk) == omw::fletcher32(v.data(), v.size() - 1));
+        }
+
+        v.assign(v.size(), 0xFF);
+    }
+
+    CHECK_THROWS_AS(omw::adler32(v, v.size() + 1, 0), std::invalid_argument);
+    CHECK_THROWS_AS(omw::fletcher16(v, 1, v.size()), std::invalid_argument);
+    CHECK_THROWS_AS(omw::fletcher32(v, 0, v.size() + 1), std::invalid_argument);
+    omw::Adler32State state;
+    CHECK_THROWS_AS(state.update(v, 10, v.size()), std::invalid_argument);
+}
+
+TEST_CASE("checksum.h omw::fnv1a32(), omw::fnv1a64()")
+{
+    const uint8_t* data = reinterpret_cast<const uint8_t*>("foobar");
+    CHECK(omw::fnv1a32(data, 0) == 0x811C9DC5);
+    CHECK(omw::fnv1a32(data, 6) == 0xBF9CF968);
+    CHECK(omw::fnv1a64(data, 0) == 0xCBF29CE484222325);
+    CHECK(omw::fnv1a64(data, 6) == 0x85944171F73967E8);
+
+    const std::vector<uint8_t> v(data, data + 6);
+    CHECK(omw::fnv1a32(v, 0, 1) == 0xE30C2799);
+    CHECK(omw::fnv1a64(v, 0, 1) == 0xAF63DB4C8601EAD9);
+    CHECK_THROWS_AS(omw::fnv1a32(v, 7, 0), std::invalid_argument);
+    CHECK_THROWS_AS(omw::fnv1a64(v, 1, 6), std::invalid_argument);
+
+    omw::Fnv1a32State s32;
+    omw::Fnv1a64State s64;
+    s32.update(data, 3);
+    s64.update(data, 3);
+    s32.update(v, 3, 3);
+    s64.update(v, 3, 3);
+    CHECK(s32.finalize() == 0xBF9CF968);
+    CHECK(s64.finalize() == 0x85944171F73967E8);
+    s32.reset();
+    s64.reset();
+    CHECK(s32.finalize() == 0x811C9DC5);
+    CHECK(s64.finalize() == 0xCBF29CE484222325);
+
+#if (OMW_CPPSTD >= OMW_CPPSTD_14)
+    // compile time
+    static_assert(omw::fnv1a32("foobar") == 0xBF9CF968, "");
+    static_assert(omw::fnv1a32("foobar", 6) == 0xBF9CF968, "");
+    static_assert(omw::fnv1a64("foobar") == 0x85944171F73967E8, "");
+    static_assert(omw::fnv1a64("foobar", 3) == omw::fnv1a64("foo"), "");
+    CHECK(omw::fnv1a32("") == 0x811C9DC5);
+#endif
+}
+
+TEST_CASE("checksum.h omw::xxh64(), omw::xxh3()")
+{
+    struct Entry
+    {
+        size_t count;
+        uint64_t xxh64;
+        uint64_t xxh64Seed;
+        uint64_t xxh3;
+        uint64_t xxh3Seed;
+    };
+
+    constexpr uint64_t seed = 0x9E3779B97F4A7C15;
+
+    // generated with the reference implementation (xxHash v0.8)
+    const Entry table[] = {
+        {    0, 0xEF46DB3751D8E999ull, 0xC4349FC93C010000ull, 0x2D06800538D394C2ull, 0x602B0E2CD6662C8Bull },
+        {    1, 0xE2F18BFDC508F4F2ull, 0x58DB905E317EBD21ull, 0x58B8B7D107FFB8CDull, 0xE90914C940C90184ull },
+        {    2, 0x50DAEBF69CD7A528ull, 0x29E8664BDD16FD90ull, 0xC7CAD902179B326Dull, 0xB8118B3EAE549AC3ull },
+        {    3, 0x18C7301CD54FA6E1ull, 0x18BBD5D23435F40Aull, 0xB76E12ADC98FAC6Cull, 0xBEF03A0555E3D798ull },
+        {    4, 0x614F97DB3DDAF591ull, 0x49E419C45C168D04ull, 0xC93E64310B2F4127ull, 0x66479A447D5A0A28ull },
+        {    5, 0xE242D268BBCEC02Eull, 0xD7069B7FC40FE6B2ull, 0xEB4CEC55CF697C61ull, 0xE7D0F0BAB60AB21Dull },
+        {    8, 0x4744084006AA7578ull, 0x92C26477727E3C19ull, 0xF225A2F4D37A5D38ull, 0xC0C225C600D696D6ull },
+        {    9, 0x1110EE0FAC5309E0ull, 0x8F26AB788F8FD0EAull, 0x71673C4BC85AFD4Bull, 0xC825B865D0DF86BAull },
+        {   16, 0x437A59A79B5ED0F9ull, 0x7434E8E5709ED2C8ull, 0xA5C5211E540344A9ull, 0xF2FB6EB8CD4518ABull },
+        {   17, 0x16C0B8C6C24EBF88ull, 0x7D56144FFF8ED694ull, 0x9B7409795D35A421ull, 0xEDF2ABBB950E3A41ull },
+        {   32, 0x9326B5523A7C6AE8ull, 0x69DE8209C5E8FB08ull, 0xF50A363FCC4F68FFull, 0x220A680E3D358C49ull },
+        {   33, 0xA8FBF8C3752F2108ull, 0x4C52A9B1104D3BD6ull, 0xDBF1188E60827166ull, 0x1DFE45EFA487BC24ull },
+        {   64, 0xE79B89628870565Full, 0xB189E4E6C8FC8617ull, 0xDE09950FE16BF4D1ull, 0xB8A87A12D15AEE91ull },
+        {   65, 0x6638B7F8E05882C8ull, 0x7B11A834649ED530ull, 0x6EA3BABA8DFC57DFull, 0x517E695FA575C262ull },
+        {   96, 0x63179CF6F8E054E5ull, 0x60E327884077E40Full, 0xFC8E1441B1E66104ull, 0xABF8B9639E281560ull },
+        {   97, 0xD4B2C258A78DECD6ull, 0xD1D7929FDF9ECBD1ull, 0x5C3BCB778C6FEC3Bull, 0xD229AB3FF0D52E45ull },
+        {  128, 0x1D6DB726E54A180Full, 0xD4198883D1924E04ull, 0x5716ADBE1587E392ull, 0x11B04687C617E3ADull },
+        {  129, 0x50FAAB7648B5DAE0ull, 0x4B109FABBD7E3FBEull, 0x4447D14E7FB226C7ull, 0xF2338B67507AC507ull },
+        {  200, 0x7C02D0A9CC556637ull, 0xCC6392A4DBCD4E7Full, 0xB3436F5F3CDF190Dull, 0xA313E8B19B888360ull },
+        {  240, 0x5F837B8ADA59E53Dull, 0x9E82CE4060A65247ull, 0x34280B6602CE180Full, 0xA549F6352E9D5395ull },
+        {  241, 0xE2A19B3D4F90DF12ull, 0x5CB58910C21AE0FFull, 0xA73E86C3500C3907ull, 0x49E15B0D410BC50Aull },
+        {  255, 0xA643408A915E9C32ull, 0x9018C3C2034DB0D3ull, 0xE14191B71667E347ull, 0x058E9D2DB1661765ull },
+        {  256, 0xE271FF8254CD08B9ull, 0xA8850D6C436FE270ull, 0xC563F953EF0DDECBull, 0xDCFB15FD2F317BFCull },
+        {  257, 0x291A69B35FA30D60ull, 0xF91A5CBD6D749956ull, 0x6206140CE1D78AE4ull, 0x727051628310F3A8ull },
+        {  511, 0x1950CDE74E416B25ull, 0x62DA16530C6E1434ull, 0xA3FA25CC536EA7D4ull, 0x3C142FA643F6E2CBull },
+        {  512, 0x180C98329E5A3A0Full, 0x9852B0B12DCCC045ull, 0x6199ABDE8ACB8BA4ull, 0x300714909DDB5558ull },
+        { 1024, 0xF63F7E4A68D9DC2Aull, 0x439BE72D1E11C49Dull, 0xF8DBE35B6E644B3Eull, 0xC3E45A04436979D5ull },
+        { 1025, 0x80622D3A8206CE6Dull, 0x4BD8B7F8B02E10E8ull, 0xDF1F77976CBC5215ull, 0xB0C92170D4D27D08ull },
+        { 2047, 0xAE516F78114E2D88ull, 0x651211BDFA3D14E2ull, 0x421634EF7C7AD674ull, 0x2841D0BCFA5DDBD6ull },
+        { 2048, 0x0EFD5ED68ABF74FCull, 0x1D882CBA1CF2A725ull, 0xCE03F29F07A9A2EBull, 0x895DC3595C5B9542ull },
+        { 4096, 0x09A0A3A9B26EEAD8ull, 0x52349079E32AFEA9ull, 0x727D65257C8BDA7Aull, 0x9D003BA9E526534Aull },
+        { 4999, 0xDDFDD7E25E3517CEull, 0x02C3C7A3638D6E2Cull, 0x16F57DA39B23615Cull, 0x7F3BB3993CA2420Full },
+    };
+
+    const std::vector<uint8_t> v = ::pseudoRandomData(5000);
+
+    CHECK(omw::xxh64(reinterpret_cast<const uint8_t*>("abc"), 3) == 0x44BC2CF5AD770999);
+    CHECK(omw::xxh3(reinterpret_cast<const uint8_t*>("abc"), 3) == 0x78AF5F94892F3950);
+    CHECK(omw::xxh64(nullptr, 0) == 0xEF46DB3751D8E999);
+    CHECK(omw::xxh3(nullptr, 0) == 0x2D06800538D394C2);
+
+    for (const auto& e : table)
+    {
+        CHECK(omw::xxh64(v.data(), e.count) == e.xxh64);
+        CHECK(omw::xxh64(v.data(), e.count, seed) == e.xxh64Seed);
+        CHECK(omw::xxh64(v, 0, e.count, seed) == e.xxh64Seed);
+        CHECK(omw::xxh3(v.data(), e.count) == e.xxh3);
+        CHECK(omw::xxh3(v.data(), e.count, seed) == e.xxh3Seed);
+        CHECK(omw::xxh3(v, 0, e.count, seed) == e.xxh3Seed);
+
+        for (const size_t chunk : { 1, 7, 31, 32, 64, 100, 255, 256, 257, 1000 })
+        {
+            CHECK(::hashChunked(omw::Xxh64State(), v, e.count, chunk) == e.xxh64);
+            CHECK(::hashChunked(omw::Xxh64State(seed), v, e.count, chunk) == e.xxh64Seed);
+            CHECK(::hashChunked(omw::Xxh3State(), v, e.count, chunk) == e.xxh3);
+            CHECK(::hashChunked(omw::Xxh3State(seed), v, e.count, chunk) == e.xxh3Seed);
+        }
+    }
+
+    omw::Xxh3State state(seed);
+    state.update(v, 0, 1000);
+    (void)state.finalize();
+    state.update(v.data() + 1000, 3999);
+    CHECK(state.finalize() == table[sizeof(table) / sizeof(table[0]) - 1].xxh3Seed);
+    state.reset();
+    CHECK(state.finalize() == table[0].xxh3Seed);
+    state.reset(0);
+    CHECK(state.finalize() == table[0].xxh3);
+
+    CHECK_THROWS_AS(omw::xxh64(v, 1, v.size()), std::invalid_argument);
+    CHECK_THROWS_AS(omw::xxh3(v, v.size() + 1, 0), std::invalid_argument);
+    CHECK_THROWS_AS(state.update(v, 0, v.size() + 1), std::invalid_argument);
+}
+
+
+
+#ifdef CATCH_CONFIG_ENABLE_BENCHMARKING
+TEST_CASE("checksum.h parityWord() benchmark", "[.][benchmark]")
+{
+    const std::vector<uint8_t> data = ::pseudoRandomData(4 * 1024 * 1024);
+
+    BENCHMARK("byte wise XOR 4MiB")
+    {
+        uint8_t r = 0;
+        size_t count = data.size();
+        while (count--) { r ^= data[count]; }
+        return r;
+    };
+    BENCHMARK("omw::parityWord() 4MiB") { return omw::parityWord(data.data(), data.size()); };
+    BENCHMARK("omw::parityWord32() 4MiB") { return omw::parityWord32(data.data(), data.size()); };
+}
+
+TEST_CASE("checksum.h hash benchmark", "[.][benchmark]")
+{
+    const std::vector<uint8_t> data = ::pseudoRandomData(4 * 1024 * 1024);
+
+    BENCHMARK("omw::adler32() 4MiB") { return omw::adler32(data.data(), data.size()); };
+    BENCHMARK("omw::fletcher32() 4MiB") { return omw::fletcher32(data.data(), data.size()); };
+    BENCHMARK("omw::fnv1a64() 4MiB") { return omw::fnv1a64(data.data(), data.size()); };
+    BENCHMARK("omw::xxh64() 4MiB") { return omw::xxh64(data.data(), data.size()); };
+    BENCHMARK("omw::xxh3() 4MiB") { return omw::xxh3(data.data(), data.size()); };
+}
+
+TEST_CASE("checksum.h CRC-16 benchmark", "[.][benchmark]")
+{
+    const std::vector<uint8_t> data = ::pseudoRandomData(4 * 1024 * 1024);
+
+    BENCHMARK("byte wise omw::preview::crc16_kermit() 4MiB") { return omw::preview::crc16_kermit(data.data(), data.size()); };
+    BENCHMARK("slicing-by-8 omw::crc16::kermit() 4MiB") { return omw::crc16::kermit(data.data(), data.size()); };
+    BENCHMARK("slicing-by-8 omw::crc16::modbus() 4MiB") { return omw::crc16::modbus(data.data(), data.size()); };
+}
+
+#if (OMW_CPPSTD >= OMW_CPPSTD_14)
+TEST_CASE("checksum.h CRC-8/32/64 benchmark", "[.][benchmark]")
+{
+    const std::vector<uint8_t> data = ::pseudoRandomData(4 * 1024 * 1024);
+
+    BENCHMARK("byte wise CRC-32/ISO-HDLC 4MiB") { return omw::Crc<omw::crc32::Ieee>::calcBytewise(data.data(), data.size()); };
+    BENCHMARK("slicing-by-8 omw::crc8::smbus() 4MiB") { return omw::crc8::smbus(data.data(), data.size()); };
+    BENCHMARK("slicing-by-8 CRC-32/ISO-HDLC 4MiB") { return omw::Crc<omw::crc32::Ieee>::updateSlicing(0, data.data(), data.size()); };
+    BENCHMARK("omw::crc32::ieee() 4MiB") { return omw::crc32::ieee(data.data(), data.size()); };
+    BENCHMARK("slicing-by-8 CRC-32/ISCSI 4MiB") { return omw::Crc<omw::crc32::Castagnoli>::updateSlicing(0, data.data(), data.size()); };
+    BENCHMARK("omw::crc32::castagnoli() 4MiB") { return omw::crc32::castagnoli(data.data(), data.size()); };
+    BENCHMARK("slicing-by-8 omw::crc64::ecma() 4MiB") { return omw::crc64::ecma(data.data(), data.size()); };
+    BENCHMARK("slicing-by-8 omw::crc64::xz() 4MiB") { return omw::crc64::xz(data.data(), data.size()); };
+}
+
+TEST_CASE("checksum.h omw::crcParallel() benchmark", "[.][benchmark]")
+{
+    const std::vector<uint8_t> data = ::pseudoRandomData(64 * 1024 * 1024);
+
+    BENCHMARK("omw::crc64::xz() 64MiB") { return omw::crc64::xz(data.data(), data.size()); };
+    BENCHMARK("omw::crcParallel<omw::crc64::Xz>() 64MiB") { return omw::crcParallel<omw::crc64::Xz>(data.data(), data.size()); };
+    BENCHMARK("omw::crc32::ieee() 64MiB") { return omw::crc32::ieee(data.data(), data.size()); };
+    BENCHMARK("omw::crcParallel<omw::crc32::Ieee>() 64MiB") { return omw::crcParallel<omw::crc32::Ieee>(data.data(), data.size()); };
+}
+#endif // C++14
+#endif // CATCH_CONFIG_ENABLE_BENCHMARKING
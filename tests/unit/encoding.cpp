@@ -4,8 +4,10 @@ date            24.01.2022
 copyright       MIT - Copyright (c) 2022 Oliver Blaser
 */
 
+#include <algorithm>
 #include <array>
 #include <cstdint>
+#include <cstring>
 #include <stdexcept>
 #include <string>
 #include <vector>
@@ -13,11 +15,86 @@ copyright       MIT - Copyright (c) 2022 Oliver Blaser
 #include "catch2/catch.hpp"
 #include "testUtil.h"
 
+#include <omw/algorithm.h>
 #include <omw/encoding.h>
 #include <omw/int.h>
 
 
-TEST_CASE("encoding.h omw::bcd") {}
+TEST_CASE("encoding.h omw::bcd")
+{
+    const uint8_t rtc[] = { 0x59, 0x23, 0x31, 0x12, 0x99 };
+    CHECK(omw::bcd::decode8(rtc + 0, 1) == 59);
+    CHECK(omw::bcd::decode8(rtc + 1, 1) == 23);
+    CHECK(omw::bcd::decode16(rtc + 3, 2) == 1299);
+    CHECK(omw::bcd::decode32(rtc + 1, 4) == 23311299);
+    CHECK(omw::bcd::decode64(rtc, 5) == 5923311299);
+    CHECK(omw::bcd::decode128(rtc, 5) == omw::uint128_t(5923311299));
+
+    const uint8_t max64[] = { 0x00, 0x18, 0x44, 0x67, 0x44, 0x07, 0x37, 0x09, 0x55, 0x16, 0x15 };
+    CHECK(omw::bcd::decode64(max64, sizeof(max64)) == UINT64_MAX);
+    CHECK(omw::bcd::decode128(max64, sizeof(max64)) == omw::uint128_t(0, UINT64_MAX));
+    const uint8_t max32[] = { 0x42, 0x94, 0x96, 0x72, 0x95 };
+    CHECK(omw::bcd::decode32(max32, sizeof(max32)) == UINT32_MAX);
+    const uint8_t max8[] = { 0x00, 0x02, 0x55 };
+    CHECK(omw::bcd::decode8(max8, sizeof(max8)) == 255);
+
+    const uint8_t max128[] = { 0x03, 0x40, 0x28, 0x23, 0x66, 0x92, 0x09, 0x38, 0x46, 0x34,
+                               0x63, 0x37, 0x46, 0x07, 0x43, 0x17, 0x68, 0x21, 0x14, 0x55 };
+    CHECK(omw::bcd::decode128(max128, sizeof(max128)) == OMW_UINT128_MAX);
+
+    uint8_t buffer[21];
+    std::fill(buffer, buffer + sizeof(buffer), 0xEE);
+    omw::bcd::encode(buffer, 1, static_cast<uint64_t>(59));
+    CHECK(buffer[0] == 0x59);
+    CHECK(buffer[1] == 0xEE);
+    omw::bcd::encode(buffer, 5, static_cast<uint64_t>(5923311299));
+    CHECK(std::equal(rtc, rtc + 5, buffer));
+    omw::bcd::encode(buffer, 11, UINT64_MAX);
+    CHECK(std::equal(max64, max64 + sizeof(max64), buffer));
+    omw::bcd::encode(buffer, 20, OMW_UINT128_MAX);
+    CHECK(std::equal(max128, max128 + sizeof(max128), buffer));
+    CHECK(buffer[20] == 0xEE);
+    omw::bcd::encode(buffer, 21, omw::uint128_t(1234));
+    for (size_t i = 0; i < 19; ++i) CHECK(buffer[i] == 0);
+    CHECK(buffer[19] == 0x12);
+    CHECK(buffer[20] == 0x34);
+
+    // round trip
+    tu::Rng64 rng;
+    bool ok = true;
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        const uint64_t x = rng();
+        const omw::uint128_t v(x >> (i % 64), rng());
+
+        if (v < omw::uint128_t(0x0013426172C74D82, 0x2B878FE800000000)) // 10^38
+        {
+            omw::bcd::encode(buffer, 19, v);
+            ok = ok && (omw::bcd::decode128(buffer, 19) == v);
+        }
+
+        const uint64_t v64 = x >> (i % 64);
+        omw::bcd::encode(buffer, 10, v64 % 10000000000000000000u);
+        ok = ok && (omw::bcd::decode64(buffer, 10) == (v64 % 10000000000000000000u));
+    }
+    CHECK(ok);
+
+    const uint8_t invalid[] = { 0x12, 0x3A };
+    const uint8_t over16[] = { 0x06, 0x55, 0x36 };
+    const uint8_t over128[] = { 0x03, 0x40, 0x28, 0x23, 0x66, 0x92, 0x09, 0x38, 0x46, 0x34,
+                                0x63, 0x37, 0x46, 0x07, 0x43, 0x17, 0x68, 0x21, 0x14, 0x56 };
+    CHECK_THROWS_AS(omw::bcd::decode16(nullptr, 1), std::invalid_argument);
+    CHECK_THROWS_AS(omw::bcd::decode16(invalid, 0), std::invalid_argument);
+    CHECK_THROWS_AS(omw::bcd::decode16(invalid, 2), std::invalid_argument);
+    CHECK_THROWS_AS(omw::bcd::decode128(invalid, 2), std::invalid_argument);
+    CHECK_THROWS_AS(omw::bcd::decode16(over16, 3), std::overflow_error);
+    CHECK(omw::bcd::decode32(over16, 3) == 65536);
+    CHECK_THROWS_AS(omw::bcd::decode64(over128, sizeof(over128)), std::overflow_error);
+    CHECK_THROWS_AS(omw::bcd::decode128(over128, sizeof(over128)), std::overflow_error);
+    CHECK_THROWS_AS(omw::bcd::encode(buffer, 1, static_cast<uint64_t>(100)), std::overflow_error);
+    CHECK_THROWS_AS(omw::bcd::encode(buffer, 19, OMW_UINT128_MAX), std::overflow_error);
+    CHECK_THROWS_AS(omw::bcd::encode(nullptr, 1, static_cast<uint64_t>(0)), std::invalid_argument);
+}
 
 
 TEST_CASE("encoding.h omw::bigEndian decode")
@@ -265,3 +342,606 @@ TEST_CASE("encoding.h omw::bigEndian encode_128()")
     TESTUTIL_TRYCATCH_SE_CHECK((omw::bigEndian::encode_128(nullptr, sVal)), std::invalid_argument);
     TESTUTIL_TRYCATCH_SE_CHECK((omw::bigEndian::encode_128(nullptr, uVal)), std::invalid_argument);
 }
+
+TEST_CASE("encoding.h omw::bigEndian bulk decode and encode")
+{
+    // odd sizes and offsets to cover the vector and the scalar paths
+    std::vector<uint8_t> data(8 * 101 + 3);
+    for (size_t i = 0; i < data.size(); ++i) data[i] = static_cast<uint8_t>((i * 37) ^ 0x5A);
+
+    for (size_t offset = 0; offset < 3; ++offset)
+    {
+        const uint8_t* const src = data.data() + offset;
+
+        for (const size_t n : { 0, 1, 7, 8, 9, 31, 32, 33, 100 })
+        {
+            std::vector<uint16_t> u16(n);
+            std::vector<int16_t> i16(n);
+            std::vector<uint32_t> u32(n);
+            std::vector<int32_t> i32(n);
+            std::vector<uint64_t> u64(n);
+            std::vector<int64_t> i64(n);
+
+            omw::bigEndian::decode_ui16(src, u16.data(), n);
+            omw::bigEndian::decode_i16(src, i16.data(), n);
+            omw::bigEndian::decode_ui32(src, u32.data(), n);
+            omw::bigEndian::decode_i32(src, i32.data(), n);
+            omw::bigEndian::decode_ui64(src, u64.data(), n);
+            omw::bigEndian::decode_i64(src, i64.data(), n);
+
+            bool ok = true;
+            for (size_t i = 0; i < n; ++i)
+            {
+                ok = ok && (u16[i] == omw::bigEndian::decode_ui16(src + 2 * i));
+                ok = ok && (i16[i] == omw::bigEndian::decode_i16(src + 2 * i));
+                ok = ok && (u32[i] == omw::bigEndian::decode_ui32(src + 4 * i));
+                ok = ok && (i32[i] == omw::bigEndian::decode_i32(src + 4 * i));
+                ok = ok && (u64[i] == omw::bigEndian::decode_ui64(src + 8 * i));
+                ok = ok && (i64[i] == omw::bigEndian::decode_i64(src + 8 * i));
+            }
+            CHECK(ok);
+
+            std::vector<uint8_t> buffer(8 * n + 1, 0xEE);
+            omw::bigEndian::encode_16(buffer.data(), u16.data(), n);
+            CHECK(std::equal(buffer.begin(), buffer.begin() + 2 * n, src));
+            CHECK(buffer[2 * n] == 0xEE);
+            omw::bigEndian::encode_16(buffer.data(), i16.data(), n);
+            CHECK(std::equal(buffer.begin(), buffer.begin() + 2 * n, src));
+
+            omw::bigEndian::encode_32(buffer.data(), u32.data(), n);
+            CHECK(std::equal(buffer.begin(), buffer.begin() + 4 * n, src));
+            CHECK(buffer[4 * n] == 0xEE);
+            omw::bigEndian::encode_32(buffer.data(), i32.data(), n);
+            CHECK(std::equal(buffer.begin(), buffer.begin() + 4 * n, src));
+
+            omw::bigEndian::encode_64(buffer.data(), u64.data(), n);
+            CHECK(std::equal(buffer.begin(), buffer.begin() + 8 * n, src));
+            CHECK(buffer[8 * n] == 0xEE);
+            omw::bigEndian::encode_64(buffer.data(), i64.data(), n);
+            CHECK(std::equal(buffer.begin(), buffer.begin() + 8 * n, src));
+        }
+    }
+
+    const uint8_t be[] = { 0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC, 0xDE, 0xF0 };
+    uint32_t u32[2];
+    omw::bigEndian::decode_ui32(be, u32, 2);
+    CHECK(u32[0] == 0x12345678);
+    CHECK(u32[1] == 0x9ABCDEF0);
+    int16_t i16[4];
+    omw::bigEndian::decode_i16(be, i16, 4);
+    CHECK(i16[0] == 0x1234);
+    CHECK(i16[2] == -25924);
+
+    // in place
+    std::vector<uint64_t> inPlace(40, 0x0102030405060708);
+    omw::bigEndian::encode_64(reinterpret_cast<uint8_t*>(inPlace.data()), inPlace.data(), inPlace.size());
+    omw::bigEndian::decode_ui64(reinterpret_cast<const uint8_t*>(inPlace.data()), inPlace.data(), inPlace.size());
+    CHECK(inPlace == std::vector<uint64_t>(40, 0x0102030405060708));
+
+    CHECK_THROWS_AS(omw::bigEndian::decode_i16(nullptr, i16 + 0, 1), std::invalid_argument);
+    CHECK_THROWS_AS(omw::bigEndian::decode_ui32(be, static_cast<uint32_t*>(nullptr), 1), std::invalid_argument);
+    CHECK_THROWS_AS(omw::bigEndian::encode_32(nullptr, u32 + 0, 1), std::invalid_argument);
+    CHECK_NOTHROW(omw::bigEndian::decode_ui32(nullptr, static_cast<uint32_t*>(nullptr), 0));
+}
+
+TEST_CASE("encoding.h omw::littleEndian decode")
+{
+    const uint8_t data[] = { 0x11, 0x00, 0xEE, 0xDD, 0xCC, 0xBB, 0xAA, 0x99, 0x88, 0x77, 0x66, 0x55, 0x44, 0x33, 0x22, 0xFF };
+
+    CHECK(omw::littleEndian::decode_i16(data + 4, 1) == -52);
+    CHECK(omw::littleEndian::decode_ui16(data + 4, 1) == 204);
+    CHECK(omw::littleEndian::decode_i32(data + 3, 2) == -13091);
+    CHECK(omw::littleEndian::decode_ui32(data + 3, 2) == 0xCCDD);
+    CHECK(omw::littleEndian::decode_i32(data + 8, 3) == 0x667788);
+    CHECK(omw::littleEndian::decode_i64(data + 2, 5) == -0x5544332212);
+    CHECK(omw::littleEndian::decode_ui64(data + 2, 5) == 0xAABBCCDDEE);
+    CHECK(omw::littleEndian::decode_i128(data + 4, 1) == omw::int128_t(-52));
+    CHECK(omw::littleEndian::decode_ui128(data + 4, 1) == omw::uint128_t(204));
+
+    CHECK(omw::littleEndian::decode_i16(data + 14) == -222);
+    CHECK(omw::littleEndian::decode_ui16(data + 14) == 0xFF22);
+    CHECK(omw::littleEndian::decode_i32(data + 12) == -14535868);
+    CHECK(omw::littleEndian::decode_ui32(data + 12) == 0xFF223344);
+    CHECK(omw::littleEndian::decode_i64(data + 8) == -62431076246194296);
+    CHECK(omw::littleEndian::decode_ui64(data + 8) == 0xFF22334455667788);
+    CHECK(omw::littleEndian::decode_i128(data) == omw::int128_t(0xFF22334455667788, 0x99AABBCCDDEE0011));
+    CHECK(omw::littleEndian::decode_ui128(data) == omw::uint128_t(0xFF22334455667788, 0x99AABBCCDDEE0011));
+
+    // mirrors the big endian decoder on the reversed buffer
+    uint8_t reversed[sizeof(data)];
+    std::reverse_copy(data, data + sizeof(data), reversed);
+    for (size_t count = 1; count <= 8; ++count)
+    {
+        const uint8_t* const p = reversed + sizeof(data) - count;
+        CHECK(omw::littleEndian::decode_i64(data, count) == omw::bigEndian::decode_i64(p, count));
+        CHECK(omw::littleEndian::decode_ui64(data, count) == omw::bigEndian::decode_ui64(p, count));
+    }
+    for (size_t count = 1; count <= 16; ++count)
+    {
+        const uint8_t* const p = reversed + sizeof(data) - count;
+        CHECK(omw::littleEndian::decode_i128(data, count) == omw::bigEndian::decode_i128(p, count));
+        CHECK(omw::littleEndian::decode_ui128(data, count) == omw::bigEndian::decode_ui128(p, count));
+    }
+
+    TESTUTIL_TRYCATCH_OPEN_DECLARE_VAL(int32_t, 123);
+    TESTUTIL_TRYCATCH_CHECK(omw::littleEndian::decode_i32(nullptr), std::invalid_argument);
+    TESTUTIL_TRYCATCH_CHECK(omw::littleEndian::decode_i32(data, 0), std::invalid_argument);
+    TESTUTIL_TRYCATCH_CHECK(omw::littleEndian::decode_i32(data, 5), std::overflow_error);
+    TESTUTIL_TRYCATCH_CLOSE();
+
+    TESTUTIL_TRYCATCH_OPEN_DECLARE_VAL(omw::uint128_t, omw::uint128_t(123));
+    TESTUTIL_TRYCATCH_CHECK(omw::littleEndian::decode_ui128(nullptr), std::invalid_argument);
+    TESTUTIL_TRYCATCH_CHECK(omw::littleEndian::decode_ui128(data, 0), std::invalid_argument);
+    TESTUTIL_TRYCATCH_CHECK(omw::littleEndian::decode_ui128(data, 17), std::overflow_error);
+    TESTUTIL_TRYCATCH_CLOSE();
+}
+
+TEST_CASE("encoding.h omw::littleEndian encode")
+{
+    uint8_t buffer[17];
+
+    std::fill(buffer, buffer + sizeof(buffer), 0xEE);
+    omw::littleEndian::encode_16(buffer, static_cast<int16_t>(-2));
+    CHECK(buffer[0] == 0xFE);
+    CHECK(buffer[1] == 0xFF);
+    CHECK(buffer[2] == 0xEE);
+
+    omw::littleEndian::encode_32(buffer, static_cast<uint32_t>(0x12345678));
+    CHECK(buffer[0] == 0x78);
+    CHECK(buffer[3] == 0x12);
+    CHECK(buffer[4] == 0xEE);
+
+    omw::littleEndian::encode_64(buffer + 1, static_cast<uint64_t>(0x0102030405060708));
+    const uint8_t exp64[] = { 0x78, 0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01, 0xEE };
+    CHECK(std::equal(exp64, exp64 + sizeof(exp64), buffer));
+
+    omw::littleEndian::encode_128(buffer, omw::uint128_t(0x0102030405060708, 0x090A0B0C0D0E0F10));
+    for (size_t i = 0; i < 16; ++i) CHECK(buffer[i] == 16 - i);
+    CHECK(buffer[16] == 0xEE);
+    CHECK(omw::littleEndian::decode_ui128(buffer) == omw::uint128_t(0x0102030405060708, 0x090A0B0C0D0E0F10));
+
+    omw::littleEndian::encode_128(buffer, omw::int128_t(-3));
+    CHECK(omw::littleEndian::decode_i128(buffer) == omw::int128_t(-3));
+
+    CHECK_THROWS_AS(omw::littleEndian::encode_16(nullptr, static_cast<uint16_t>(0)), std::invalid_argument);
+    CHECK_THROWS_AS(omw::littleEndian::encode_64(nullptr, static_cast<int64_t>(0)), std::invalid_argument);
+    CHECK_THROWS_AS(omw::littleEndian::encode_128(nullptr, omw::uint128_t(0)), std::invalid_argument);
+}
+
+TEST_CASE("encoding.h omw::littleEndian bulk decode and encode")
+{
+    std::vector<uint8_t> data(8 * 37 + 3);
+    for (size_t i = 0; i < data.size(); ++i) data[i] = static_cast<uint8_t>((i * 37) ^ 0x5A);
+
+    for (size_t offset = 0; offset < 3; ++offset)
+    {
+        const uint8_t* const src = data.data() + offset;
+
+        for (const size_t n : { 0, 1, 7, 36 })
+        {
+            std::vector<int16_t> i16(n);
+            std::vector<uint32_t> u32(n);
+            std::vector<int64_t> i64(n);
+
+            omw::littleEndian::decode_i16(src, i16.data(), n);
+            omw::littleEndian::decode_ui32(src, u32.data(), n);
+            omw::littleEndian::decode_i64(src, i64.data(), n);
+
+            bool ok = true;
+            for (size_t i = 0; i < n; ++i)
+            {
+                ok = ok && (i16[i] == omw::littleEndian::decode_i16(src + 2 * i));
+                ok = ok && (u32[i] == omw::littleEndian::decode_ui32(src + 4 * i));
+                ok = ok && (i64[i] == omw::littleEndian::decode_i64(src + 8 * i));
+            }
+            CHECK(ok);
+
+            std::vector<uint8_t> buffer(8 * n + 1, 0xEE);
+            omw::littleEndian::encode_16(buffer.data(), i16.data(), n);
+            CHECK(std::equal(buffer.begin(), buffer.begin() + 2 * n, src));
+            CHECK(buffer[2 * n] == 0xEE);
+            omw::littleEndian::encode_32(buffer.data(), u32.data(), n);
+            CHECK(std::equal(buffer.begin(), buffer.begin() + 4 * n, src));
+            omw::littleEndian::encode_64(buffer.data(), i64.data(), n);
+            CHECK(std::equal(buffer.begin(), buffer.begin() + 8 * n, src));
+            CHECK(buffer[8 * n] == 0xEE);
+        }
+    }
+
+    std::vector<uint32_t> inPlace(40, 0x01020304);
+    omw::littleEndian::encode_32(reinterpret_cast<uint8_t*>(inPlace.data()), inPlace.data(), inPlace.size());
+    omw::littleEndian::decode_ui32(reinterpret_cast<const uint8_t*>(inPlace.data()), inPlace.data(), inPlace.size());
+    CHECK(inPlace == std::vector<uint32_t>(40, 0x01020304));
+
+    uint16_t u16[1];
+    CHECK_THROWS_AS(omw::littleEndian::decode_ui16(nullptr, u16 + 0, 1), std::invalid_argument);
+    CHECK_THROWS_AS(omw::littleEndian::encode_16(nullptr, u16 + 0, 1), std::invalid_argument);
+    CHECK_NOTHROW(omw::littleEndian::decode_ui16(nullptr, static_cast<uint16_t*>(nullptr), 0));
+}
+
+TEST_CASE("encoding.h omw::nativeEndian")
+{
+    const uint32_t value = 0xA1B2C3D4;
+    uint8_t mem[4];
+    std::memcpy(mem, &value, sizeof(value));
+
+    CHECK(omw::nativeEndian::decode_ui32(mem) == value);
+
+    uint8_t buffer[4];
+    omw::nativeEndian::encode_32(buffer, value);
+    CHECK(std::equal(buffer, buffer + 4, mem));
+}
+
+TEST_CASE("encoding.h omw::ByteReader")
+{
+    const std::vector<uint8_t> data = { 0x81, 0x12, 0x34, 0x78, 0x56, 0x34, 0x12, 0x03, 'a', 'b', 'c', 0x00, 0x02, 'x', 'y', 0xAC, 0x02,
+                                        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x01, 'z' };
+
+    omw::ByteReader reader(data);
+    CHECK(reader.size() == data.size());
+    CHECK(reader.getBE<int8_t>() == -127);
+    CHECK(reader.getBE<uint16_t>() == 0x1234);
+    CHECK(reader.getLE<uint32_t>() == 0x12345678);
+    CHECK(reader.pos() == 7);
+    CHECK(reader.getStringBE<uint8_t>() == "abc");
+    CHECK(reader.getStringBE<uint16_t>() == "xy");
+    CHECK(reader.getVarint() == 300);
+    CHECK(reader.getVarint() == UINT64_MAX);
+    CHECK(reader.getStringVarint() == "z");
+    CHECK(reader.atEnd());
+    CHECK(reader.remaining() == 0);
+
+    // grouped read
+    reader.seek(0);
+    uint8_t u8;
+    int16_t i16;
+    uint32_t u32;
+    reader.getBE(u8, i16);
+    reader.getLE(u32);
+    CHECK(u8 == 0x81);
+    CHECK(i16 == 0x1234);
+    CHECK(u32 == 0x12345678);
+
+    const uint8_t* const p = reader.getBytes(6);
+    CHECK(p == data.data() + 7);
+    CHECK(reader.getString(2) == "xy");
+
+    reader.seek(7);
+    omw::ByteReader sub = reader.getReader(4);
+    CHECK(reader.pos() == 11);
+    CHECK(sub.size() == 4);
+    CHECK(sub.getStringLE<uint8_t>() == "abc");
+
+    // 128-bit
+    const uint8_t raw[] = { 0xFF, 0xFE, 0xFD, 0xFC, 0xFB, 0xFA, 0xF9, 0xF8, 0xF7, 0xF6, 0xF5, 0xF4, 0xF3, 0xF2, 0xF1, 0xF0 };
+    omw::ByteReader reader128(raw, sizeof(raw));
+    CHECK(reader128.getBE<omw::uint128_t>() == omw::bigEndian::decode_ui128(raw));
+    reader128.seek(0);
+    CHECK(reader128.getLE<omw::int128_t>() == omw::littleEndian::decode_i128(raw));
+    reader128.seek(0);
+    CHECK(reader128.getLE<int64_t>() == omw::littleEndian::decode_i64(raw));
+    CHECK(reader128.getBE<int64_t>() == omw::bigEndian::decode_i64(raw + 8));
+
+    // errors don't change the position
+    reader.seek(28);
+    CHECK_THROWS_AS(reader.getBE<uint32_t>(), std::out_of_range);
+    CHECK_THROWS_AS(reader.getBE(u8, i16), std::out_of_range);
+    CHECK(reader.pos() == 28);
+    CHECK_THROWS_AS(reader.getStringBE<uint8_t>(), std::out_of_range); // 'z' as length
+    CHECK(reader.pos() == 28);
+    CHECK_THROWS_AS(reader.seek(30), std::out_of_range);
+    CHECK_THROWS_AS(reader.skip(2), std::out_of_range);
+    CHECK_NOTHROW(reader.skip(1));
+
+    const uint8_t truncated[] = { 0x80, 0x80 };
+    omw::ByteReader truncatedReader(truncated, sizeof(truncated));
+    CHECK_THROWS_AS(truncatedReader.getVarint(), std::out_of_range);
+    CHECK(truncatedReader.pos() == 0);
+
+    const uint8_t tooBig[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02 };
+    omw::ByteReader tooBigReader(tooBig, sizeof(tooBig));
+    CHECK_THROWS_AS(tooBigReader.getVarint(), std::overflow_error);
+
+    CHECK_THROWS_AS(omw::ByteReader(nullptr, 1), std::invalid_argument);
+    CHECK_NOTHROW(omw::ByteReader(nullptr, 0));
+}
+
+TEST_CASE("encoding.h omw::ByteWriter")
+{
+    std::vector<uint8_t> buffer(29, 0xEE);
+    omw::ByteWriter writer(buffer);
+
+    writer.putBE(static_cast<int8_t>(-127), static_cast<uint16_t>(0x1234));
+    writer.putLE<uint32_t>(0x12345678);
+    writer.putStringBE<uint8_t>("abc");
+    writer.putStringBE<uint16_t>("xy");
+    writer.putVarint(300);
+    writer.putVarint(UINT64_MAX);
+    writer.putStringVarint("z");
+    CHECK(writer.atEnd());
+
+    const std::vector<uint8_t> expected = { 0x81, 0x12, 0x34, 0x78, 0x56, 0x34, 0x12, 0x03, 'a', 'b', 'c', 0x00, 0x02, 'x', 'y', 0xAC, 0x02,
+                                            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x01, 'z' };
+    CHECK(buffer == expected);
+
+    // round trip
+    std::vector<uint8_t> rt(64);
+    omw::ByteWriter w(rt.data(), rt.size());
+    w.putBE(omw::uint128_t(0x0102030405060708, 0x090A0B0C0D0E0F10), omw::int128_t(-2));
+    w.putLE(omw::int128_t(-3), static_cast<int64_t>(-4));
+    const uint8_t bytes[] = { 1, 2, 3 };
+    w.putBytes(bytes, sizeof(bytes));
+    w.putString("hi");
+    CHECK(w.pos() == 61);
+
+    omw::ByteReader r(rt.data(), w.pos());
+    omw::uint128_t u128;
+    omw::int128_t i128;
+    r.getBE(u128, i128);
+    CHECK(u128 == omw::uint128_t(0x0102030405060708, 0x090A0B0C0D0E0F10));
+    CHECK(i128 == omw::int128_t(-2));
+    CHECK(omw::bigEndian::decode_ui128(rt.data()) == u128);
+    CHECK(r.getLE<omw::int128_t>() == omw::int128_t(-3));
+    CHECK(r.getLE<int64_t>() == -4);
+    CHECK(std::equal(bytes, bytes + sizeof(bytes), r.getBytes(3)));
+    CHECK(r.getString(2) == "hi");
+
+    // errors don't write
+    std::vector<uint8_t> small(4, 0xEE);
+    omw::ByteWriter sw(small);
+    sw.skip(1);
+    CHECK_THROWS_AS(sw.putBE(static_cast<uint16_t>(1), static_cast<uint16_t>(2)), std::out_of_range);
+    CHECK_THROWS_AS(sw.putStringBE<uint8_t>("abc"), std::out_of_range);
+    CHECK_THROWS_AS(sw.putStringVarint("abc"), std::out_of_range);
+    CHECK_THROWS_AS(sw.putStringBE<uint8_t>(std::string(256, 'a')), std::overflow_error);
+    CHECK_THROWS_AS(sw.putVarint(UINT64_MAX), std::out_of_range);
+    CHECK(small == std::vector<uint8_t>(4, 0xEE));
+    CHECK(sw.pos() == 1);
+    CHECK_THROWS_AS(sw.seek(5), std::out_of_range);
+    CHECK_THROWS_AS(omw::ByteWriter(nullptr, 1), std::invalid_argument);
+}
+
+TEST_CASE("encoding.h omw::varint")
+{
+    uint8_t buffer[omw::varint::maxSize128 + 1];
+    size_t length = 0;
+
+    CHECK(omw::varint::encode_32(buffer, 0) == 1);
+    CHECK(buffer[0] == 0x00);
+    CHECK(omw::varint::encode_32(buffer, 300) == 2);
+    CHECK(buffer[0] == 0xAC);
+    CHECK(buffer[1] == 0x02);
+    CHECK(omw::varint::decode_ui32(buffer, 2, &length) == 300);
+    CHECK(length == 2);
+
+    CHECK(omw::varint::encode_32(buffer, UINT32_MAX) == omw::varint::maxSize32);
+    CHECK(buffer[4] == 0x0F);
+    CHECK(omw::varint::decode_ui32(buffer, sizeof(buffer)) == UINT32_MAX);
+    CHECK(omw::varint::encode_64(buffer, UINT64_MAX) == omw::varint::maxSize64);
+    CHECK(buffer[9] == 0x01);
+    CHECK(omw::varint::decode_ui64(buffer, sizeof(buffer), &length) == UINT64_MAX);
+    CHECK(length == 10);
+
+    const omw::uint128_t u128(0x0123456789ABCDEF, 0xFEDCBA9876543210);
+    length = omw::varint::encode_128(buffer, u128);
+    CHECK(length == 18); // 121 bits
+    CHECK(omw::varint::decode_ui128(buffer, length) == u128);
+    CHECK(omw::varint::encode_128(buffer, OMW_UINT128_MAX) == omw::varint::maxSize128);
+    CHECK(buffer[18] == 0x03);
+    CHECK(omw::varint::decode_ui128(buffer, sizeof(buffer)) == OMW_UINT128_MAX);
+    CHECK(omw::varint::encode_128(buffer, omw::uint128_t(0, 0x80)) == 2);
+    CHECK(omw::varint::decode_ui128(buffer, 2, &length) == omw::uint128_t(0, 0x80));
+    CHECK(omw::varint::encode_128(buffer, omw::uint128_t(1, 0)) == 10);
+    CHECK(omw::varint::decode_ui128(buffer, 10) == omw::uint128_t(1, 0));
+
+    CHECK(omw::varint::zigzagEncode(0) == 0);
+    CHECK(omw::varint::zigzagEncode(-1) == 1);
+    CHECK(omw::varint::zigzagEncode(1) == 2);
+    CHECK(omw::varint::zigzagEncode(-2) == 3);
+    CHECK(omw::varint::zigzagEncode(INT32_MAX) == (UINT32_MAX - 1));
+    CHECK(omw::varint::zigzagEncode(INT32_MIN) == UINT32_MAX);
+    CHECK(omw::varint::zigzagEncode(INT64_MIN) == UINT64_MAX);
+    CHECK(omw::varint::zigzagDecode(static_cast<uint32_t>(3)) == -2);
+    CHECK(omw::varint::zigzagDecode(UINT64_MAX) == INT64_MIN);
+    CHECK(omw::varint::zigzagEncode(omw::int128_t(-2)) == omw::uint128_t(3));
+    CHECK(omw::varint::zigzagEncode(OMW_INT128_MIN) == OMW_UINT128_MAX);
+    CHECK(omw::varint::zigzagDecode(omw::uint128_t(0, 0xFFFFFFFFFFFFFFFF)) == omw::int128_t(INT64_MIN));
+    CHECK(omw::varint::zigzagDecode(omw::varint::zigzagEncode(OMW_INT128_MAX)) == OMW_INT128_MAX);
+
+#if (OMW_CPPSTD >= OMW_CPPSTD_14)
+    static_assert(omw::varint::zigzagEncode(static_cast<int64_t>(-3)) == 5, "");
+#endif
+
+    CHECK(omw::varint::encodeZigzag_32(buffer, -64) == 1);
+    CHECK(omw::varint::decodeZigzag_i32(buffer, 1) == -64);
+    CHECK(omw::varint::encodeZigzag_64(buffer, INT64_MIN) == 10);
+    CHECK(omw::varint::decodeZigzag_i64(buffer, 10) == INT64_MIN);
+    CHECK(omw::varint::encodeZigzag_128(buffer, omw::int128_t(-65)) == 2);
+    CHECK(omw::varint::decodeZigzag_i128(buffer, 2) == omw::int128_t(-65));
+
+    const uint8_t truncated[] = { 0x80, 0x80 };
+    const uint8_t tooBig32[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0x1F };
+    const uint8_t tooLong32[] = { 0x80, 0x80, 0x80, 0x80, 0x80, 0x00 };
+    CHECK_THROWS_AS(omw::varint::decode_ui32(nullptr, 1), std::invalid_argument);
+    CHECK_THROWS_AS(omw::varint::decode_ui32(truncated, 0), std::invalid_argument);
+    CHECK_THROWS_AS(omw::varint::decode_ui32(truncated, 2), std::out_of_range);
+    CHECK_THROWS_AS(omw::varint::decode_ui128(truncated, 2), std::out_of_range);
+    CHECK_THROWS_AS(omw::varint::decode_ui32(tooBig32, 5), std::overflow_error);
+    CHECK_THROWS_AS(omw::varint::decode_ui32(tooLong32, 6), std::overflow_error);
+    CHECK(omw::varint::decode_ui64(tooBig32, 5) == 0x1FFFFFFFF);
+    CHECK_THROWS_AS(omw::varint::encode_32(nullptr, 0), std::invalid_argument);
+    CHECK_THROWS_AS(omw::varint::encode_128(nullptr, omw::uint128_t(0)), std::invalid_argument);
+}
+
+TEST_CASE("encoding.h omw::varint bulk decode")
+{
+    // mixed lengths to cover the single byte, 16-bit lane, 32-bit lane and scalar paths
+    std::vector<uint64_t> values;
+    tu::Rng64 rng(0x9E3779B97F4A7C15);
+    for (size_t i = 0; i < 3000; ++i)
+    {
+        const uint64_t x = rng();
+        const unsigned bits[] = { 7, 7, 7, 14, 14, 21, 28, 35, 64 };
+        const unsigned b = bits[(i / 40 + x) % (sizeof(bits) / sizeof(bits[0]))];
+        values.push_back((b == 64) ? x : (x & ((1ull << b) - 1)));
+    }
+    for (size_t i = 100; i < 200; ++i) values[i] = i; // long single byte run
+
+    std::vector<uint8_t> data(values.size() * omw::varint::maxSize64);
+    std::vector<uint8_t> data32(values.size() * omw::varint::maxSize32);
+    size_t size = 0;
+    size_t size32 = 0;
+    for (const uint64_t v : values)
+    {
+        size += omw::varint::encode_64(data.data() + size, v);
+        size32 += omw::varint::encode_32(data32.data() + size32, static_cast<uint32_t>(v));
+    }
+
+    for (const size_t n : { 0, 1, 15, 16, 17, 100, 3000 })
+    {
+        std::vector<uint64_t> u64(n + 1, 0xA5);
+        std::vector<uint32_t> u32(n + 1, 0xA5);
+        std::vector<int64_t> i64(n);
+
+        const size_t consumed = omw::varint::decode_ui64(data.data(), size, u64.data(), n);
+        const size_t consumed32 = omw::varint::decode_ui32(data32.data(), size32, u32.data(), n);
+        omw::varint::decodeZigzag_i64(data.data(), size, i64.data(), n);
+
+        bool ok = true;
+        size_t pos = 0;
+        size_t pos32 = 0;
+        for (size_t i = 0; i < n; ++i)
+        {
+            size_t length;
+            ok = ok && (u64[i] == values[i]);
+            ok = ok && (u32[i] == static_cast<uint32_t>(values[i]));
+            ok = ok && (i64[i] == omw::varint::zigzagDecode(values[i]));
+            pos += (omw::varint::decode_ui64(data.data() + pos, size - pos, &length), length);
+            pos32 += (omw::varint::decode_ui32(data32.data() + pos32, size32 - pos32, &length), length);
+        }
+        CHECK(ok);
+        CHECK(consumed == pos);
+        CHECK(consumed32 == pos32);
+        CHECK(u64[n] == 0xA5);
+        CHECK(u32[n] == 0xA5);
+    }
+
+    std::vector<int32_t> i32(3);
+    const uint8_t zz[] = { 0x00, 0x01, 0x7F };
+    CHECK(omw::varint::decodeZigzag_i32(zz, sizeof(zz), i32.data(), 3) == 3);
+    CHECK(i32 == std::vector<int32_t>({ 0, -1, -64 }));
+
+    std::vector<uint64_t> u64(values.size());
+    CHECK_THROWS_AS(omw::varint::decode_ui64(data.data(), size - 1, u64.data(), values.size()), std::out_of_range);
+    CHECK_THROWS_AS(omw::varint::decode_ui64(data.data(), size, u64.data(), values.size() + 1), std::out_of_range);
+    std::vector<uint32_t> u32(values.size());
+    CHECK_THROWS_AS(omw::varint::decode_ui32(data.data(), size, u32.data(), values.size()), std::overflow_error);
+    CHECK_THROWS_AS(omw::varint::decode_ui32(nullptr, 1, u32.data(), 1), std::invalid_argument);
+    CHECK_THROWS_AS(omw::varint::decode_ui32(data.data(), size, nullptr, 1), std::invalid_argument);
+    CHECK(omw::varint::decode_ui32(nullptr, 0, nullptr, 0) == 0);
+}
+
+#ifdef CATCH_CONFIG_ENABLE_BENCHMARKING
+TEST_CASE("encoding.h omw::bigEndian benchmark", "[.][benchmark]")
+{
+    constexpr size_t n = 1024 * 1024;
+    std::vector<uint8_t> data(4 * n);
+    for (size_t i = 0; i < data.size(); ++i) data[i] = static_cast<uint8_t>(i * 37);
+    std::vector<uint32_t> values(n);
+
+    BENCHMARK("decode_ui32() per value 1Mi")
+    {
+        for (size_t i = 0; i < n; ++i) values[i] = omw::bigEndian::decode_ui32(data.data() + 4 * i);
+        return values[n - 1];
+    };
+
+    BENCHMARK("decode_ui32() bulk 1Mi")
+    {
+        omw::bigEndian::decode_ui32(data.data(), values.data(), n);
+        return values[n - 1];
+    };
+
+    BENCHMARK("encode_32() per value 1Mi")
+    {
+        for (size_t i = 0; i < n; ++i) omw::bigEndian::encode_32(data.data() + 4 * i, values[i]);
+        return data[0];
+    };
+
+    BENCHMARK("encode_32() bulk 1Mi")
+    {
+        omw::bigEndian::encode_32(data.data(), values.data(), n);
+        return data[0];
+    };
+
+    BENCHMARK("ByteReader::getBE() grouped 4x 256Ki")
+    {
+        omw::ByteReader reader(data);
+        uint32_t a, b, c, d;
+        for (size_t i = 0; i < (n / 4); ++i)
+        {
+            reader.getBE(a, b, c, d);
+            values[i] = a ^ b ^ c ^ d;
+        }
+        return values[(n / 4) - 1];
+    };
+}
+#endif // CATCH_CONFIG_ENABLE_BENCHMARKING
+
+#ifdef CATCH_CONFIG_ENABLE_BENCHMARKING
+TEST_CASE("encoding.h omw::varint benchmark", "[.][benchmark]")
+{
+    constexpr size_t n = 1024 * 1024;
+    std::vector<uint8_t> data(n * omw::varint::maxSize32);
+    std::vector<uint32_t> values(n);
+    size_t size = 0;
+    uint32_t x = 12345;
+    for (size_t i = 0; i < n; ++i)
+    {
+        x = x * 1103515245 + 12345;
+        const uint32_t v = ((x >> 16) % 4 == 0) ? (x & 0xFFFFF) : ((x >> 8) & 0x3FF); // mostly 1 and 2 byte values
+        size += omw::varint::encode_32(data.data() + size, v);
+    }
+
+    BENCHMARK("decode_ui32() per value 1Mi")
+    {
+        size_t pos = 0;
+        for (size_t i = 0; i < n; ++i)
+        {
+            size_t length;
+            values[i] = omw::varint::decode_ui32(data.data() + pos, size - pos, &length);
+            pos += length;
+        }
+        return values[n - 1];
+    };
+
+    BENCHMARK("decode_ui32() bulk 1Mi")
+    {
+        omw::varint::decode_ui32(data.data(), size, values.data(), n);
+        return values[n - 1];
+    };
+}
+#endif // CATCH_CONFIG_ENABLE_BENCHMARKING
+
+#ifdef CATCH_CONFIG_ENABLE_BENCHMARKING
+TEST_CASE("encoding.h omw::bcd benchmark", "[.][benchmark]")
+{
+    const omw::uint128_t value(0x0123456789ABCDEF, 0xFEDCBA9876543210);
+    uint8_t buffer[20];
+
+    BENCHMARK("omw::doubleDabble() 128-bit") { return omw::doubleDabble(value); };
+
+    BENCHMARK("omw::bcd::encode() 128-bit")
+    {
+        omw::bcd::encode(buffer, sizeof(buffer), value);
+        return buffer[19];
+    };
+
+    BENCHMARK("omw::bcd::encode() 64-bit")
+    {
+        omw::bcd::encode(buffer, 10, static_cast<uint64_t>(1234567890123456789));
+        return buffer[9];
+    };
+
+    BENCHMARK("omw::bcd::decode64() 10 bytes") { return omw::bcd::decode64(buffer, 10); };
+}
+#endif // CATCH_CONFIG_ENABLE_BENCHMARKING
@@ -5,7 +5,9 @@ copyright       MIT - Copyright (c) 2022 Oliver Blaser
 */
 
 #include <cstdint>
+#include <cstring>
 #include <stdexcept>
+#include <type_traits>
 #include <string>
 #include <vector>
 
@@ -1499,3 +1501,701 @@ TEST_CASE("int.h compairson operators mixed")
     CHECK_FALSE(s >= u);
     CHECK(u >= s);
 }
+
+TEST_CASE("int.h unsigned multiplication and division operators")
+{
+    CHECK(base_int128_eq(omw::uint128_t(0x0000000000000000, 0xFFFFFFFFFFFFFFFF) * omw::uint128_t(0x0000000000000000, 0xFFFFFFFFFFFFFFFF), 0xFFFFFFFFFFFFFFFE, 0x0000000000000001));
+    CHECK(base_int128_eq(omw::uint128_t(0x0123456789ABCDEF, 0x0123456789ABCDEF) * omw::uint128_t(0x0000000000000000, 0xFEDCBA9876543210), 0x2358D29092D96432, 0x2236D88FE5618CF0));
+    CHECK(base_int128_eq(omw::uint128_t(0x8000000000000000, 0x0000000000003039) * omw::uint128_t(0x0000000000000001, 0x0000000000000001), 0x8000000000003039, 0x0000000000003039));
+    CHECK(base_int128_eq(omw::uint128_t(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF) * omw::uint128_t(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF), 0x0000000000000000, 0x0000000000000001));
+    CHECK(base_int128_eq(omw::uint128_t(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF) * omw::uint128_t(0x0000000000000000, 0x0000000000000003), 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFD));
+    CHECK(base_int128_eq(omw::uint128_t(0xDEADBEEFCAFEBABE, 0x0123456789ABCDEF) * omw::uint128_t(0x0000000000000001, 0x000000000000000F), 0x0D5175746E98BF11, 0x1111111111111101));
+    CHECK(base_int128_eq(omw::uint128_t(0x4B3B4CA85A86C47A, 0x098A224000000000) * omw::uint128_t(0x0000000000000000, 0x8AC7230489E80000), 0xEBFDCB54864ADA83, 0x4A00000000000000));
+    CHECK(base_int128_eq(omw::uint128_t(0x4B3B4CA85A86C47A, 0x098A224000000007) * omw::uint128_t(0x0000000000000005, 0x6BC75E2D63100003), 0x199BD7464E80D6B4, 0xF311F9FDB5700015));
+
+    CHECK(base_int128_eq(omw::uint128_t(0x0000000000000000, 0xFFFFFFFFFFFFFFFF) / omw::uint128_t(0x0000000000000000, 0xFFFFFFFFFFFFFFFF), 0x0000000000000000, 0x0000000000000001));
+    CHECK(base_int128_eq(omw::uint128_t(0x0000000000000000, 0xFFFFFFFFFFFFFFFF) % omw::uint128_t(0x0000000000000000, 0xFFFFFFFFFFFFFFFF), 0x0000000000000000, 0x0000000000000000));
+    CHECK(base_int128_eq(omw::uint128_t(0x0123456789ABCDEF, 0x0123456789ABCDEF) / omw::uint128_t(0x0000000000000000, 0xFEDCBA9876543210), 0x0000000000000000, 0x0124924924924923));
+    CHECK(base_int128_eq(omw::uint128_t(0x0123456789ABCDEF, 0x0123456789ABCDEF) % omw::uint128_t(0x0000000000000000, 0xFEDCBA9876543210), 0x0000000000000000, 0x7F598F328CC265BF));
+    CHECK(base_int128_eq(omw::uint128_t(0x8000000000000000, 0x0000000000003039) / omw::uint128_t(0x0000000000000001, 0x0000000000000001), 0x0000000000000000, 0x7FFFFFFFFFFFFFFF));
+    CHECK(base_int128_eq(omw::uint128_t(0x8000000000000000, 0x0000000000003039) % omw::uint128_t(0x0000000000000001, 0x0000000000000001), 0x0000000000000000, 0x800000000000303A));
+    CHECK(base_int128_eq(omw::uint128_t(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF) / omw::uint128_t(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF), 0x0000000000000000, 0x0000000000000001));
+    CHECK(base_int128_eq(omw::uint128_t(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF) % omw::uint128_t(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF), 0x0000000000000000, 0x0000000000000000));
+    CHECK(base_int128_eq(omw::uint128_t(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF) / omw::uint128_t(0x0000000000000000, 0x0000000000000003), 0x5555555555555555, 0x5555555555555555));
+    CHECK(base_int128_eq(omw::uint128_t(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF) % omw::uint128_t(0x0000000000000000, 0x0000000000000003), 0x0000000000000000, 0x0000000000000000));
+    CHECK(base_int128_eq(omw::uint128_t(0xDEADBEEFCAFEBABE, 0x0123456789ABCDEF) / omw::uint128_t(0x0000000000000001, 0x000000000000000F), 0x0000000000000000, 0xDEADBEEFCAFEBAB0));
+    CHECK(base_int128_eq(omw::uint128_t(0xDEADBEEFCAFEBABE, 0x0123456789ABCDEF) % omw::uint128_t(0x0000000000000001, 0x000000000000000F), 0x0000000000000000, 0xF4F5155AA4BEDD9F));
+    CHECK(base_int128_eq(omw::uint128_t(0x4B3B4CA85A86C47A, 0x098A224000000000) / omw::uint128_t(0x0000000000000000, 0x8AC7230489E80000), 0x0000000000000000, 0x8AC7230489E80000));
+    CHECK(base_int128_eq(omw::uint128_t(0x4B3B4CA85A86C47A, 0x098A224000000000) % omw::uint128_t(0x0000000000000000, 0x8AC7230489E80000), 0x0000000000000000, 0x0000000000000000));
+    CHECK(base_int128_eq(omw::uint128_t(0x4B3B4CA85A86C47A, 0x098A224000000007) / omw::uint128_t(0x0000000000000005, 0x6BC75E2D63100003), 0x0000000000000000, 0x0DE0B6B3A763FFFF));
+    CHECK(base_int128_eq(omw::uint128_t(0x4B3B4CA85A86C47A, 0x098A224000000007) % omw::uint128_t(0x0000000000000005, 0x6BC75E2D63100003), 0x0000000000000005, 0x42253A126CE4000A));
+
+    CHECK(base_int128_eq(omw::uint128_t(0, 100) / omw::uint128_t(0, 7), 0, 14));
+    CHECK(base_int128_eq(omw::uint128_t(0, 100) % omw::uint128_t(0, 7), 0, 2));
+    CHECK(base_int128_eq(omw::uint128_t(0, 5) / omw::uint128_t(1, 0), 0, 0));
+    CHECK(base_int128_eq(omw::uint128_t(0, 5) % omw::uint128_t(1, 0), 0, 5));
+
+    omw::uint128_t r(0x0123456789ABCDEF, 0xFEDCBA9876543210);
+    r *= omw::uint128_t(0, 10);
+    r /= omw::uint128_t(0, 10);
+    CHECK(base_int128_eq(r, 0x0123456789ABCDEF, 0xFEDCBA9876543210));
+    r %= omw::uint128_t(0x0000000100000000, 0);
+    CHECK(base_int128_eq(r, 0x0000000089ABCDEF, 0xFEDCBA9876543210));
+    r /= r;
+    CHECK(base_int128_eq(r, 0, 1));
+
+    CHECK_THROWS_AS(omw::uint128_t(1) / omw::uint128_t(0), std::domain_error);
+    CHECK_THROWS_AS(omw::uint128_t(1) % omw::uint128_t(0), std::domain_error);
+    CHECK_THROWS_AS(r /= omw::uint128_t(0), std::domain_error);
+    CHECK_THROWS_AS(r %= omw::uint128_t(0), std::domain_error);
+}
+
+TEST_CASE("int.h signed multiplication and division operators")
+{
+    CHECK(base_int128_eq(omw::int128_t(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFF9) * omw::int128_t(0x0000000000000000, 0x0000000000000002), 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFF2));
+    CHECK(base_int128_eq(omw::int128_t(0x0000000000000000, 0x0000000000000007) * omw::int128_t(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFE), 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFF2));
+    CHECK(base_int128_eq(omw::int128_t(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFF9) * omw::int128_t(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFE), 0x0000000000000000, 0x000000000000000E));
+    CHECK(base_int128_eq(omw::int128_t(0xF87A11EF2A25B926, 0xFF0BC95FFFFFFF85) * omw::int128_t(0x0000000000000000, 0x0DE0B6B3A7640009), 0x094AA70E0957E170, 0x95F24C0E92F3FBAD));
+    CHECK(base_int128_eq(omw::int128_t(0xC000000000000000, 0x0000000000000000) * omw::int128_t(0xFFFFFFFFFFFFFFFE, 0xFFFFFFFFFFFFFFFB), 0x4000000000000000, 0x0000000000000000));
+    CHECK(base_int128_eq(omw::int128_t(0x0000000027E41B32, 0x46BEC9B16E398115) * omw::int128_t(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFC521974F), 0xF6D3A9B6C69C325A, 0x794FDA6EBB97387B));
+
+    CHECK(base_int128_eq(omw::int128_t(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFF9) / omw::int128_t(0x0000000000000000, 0x0000000000000002), 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFD));
+    CHECK(base_int128_eq(omw::int128_t(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFF9) % omw::int128_t(0x0000000000000000, 0x0000000000000002), 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF));
+    CHECK(base_int128_eq(omw::int128_t(0x0000000000000000, 0x0000000000000007) / omw::int128_t(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFE), 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFD));
+    CHECK(base_int128_eq(omw::int128_t(0x0000000000000000, 0x0000000000000007) % omw::int128_t(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFE), 0x0000000000000000, 0x0000000000000001));
+    CHECK(base_int128_eq(omw::int128_t(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFF9) / omw::int128_t(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFE), 0x0000000000000000, 0x0000000000000003));
+    CHECK(base_int128_eq(omw::int128_t(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFF9) % omw::int128_t(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFE), 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF));
+    CHECK(base_int128_eq(omw::int128_t(0xF87A11EF2A25B926, 0xFF0BC95FFFFFFF85) / omw::int128_t(0x0000000000000000, 0x0DE0B6B3A7640009), 0xFFFFFFFFFFFFFFFF, 0x7538DCFB7618005A));
+    CHECK(base_int128_eq(omw::int128_t(0xF87A11EF2A25B926, 0xFF0BC95FFFFFFF85) % omw::int128_t(0x0000000000000000, 0x0DE0B6B3A7640009), 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFC5B));
+    CHECK(base_int128_eq(omw::int128_t(0xC000000000000000, 0x0000000000000000) / omw::int128_t(0xFFFFFFFFFFFFFFFE, 0xFFFFFFFFFFFFFFFB), 0x0000000000000000, 0x3FFFFFFFFFFFFFFE));
+    CHECK(base_int128_eq(omw::int128_t(0xC000000000000000, 0x0000000000000000) % omw::int128_t(0xFFFFFFFFFFFFFFFE, 0xFFFFFFFFFFFFFFFB), 0xFFFFFFFFFFFFFFFF, 0x3FFFFFFFFFFFFFF6));
+    CHECK(base_int128_eq(omw::int128_t(0x0000000027E41B32, 0x46BEC9B16E398115) / omw::int128_t(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFC521974F), 0xFFFFFFFFFFFFFFFF, 0x528714548E73F49A));
+    CHECK(base_int128_eq(omw::int128_t(0x0000000027E41B32, 0x46BEC9B16E398115) % omw::int128_t(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFC521974F), 0x0000000000000000, 0x0000000009502F8F));
+
+    CHECK(base_int128_eq(omw::int128_t(-100) * 3, UINT64_MAX, (uint64_t)(-300)));
+    CHECK(base_int128_eq(OMW_INT128_MIN / omw::int128_t(-1), OMW_64BIT_MSB, 0)); // wraps
+    CHECK(base_int128_eq(OMW_INT128_MIN % omw::int128_t(-1), 0, 0));
+    CHECK(base_int128_eq(OMW_INT128_MIN / OMW_INT128_MIN, 0, 1));
+    CHECK(base_int128_eq(OMW_INT128_MAX / OMW_INT128_MIN, 0, 0));
+
+    omw::int128_t r(-1234567);
+    r *= omw::int128_t(-1000);
+    CHECK(r == omw::int128_t(1234567000));
+    r /= omw::int128_t(-7);
+    CHECK(r == omw::int128_t(-176366714));
+    r %= omw::int128_t(1000);
+    CHECK(r == omw::int128_t(-714));
+
+    CHECK_THROWS_AS(omw::int128_t(1) / omw::int128_t(0), std::domain_error);
+    CHECK_THROWS_AS(omw::int128_t(1) % omw::int128_t(0), std::domain_error);
+    CHECK_THROWS_AS(r /= omw::int128_t(0), std::domain_error);
+    CHECK_THROWS_AS(r %= omw::int128_t(0), std::domain_error);
+}
+
+TEST_CASE("int.h omw::divmod()")
+{
+    // consistency over the different divisor widths
+    tu::Rng64 rng;
+
+    for (int i = 0; i < 2000; ++i)
+    {
+        const omw::uint128_t a(rng(), rng());
+        omw::uint128_t b(rng(), rng());
+        if ((i % 4) == 0) b.set(0, b.lo());
+        if ((i % 4) == 1) b.set(0, b.lo() >> (i % 64));
+        if ((i % 4) == 2) b.set(b.hi() >> (i % 64), b.lo());
+        if (!b) b.set(0, 3);
+
+        const omw::DivModResult<omw::uint128_t> ur = omw::divmod(a, b);
+        REQUIRE(ur.rem < b);
+        REQUIRE((ur.quot * b + ur.rem) == a);
+        REQUIRE(ur.quot == (a / b));
+        REQUIRE(ur.rem == (a % b));
+
+        const omw::int128_t sa(a);
+        const omw::int128_t sb(b);
+        const omw::DivModResult<omw::int128_t> sr = omw::divmod(sa, sb);
+        REQUIRE((sr.quot * sb + sr.rem) == sa);
+        REQUIRE((sr.rem == omw::int128_t(0) || (sr.rem.isNegative() == sa.isNegative())));
+        REQUIRE(sr.quot == (sa / sb));
+        REQUIRE(sr.rem == (sa % sb));
+    }
+
+    const omw::DivModResult<omw::int128_t> r = omw::divmod(omw::int128_t(-7), omw::int128_t(2));
+    CHECK(r.quot == omw::int128_t(-3));
+    CHECK(r.rem == omw::int128_t(-1));
+
+    CHECK_THROWS_AS(omw::divmod(omw::int128_t(1), omw::int128_t(0)), std::domain_error);
+    CHECK_THROWS_AS(omw::divmod(omw::uint128_t(1), omw::uint128_t(0)), std::domain_error);
+}
+
+TEST_CASE("int.h omw::mul64x64() omw::div128by64()")
+{
+    CHECK(base_int128_eq(omw::mul64x64(0, 0), 0, 0));
+    CHECK(base_int128_eq(omw::mul64x64(UINT64_MAX, UINT64_MAX), 0xFFFFFFFFFFFFFFFE, 1));
+    CHECK(base_int128_eq(omw::mul64x64(0x0123456789ABCDEF, 0xFEDCBA9876543210), 0x0121FA00AD77D742, 0x2236D88FE5618CF0));
+    CHECK(base_int128_eq(omw::mul64x64(10000000000000000000ull, 10000000000000000000ull), 0x4B3B4CA85A86C47A, 0x098A224000000000));
+
+    uint64_t rem = 1;
+    CHECK(base_int128_eq(omw::div128by64(omw::uint128_t(0x4B3B4CA85A86C47A, 0x098A224000000000), 10000000000000000000ull, &rem), 0,
+                         10000000000000000000ull));
+    CHECK(rem == 0);
+    CHECK(base_int128_eq(omw::div128by64(omw::uint128_t(UINT64_MAX, UINT64_MAX), 10, &rem), 0x1999999999999999, 0x9999999999999999));
+    CHECK(rem == 5);
+    CHECK(base_int128_eq(omw::div128by64(omw::uint128_t(0, 12345), 100), 0, 123));
+    CHECK_THROWS_AS(omw::div128by64(omw::uint128_t(1), 0), std::domain_error);
+}
+
+TEST_CASE("int.h overflow checked arithmetic")
+{
+    omw::uint128_t u;
+    CHECK_FALSE(omw::addOverflow(omw::uint128_t(OMW_64BIT_MSB, 0), omw::uint128_t(~OMW_64BIT_MSB, OMW_64BIT_ALL), u));
+    CHECK(u == OMW_UINT128_MAX);
+    CHECK(omw::addOverflow(OMW_UINT128_MAX, omw::uint128_t(0, 2), u));
+    CHECK(base_int128_eq(u, 0, 1));
+    CHECK_FALSE(omw::subOverflow(omw::uint128_t(0, 5), omw::uint128_t(0, 5), u));
+    CHECK(omw::subOverflow(omw::uint128_t(0, 5), omw::uint128_t(0, 6), u));
+    CHECK(u == OMW_UINT128_MAX);
+    CHECK_FALSE(omw::mulOverflow(omw::uint128_t(0, UINT64_MAX), omw::uint128_t(0, UINT64_MAX), u));
+    CHECK_FALSE(omw::mulOverflow(omw::uint128_t(0x7FFFFFFFFFFFFFFF, UINT64_MAX), omw::uint128_t(0, 2), u));
+    CHECK(base_int128_eq(u, UINT64_MAX, 0xFFFFFFFFFFFFFFFE));
+    CHECK(omw::mulOverflow(omw::uint128_t(OMW_64BIT_MSB, 0), omw::uint128_t(0, 2), u));
+    CHECK(omw::mulOverflow(omw::uint128_t(1, 0), omw::uint128_t(1, 0), u));
+    CHECK(omw::mulOverflow(omw::uint128_t(0, 0x100000000), omw::uint128_t(0x100000000, 0), u));
+    CHECK(omw::mulOverflow(omw::uint128_t(0xFFFFFFFF, UINT64_MAX), omw::uint128_t(0, 0x1FFFFFFFF), u));
+    CHECK_FALSE(omw::mulOverflow(omw::uint128_t(0, 0), OMW_UINT128_MAX, u));
+
+    omw::int128_t s;
+    CHECK_FALSE(omw::addOverflow(OMW_INT128_MAX, omw::int128_t(-1), s));
+    CHECK(omw::addOverflow(OMW_INT128_MAX, omw::int128_t(1), s));
+    CHECK(s == OMW_INT128_MIN);
+    CHECK(omw::addOverflow(OMW_INT128_MIN, omw::int128_t(-1), s));
+    CHECK_FALSE(omw::subOverflow(OMW_INT128_MIN, omw::int128_t(-1), s));
+    CHECK(omw::subOverflow(OMW_INT128_MIN, omw::int128_t(1), s));
+    CHECK(s == OMW_INT128_MAX);
+    CHECK(omw::subOverflow(omw::int128_t(0), OMW_INT128_MIN, s));
+    CHECK_FALSE(omw::mulOverflow(omw::int128_t(-1), OMW_INT128_MAX, s));
+    CHECK(s == (OMW_INT128_MIN + omw::int128_t(1)));
+    CHECK(omw::mulOverflow(omw::int128_t(-1), OMW_INT128_MIN, s));
+    CHECK(s == OMW_INT128_MIN);
+    CHECK_FALSE(omw::mulOverflow(omw::int128_t(OMW_64BIT_MSB, 0) >> 1, omw::int128_t(2), s));
+    CHECK(s == OMW_INT128_MIN);
+    CHECK(omw::mulOverflow(omw::int128_t(0x4000000000000000, 0), omw::int128_t(2), s));
+    CHECK(omw::mulOverflow(omw::int128_t(0x4000000000000000, 0), omw::int128_t(-4), s));
+    CHECK(omw::mulOverflow(omw::int128_t(0, 0x100000000), omw::int128_t(0xFFFFFFFF00000000, 0), s));
+    CHECK_FALSE(omw::mulOverflow(omw::int128_t(-3037000499), omw::int128_t(3037000499), s));
+    CHECK(s == omw::int128_t(-9223372030926249001));
+    CHECK_FALSE(omw::divOverflow(OMW_INT128_MIN, omw::int128_t(1), s));
+    CHECK(s == OMW_INT128_MIN);
+    CHECK(omw::divOverflow(OMW_INT128_MIN, omw::int128_t(-1), s));
+    CHECK(s == OMW_INT128_MIN);
+    CHECK_THROWS_AS(omw::divOverflow(OMW_INT128_MIN, omw::int128_t(0), s), std::domain_error);
+}
+
+#if (OMW_CPPSTD >= OMW_CPPSTD_14)
+TEST_CASE("int.h omw::u128 omw::i128")
+{
+    static_assert(sizeof(omw::u128) == 16, "");
+    static_assert(sizeof(omw::i128) == 16, "");
+    static_assert(std::is_trivial<omw::u128>::value, "");
+    static_assert(std::is_trivially_copyable<omw::i128>::value, "");
+    static_assert(std::is_standard_layout<omw::u128>::value, "");
+    static_assert(std::is_standard_layout<omw::i128>::value, "");
+
+    constexpr omw::u128 a(0x0123456789ABCDEF, 0xFEDCBA9876543210);
+    static_assert((((a >> 8) * 1000) / 1000) == (a >> 8), "");
+    static_assert((((a >> 8) * 1000) % 1000) == 0, "");
+    static_assert((a >> 64) == 0x0123456789ABCDEF, "");
+    static_assert((a << 64) == omw::u128(0xFEDCBA9876543210, 0), "");
+    static_assert((omw::u128(UINT64_MAX) + 1) == omw::u128(1, 0), "");
+    static_assert(omw::u128(-1) == omw::u128::max(), "");
+    static_assert(omw::u128::min() == 0, "");
+    static_assert(omw::i128::min() == (omw::i128(1) << 127), "");
+    static_assert(omw::i128::max() == ~omw::i128::min(), "");
+    static_assert((omw::i128(-7) / 2) == -3, "");
+    static_assert((omw::i128(-7) % 2) == -1, "");
+    static_assert((omw::i128(-1) >> 100) == -1, "");
+    static_assert((omw::u128(-1) >> 100) == omw::u128(0, 0xFFFFFFF), "");
+    static_assert(omw::i128(-5) < omw::i128(3), "");
+    static_assert(omw::u128(3) < omw::u128(-5), "");
+    static_assert(omw::divmod(omw::u128(100), omw::u128(7)).quot == 14, "");
+    static_assert(omw::divmod(omw::u128(100), omw::u128(7)).rem == 2, "");
+    static_assert(static_cast<int>(omw::i128(-42)) == -42, "");
+    static_assert(omw::i128(omw::u128::max()) == -1, "");
+
+    omw::u128 b = 5;
+    CHECK(b++ == 5);
+    CHECK(++b == 7);
+    CHECK(b-- == 7);
+    CHECK(--b == 5);
+    CHECK(-b == omw::u128(UINT64_MAX, (uint64_t)(-5)));
+    CHECK_FALSE(!b);
+    CHECK_FALSE(omw::u128(0));
+
+    CHECK(omw::i128(omw::int128_t(-3)) == -3);
+    CHECK(omw::uint128_t(a) == omw::uint128_t(0x0123456789ABCDEF, 0xFEDCBA9876543210));
+
+    const omw::u128 arr[2] = { a, omw::u128(1, 2) };
+    uint64_t words[4];
+    std::memcpy(words, arr, sizeof(arr));
+#ifdef OMW_BYTE_ORDER_LITTLE
+    CHECK(words[0] == 0xFEDCBA9876543210);
+    CHECK(words[1] == 0x0123456789ABCDEF);
+    CHECK(words[2] == 2);
+    CHECK(words[3] == 1);
+#else
+    CHECK(words[0] == 0x0123456789ABCDEF);
+    CHECK(words[1] == 0xFEDCBA9876543210);
+    CHECK(words[2] == 1);
+    CHECK(words[3] == 2);
+#endif
+
+    CHECK_THROWS_AS(a / omw::u128(0), std::domain_error);
+    CHECK_THROWS_AS(omw::i128(1) % 0, std::domain_error);
+    CHECK_THROWS_AS(omw::divmod(a, omw::u128(0)), std::domain_error);
+
+    // same results as omw::int128_t and omw::uint128_t
+    tu::Rng64 rng;
+
+    for (unsigned int i = 0; i < 1000; ++i)
+    {
+        const omw::u128 ua(rng(), rng());
+        const omw::u128 ub(((i % 2) ? rng() : 0), rng() | 1);
+        const omw::i128 sa(ua);
+        const omw::i128 sb(ub);
+        const omw::uint128_t oua(ua.hi(), ua.lo());
+        const omw::uint128_t oub(ub.hi(), ub.lo());
+        const omw::int128_t osa(oua);
+        const omw::int128_t osb(oub);
+        const unsigned int n = i % 130;
+
+        REQUIRE(omw::uint128_t(ua + ub) == (oua + oub));
+        REQUIRE(omw::uint128_t(ua - ub) == (oua - oub));
+        REQUIRE(omw::uint128_t(ua * ub) == (oua * oub));
+        REQUIRE(omw::uint128_t(ua / ub) == (oua / oub));
+        REQUIRE(omw::uint128_t(ua % ub) == (oua % oub));
+        REQUIRE(omw::uint128_t(ua << n) == (oua << n));
+        REQUIRE(omw::uint128_t(ua >> n) == (oua >> n));
+        REQUIRE((ua < ub) == (oua < oub));
+
+        REQUIRE(omw::int128_t(sa * sb) == (osa * osb));
+        REQUIRE(omw::int128_t(sa / sb) == (osa / osb));
+        REQUIRE(omw::int128_t(sa % sb) == (osa % osb));
+        REQUIRE(omw::int128_t(sa >> n) == (osa >> n));
+        REQUIRE((sa < sb) == (osa < osb));
+    }
+}
+
+TEST_CASE("int.h omw::bulk")
+{
+    tu::Rng64 rng;
+
+    constexpr size_t maxN = 37;
+    omw::u128 ua[maxN], ub[maxN], ur[maxN];
+    omw::i128 sa[maxN], sb[maxN], sr[maxN];
+    int8_t cmp[maxN];
+
+    for (size_t n = 1; n <= maxN; ++n)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            // some equal values and values around the sign boundary
+            ua[i] = omw::u128(rng(), rng());
+            ub[i] = ((i % 5) == 0) ? ua[i] : omw::u128(((i % 3) == 0) ? ua[i].hi() : rng(), rng());
+            if ((i % 7) == 3) ub[i] = omw::u128(OMW_64BIT_MSB, 0);
+            sa[i] = omw::i128(ua[i]);
+            sb[i] = omw::i128(ub[i]);
+        }
+
+        omw::bulk::add(ur, ua, ub, n);
+        omw::bulk::add(sr, sa, sb, n);
+        for (size_t i = 0; i < n; ++i)
+        {
+            REQUIRE(ur[i] == (ua[i] + ub[i]));
+            REQUIRE(sr[i] == (sa[i] + sb[i]));
+        }
+
+        omw::bulk::sub(ur, ua, ub, n);
+        omw::bulk::sub(sr, sa, sb, n);
+        for (size_t i = 0; i < n; ++i)
+        {
+            REQUIRE(ur[i] == (ua[i] - ub[i]));
+            REQUIRE(sr[i] == (sa[i] - sb[i]));
+        }
+
+        omw::bulk::compare(cmp, ua, ub, n);
+        for (size_t i = 0; i < n; ++i) REQUIRE(cmp[i] == ((ua[i] < ub[i]) ? -1 : ((ua[i] > ub[i]) ? 1 : 0)));
+        omw::bulk::compare(cmp, sa, sb, n);
+        for (size_t i = 0; i < n; ++i) REQUIRE(cmp[i] == ((sa[i] < sb[i]) ? -1 : ((sa[i] > sb[i]) ? 1 : 0)));
+
+        omw::u128 umin = ua[0], umax = ua[0], usum = 0;
+        omw::i128 smin = sa[0], smax = sa[0], ssum = 0;
+        for (size_t i = 0; i < n; ++i)
+        {
+            if (ua[i] < umin) umin = ua[i];
+            if (ua[i] > umax) umax = ua[i];
+            if (sa[i] < smin) smin = sa[i];
+            if (sa[i] > smax) smax = sa[i];
+            usum += ua[i];
+            ssum += sa[i];
+        }
+        REQUIRE(omw::bulk::min(ua, n) == umin);
+        REQUIRE(omw::bulk::max(ua, n) == umax);
+        REQUIRE(omw::bulk::min(sa, n) == smin);
+        REQUIRE(omw::bulk::max(sa, n) == smax);
+        REQUIRE(omw::bulk::sum(ua, n) == usum);
+        REQUIRE(omw::bulk::sum(sa, n) == ssum);
+
+        omw::bulk::prefixSum(ur, ua, n);
+        REQUIRE(ur[n - 1] == usum);
+        for (size_t i = 1; i < n; ++i) REQUIRE(ur[i] == (ur[i - 1] + ua[i]));
+
+        // in place
+        omw::bulk::prefixSum(sa, sa, n);
+        REQUIRE(sa[n - 1] == ssum);
+        omw::bulk::add(ub, ua, ub, n);
+        omw::bulk::sub(ub, ub, ua, n);
+        for (size_t i = 0; i < n; ++i) REQUIRE(ub[i] == omw::u128(sb[i]));
+    }
+
+    const omw::u128 u[] = { 5, 0, omw::u128::max(), 7 };
+    const omw::i128 s[] = { 5, 0, -1, omw::i128::min(), omw::i128::max() };
+    CHECK(omw::bulk::min(u, 4) == 0);
+    CHECK(omw::bulk::max(u, 4) == omw::u128::max());
+    CHECK(omw::bulk::min(s, 5) == omw::i128::min());
+    CHECK(omw::bulk::max(s, 5) == omw::i128::max());
+    CHECK(omw::bulk::sum(u, 4) == 11);
+    CHECK(omw::bulk::sum(s, 5) == 3);
+    CHECK(omw::bulk::sum(s, 0) == 0);
+
+    omw::bulk::add(ur, nullptr, nullptr, 0);
+    omw::bulk::prefixSum(sr, nullptr, 0);
+    CHECK_THROWS_AS(omw::bulk::add(ur, ua, nullptr, 1), std::invalid_argument);
+    CHECK_THROWS_AS(omw::bulk::compare(nullptr, sa, sb, 1), std::invalid_argument);
+    CHECK_THROWS_AS(omw::bulk::sum(static_cast<const omw::u128*>(nullptr), 1), std::invalid_argument);
+    CHECK_THROWS_AS(omw::bulk::min(u, 0), std::invalid_argument);
+    CHECK_THROWS_AS(omw::bulk::max(static_cast<const omw::i128*>(nullptr), 3), std::invalid_argument);
+}
+#endif
+
+namespace {
+
+template <typename T> unsigned int refPopCount(T value)
+{
+    unsigned int r = 0;
+    for (size_t i = 0; i < (sizeof(T) * 8); ++i) r += ((value >> i) & 1);
+    return r;
+}
+
+template <typename T> unsigned int refCountLeadingZeros(T value)
+{
+    unsigned int r = 0;
+    for (size_t i = (sizeof(T) * 8); (i > 0) && (((value >> (i - 1)) & 1) == 0); --i) ++r;
+    return r;
+}
+
+template <typename T> unsigned int refCountTrailingZeros(T value)
+{
+    unsigned int r = 0;
+    for (size_t i = 0; (i < (sizeof(T) * 8)) && (((value >> i) & 1) == 0); ++i) ++r;
+    return r;
+}
+
+template <typename T> T refRotateLeft(T value, unsigned int n)
+{
+    for (unsigned int i = 0; i < n; ++i) value = static_cast<T>((value << 1) | (value >> (sizeof(T) * 8 - 1)));
+    return value;
+}
+
+template <typename T> T refByteSwap(T value)
+{
+    T r = 0;
+    for (size_t i = 0; i < sizeof(T); ++i) r = static_cast<T>((r << 4) << 4) | static_cast<T>((value >> (i * 8)) & 0xFF);
+    return r;
+}
+
+template <typename T> void checkBitOps(T value)
+{
+    REQUIRE(omw::popCount(value) == refPopCount(value));
+    REQUIRE(omw::countLeadingZeros(value) == refCountLeadingZeros(value));
+    REQUIRE(omw::countTrailingZeros(value) == refCountTrailingZeros(value));
+    REQUIRE(omw::byteSwap(value) == refByteSwap(value));
+    for (unsigned int n = 0; n < (sizeof(T) * 8 + 3); n += 5)
+    {
+        REQUIRE(omw::rotateLeft(value, n) == refRotateLeft(value, n));
+        REQUIRE(omw::rotateRight(omw::rotateLeft(value, n), n) == value);
+    }
+}
+
+} // namespace
+
+TEST_CASE("int.h bit manipulation")
+{
+    static_assert(omw::popCount(uint8_t(0xFF)) == 8, "");
+    static_assert(omw::popCount(0xF0F0F0F0F0F0F0F1ull) == 33, "");
+    static_assert(omw::countLeadingZeros(uint8_t(1)) == 7, "");
+    static_assert(omw::countLeadingZeros(uint16_t(0)) == 16, "");
+    static_assert(omw::countLeadingZeros(0x00F0000000000000ull) == 8, "");
+    static_assert(omw::countTrailingZeros(UINT32_C(0)) == 32, "");
+    static_assert(omw::countTrailingZeros(UINT32_C(0x80000000)) == 31, "");
+    static_assert(omw::rotateLeft(uint8_t(0x81), 1) == 0x03, "");
+    static_assert(omw::rotateRight(uint16_t(0x0001), 1) == 0x8000, "");
+    static_assert(omw::rotateLeft(UINT64_C(0x8000000000000001), 68) == 0x18, "");
+    static_assert(omw::byteSwap(uint16_t(0x1234)) == 0x3412, "");
+    static_assert(omw::byteSwap(UINT32_C(0x12345678)) == 0x78563412, "");
+    static_assert(omw::byteSwap(UINT64_C(0x0123456789ABCDEF)) == 0xEFCDAB8967452301, "");
+    static_assert(omw::byteSwap(uint8_t(0xA5)) == 0xA5, "");
+
+    for (unsigned int i = 0; i <= 0xFF; ++i) checkBitOps(static_cast<uint8_t>(i));
+
+    tu::Rng64 rng;
+
+    for (int i = 0; i < 500; ++i)
+    {
+        // sparse values to test the leading and trailing zeros
+        const uint64_t v = rng() >> (i % 64) << ((i / 7) % 64);
+        checkBitOps(static_cast<uint16_t>(v));
+        checkBitOps(static_cast<uint32_t>(v));
+        checkBitOps(v);
+    }
+
+    CHECK(omw::bitExtract(UINT32_C(0xABCD), UINT32_C(0x0FF0)) == 0xBC);
+    CHECK(omw::bitDeposit(UINT32_C(0xBC), UINT32_C(0x0FF0)) == 0x0BC0);
+    CHECK(omw::bitExtract(UINT64_C(0x8000000000000001), UINT64_C(0x8000000000000001)) == 3);
+    CHECK(omw::bitDeposit(UINT64_C(3), UINT64_C(0x8000000000000001)) == 0x8000000000000001);
+    CHECK(omw::bitExtract(UINT64_MAX, UINT64_C(0)) == 0);
+    CHECK(omw::bitDeposit(UINT64_MAX, UINT64_MAX) == UINT64_MAX);
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        const uint64_t value = rng();
+        const uint64_t mask = rng() & rng();
+
+        uint64_t ext = 0;
+        uint64_t dep = 0;
+        unsigned int k = 0;
+        for (unsigned int b = 0; b < 64; ++b)
+        {
+            if ((mask >> b) & 1)
+            {
+                ext |= ((value >> b) & 1) << k;
+                dep |= ((value >> k) & 1) << b;
+                ++k;
+            }
+        }
+
+        REQUIRE(omw::bitExtract(value, mask) == ext);
+        REQUIRE(omw::bitDeposit(value, mask) == dep);
+        REQUIRE(omw::bitDeposit(omw::bitExtract(value, mask), mask) == (value & mask));
+        REQUIRE(omw::bitExtract(static_cast<uint32_t>(value), static_cast<uint32_t>(mask)) == static_cast<uint32_t>(omw::bitExtract(value, mask & 0xFFFFFFFF)));
+        REQUIRE(omw::bitDeposit(static_cast<uint32_t>(value), static_cast<uint32_t>(mask)) == static_cast<uint32_t>(omw::bitDeposit(value, mask & 0xFFFFFFFF)));
+    }
+
+    const omw::uint128_t a(0x00F0000000000001, 0x8000000000000000);
+    CHECK(omw::popCount(a) == 6);
+    CHECK(omw::countLeadingZeros(a) == 8);
+    CHECK(omw::countTrailingZeros(a) == 63);
+    CHECK(omw::countLeadingZeros(omw::uint128_t(0, 1)) == 127);
+    CHECK(omw::countLeadingZeros(omw::uint128_t(0)) == 128);
+    CHECK(omw::countTrailingZeros(omw::uint128_t(0)) == 128);
+    CHECK(omw::countTrailingZeros(omw::uint128_t(1, 0)) == 64);
+    CHECK(omw::rotateLeft(a, 8) == omw::uint128_t(0xF000000000000180, 0x0000000000000000));
+    CHECK(omw::rotateRight(a, 0) == a);
+    CHECK(omw::rotateRight(a, 1) == omw::uint128_t(0x0078000000000000, 0xC000000000000000));
+    CHECK(omw::rotateLeft(a, 128 + 64) == omw::uint128_t(0x8000000000000000, 0x00F0000000000001));
+    CHECK(omw::byteSwap(a) == omw::uint128_t(0x0000000000000080, 0x010000000000F000));
+
+#if (OMW_CPPSTD >= OMW_CPPSTD_14)
+    constexpr omw::u128 b(0x00F0000000000001, 0x8000000000000000);
+    static_assert(omw::popCount(b) == 6, "");
+    static_assert(omw::countLeadingZeros(b) == 8, "");
+    static_assert(omw::countTrailingZeros(b) == 63, "");
+    static_assert(omw::countLeadingZeros(omw::u128(0)) == 128, "");
+    static_assert(omw::rotateLeft(b, 8) == omw::u128(0xF000000000000180, 0), "");
+    static_assert(omw::rotateRight(b, 1) == omw::u128(0x0078000000000000, 0xC000000000000000), "");
+    static_assert(omw::byteSwap(b) == omw::u128(0x0000000000000080, 0x010000000000F000), "");
+
+    for (int i = 0; i < 200; ++i)
+    {
+        const omw::u128 v(rng() >> (i % 64), rng() << (i % 61));
+        const omw::uint128_t ov(v.hi(), v.lo());
+        const unsigned int n = static_cast<unsigned int>(rng() % 300);
+        REQUIRE(omw::popCount(v) == omw::popCount(ov));
+        REQUIRE(omw::countLeadingZeros(v) == omw::countLeadingZeros(ov));
+        REQUIRE(omw::countTrailingZeros(v) == omw::countTrailingZeros(ov));
+        REQUIRE(omw::uint128_t(omw::rotateLeft(v, n)) == omw::rotateLeft(ov, n));
+        REQUIRE(omw::uint128_t(omw::rotateRight(v, n)) == omw::rotateRight(ov, n));
+        REQUIRE(omw::rotateRight(omw::rotateLeft(v, n), n) == v);
+        REQUIRE(omw::byteSwap(omw::byteSwap(v)) == v);
+    }
+#endif
+}
+
+#ifdef CATCH_CONFIG_ENABLE_BENCHMARKING
+TEST_CASE("int.h omw::Base_Int128 benchmark", "[.][benchmark]")
+{
+    constexpr size_t n = 1024 * 1024;
+    std::vector<omw::UnsignedInt128> values(n);
+    std::vector<omw::SignedInt128> svalues(n);
+    tu::Rng64 rng(12345);
+    for (size_t i = 0; i < n; ++i)
+    {
+        const uint64_t x = rng();
+        values[i] = omw::UnsignedInt128(x ^ (x << 13), x);
+        svalues[i] = omw::SignedInt128(x, x >> 7);
+    }
+
+    BENCHMARK("add/sub 1Mi")
+    {
+        omw::UnsignedInt128 r = 0;
+        for (size_t i = 0; i < n; ++i) r = r + values[i] - (values[i] >> 3);
+        return r;
+    };
+
+    BENCHMARK("shift 1Mi")
+    {
+        omw::UnsignedInt128 r = 0;
+        for (size_t i = 0; i < n; ++i) r ^= (values[i] << (i % 128)) ^ (svalues[i] >> (i % 128));
+        return r;
+    };
+
+    BENCHMARK("multiply 1Mi")
+    {
+        omw::UnsignedInt128 r = 1;
+        for (size_t i = 0; i < n; ++i) r ^= values[i] * svalues[i];
+        return r;
+    };
+
+    BENCHMARK("divide by 64-bit 1Mi")
+    {
+        omw::UnsignedInt128 r = 0;
+        for (size_t i = 0; i < n; ++i) r ^= values[i] / omw::UnsignedInt128(0, svalues[i].lo() | 1);
+        return r;
+    };
+
+    BENCHMARK("divide by 128-bit 1Mi")
+    {
+        omw::UnsignedInt128 r = 0;
+        for (size_t i = 0; i < n; ++i) r ^= values[i] / omw::UnsignedInt128(svalues[i].hi() >> 8 | 1, svalues[i].lo());
+        return r;
+    };
+
+    BENCHMARK("signed divmod 1Mi")
+    {
+        omw::SignedInt128 r = 0;
+        for (size_t i = 0; i < n; ++i)
+        {
+            const omw::DivModResult<omw::int128_t> qr = omw::divmod(omw::SignedInt128(values[i]), svalues[i] >> 70);
+            r ^= qr.quot ^ qr.rem;
+        }
+        return r;
+    };
+
+    BENCHMARK("compare 1Mi")
+    {
+        size_t r = 0;
+        for (size_t i = 1; i < n; ++i) r += ((svalues[i - 1] < svalues[i]) ? 1 : 0) + ((values[i - 1] <= values[i]) ? 1 : 0);
+        return r;
+    };
+}
+
+TEST_CASE("int.h bit manipulation benchmark", "[.][benchmark]")
+{
+    constexpr size_t n = 1024 * 1024;
+    std::vector<uint64_t> values(n);
+    tu::Rng64 rng(12345);
+    for (size_t i = 0; i < n; ++i) values[i] = rng();
+
+    BENCHMARK("omw::popCount() 1Mi")
+    {
+        unsigned int r = 0;
+        for (size_t i = 0; i < n; ++i) r += omw::popCount(values[i]);
+        return r;
+    };
+
+    BENCHMARK("omw::countLeadingZeros() omw::countTrailingZeros() 1Mi")
+    {
+        unsigned int r = 0;
+        for (size_t i = 0; i < n; ++i) r += omw::countLeadingZeros(values[i] >> (i % 64)) + omw::countTrailingZeros(values[i] << (i % 64));
+        return r;
+    };
+
+    BENCHMARK("omw::bitExtract() 1Mi")
+    {
+        uint64_t r = 0;
+        for (size_t i = 1; i < n; ++i) r ^= omw::bitExtract(values[i], values[i - 1]);
+        return r;
+    };
+
+    BENCHMARK("omw::bitDeposit() 1Mi")
+    {
+        uint64_t r = 0;
+        for (size_t i = 1; i < n; ++i) r ^= omw::bitDeposit(values[i], values[i - 1]);
+        return r;
+    };
+}
+
+#if (OMW_CPPSTD >= OMW_CPPSTD_14)
+TEST_CASE("int.h omw::bulk benchmark", "[.][benchmark]")
+{
+    constexpr size_t n = 1024 * 1024;
+    std::vector<omw::UnsignedInt128> values(n);
+    std::vector<omw::UnsignedInt128> results(n);
+    std::vector<omw::u128> a(n), b(n), r(n);
+    std::vector<int8_t> cmp(n);
+    tu::Rng64 rng(12345);
+    for (size_t i = 0; i < n; ++i)
+    {
+        const uint64_t x = rng();
+        values[i] = omw::UnsignedInt128(x ^ (x << 13), x);
+        a[i] = omw::u128(x ^ (x << 13), x);
+        b[i] = omw::u128(x >> 3, x * 7);
+    }
+
+    BENCHMARK("omw::UnsignedInt128 loop sum 1Mi")
+    {
+        omw::UnsignedInt128 s = 0;
+        for (size_t i = 0; i < n; ++i) s += values[i];
+        return s;
+    };
+
+    BENCHMARK("omw::bulk::sum 1Mi") { return omw::bulk::sum(a.data(), n); };
+
+    BENCHMARK("omw::UnsignedInt128 loop add 1Mi")
+    {
+        for (size_t i = 0; i < n; ++i) results[i] = values[i] + values[n - 1 - i];
+        return results[n / 2].lo();
+    };
+
+    BENCHMARK("omw::bulk::add 1Mi")
+    {
+        omw::bulk::add(r.data(), a.data(), b.data(), n);
+        return r[n / 2].lo();
+    };
+
+    BENCHMARK("omw::bulk::compare 1Mi")
+    {
+        omw::bulk::compare(cmp.data(), a.data(), b.data(), n);
+        return cmp[n / 2];
+    };
+
+    BENCHMARK("omw::UnsignedInt128 loop max 1Mi")
+    {
+        omw::UnsignedInt128 m = values[0];
+        for (size_t i = 1; i < n; ++i)
+        {
+            if (m < values[i]) m = values[i];
+        }
+        return m;
+    };
+
+    BENCHMARK("omw::bulk::max 1Mi") { return omw::bulk::max(a.data(), n); };
+
+    BENCHMARK("omw::bulk::prefixSum 1Mi")
+    {
+        omw::bulk::prefixSum(r.data(), a.data(), n);
+        return r[n - 1].lo();
+    };
+}
+#endif
+#endif // CATCH_CONFIG_ENABLE_BENCHMARKING
@@ -338,6 +338,312 @@ TEST_CASE("string.h omw::replaceAll()")
     CHECK(nrv == std::vector<size_t>({ std::string::npos, std::string::npos, std::string::npos }));
 }
 
+TEST_CASE("string.h omw::replaceAll() string by string")
+{
+    // the former implementation, replacing one occurrence after the other
+    const auto reference = [](std::string& str, const std::string& search, const std::string& replace, std::string::size_type startPos) {
+        size_t cnt = 0;
+        std::string::size_type pos = str.find(search, startPos);
+        while ((pos < str.length()) && (pos != std::string::npos))
+        {
+            str.replace(pos, search.length(), replace);
+            ++cnt;
+            pos = str.find(search, pos + replace.length());
+        }
+        return cnt;
+    };
+
+    uint32_t x = 7;
+    const auto rnd = [&x](uint32_t max) {
+        x = x * 1103515245u + 12345u;
+        return ((x >> 16) % max);
+    };
+    const auto rndStr = [&rnd](size_t len) {
+        std::string r;
+        for (size_t i = 0; i < len; ++i) r += static_cast<char>('a' + rnd(2));
+        return r;
+    };
+
+    for (size_t t = 0; t < 2000; ++t)
+    {
+        const std::string search = rndStr(1 + rnd(5));
+        const std::string replace = rndStr(rnd(8));
+        const std::string str = rndStr(rnd(120));
+        const size_t startPos = rnd(10);
+        size_t nReplacements;
+
+        std::string expected = str;
+        const size_t expectedCnt = reference(expected, search, replace, startPos);
+
+        std::string s = str;
+        omw::replaceAll(s, search, replace, startPos, &nReplacements);
+        CHECK(s == expected);
+        CHECK(nReplacements == expectedCnt);
+    }
+
+    std::string s = "aaaaa";
+    size_t nReplacements;
+    omw::replaceAll(s, "aa", "b", 0, &nReplacements);
+    CHECK(s == "bba");
+    CHECK(nReplacements == 2);
+
+    s = std::string(100, 'x') + "needle" + std::string(100, 'x') + "needle";
+    omw::replaceAll(s, "needle", "pin", 0, &nReplacements);
+    CHECK(s == std::string(100, 'x') + "pin" + std::string(100, 'x') + "pin");
+    CHECK(nReplacements == 2);
+
+    s = "abc";
+    omw::replaceAll(s, s, "x" + s, 0, &nReplacements);
+    CHECK(s == "xabc");
+    CHECK(nReplacements == 1);
+
+    s = "abc";
+    omw::replaceAll(s, "b", s, 0, &nReplacements);
+    CHECK(s == "aabcc");
+    CHECK(nReplacements == 1);
+}
+
+namespace {
+
+// leftmost-longest reference of omw::MultiReplacer
+std::string multiReplaceRef(const std::string& str, const std::vector<omw::StringReplacePair>& pairs, size_t startPos, std::vector<size_t>& cnt)
+{
+    std::string r = str.substr(0, startPos);
+    cnt.assign(pairs.size(), 0);
+
+    for (size_t pos = startPos; pos < str.size();)
+    {
+        size_t best = pairs.size();
+        for (size_t k = 0; k < pairs.size(); ++k)
+        {
+            const std::string& search = pairs[k].search();
+            if (!search.empty() && (str.compare(pos, search.size(), search) == 0) &&
+                ((best == pairs.size()) || (search.size() > pairs[best].search().size())))
+            {
+                best = k;
+            }
+        }
+
+        if (best < pairs.size())
+        {
+            r += pairs[best].replace();
+            pos += pairs[best].search().size();
+            ++cnt[best];
+        }
+        else { r += str[pos++]; }
+    }
+
+    for (size_t k = 0; k < pairs.size(); ++k)
+    {
+        if (pairs[k].search().empty()) cnt[k] = OMW_SIZE_MAX;
+    }
+
+    return r;
+}
+
+} // namespace
+
+TEST_CASE("string.h omw::MultiReplacer")
+{
+    std::string s;
+    size_t nReplacements;
+    std::vector<size_t> nrv;
+
+    const omw::MultiReplacer ushers({ { "he", "X" }, { "she", "Y" }, { "hers", "Z" } });
+    s = "ushers";
+    ushers.replaceAll(s, 0, &nReplacements, &nrv);
+    CHECK(s == "uYrs");
+    CHECK(nReplacements == 1);
+    CHECK(nrv == std::vector<size_t>({ 0, 1, 0 }));
+
+    s = "ushers";
+    omw::replaceAll(s, ushers, 2);
+    CHECK(s == "usZ");
+
+    // the leftmost match wins even if it ends later
+    const omw::StringReplacePair leftmost[] = { { "bcd", "1" }, { "abcde", "2" } };
+    s = "xabcdex";
+    omw::MultiReplacer(leftmost, 2).replaceAll(s);
+    CHECK(s == "x2x");
+
+    // simultaneous, replaced text is not searched again
+    const omw::MultiReplacer swap({ { 'a', 'b' }, { 'b', 'a' } });
+    s = "aabba";
+    swap.replaceAll(s);
+    CHECK(s == "bbaab");
+
+    // first of equal search strings, empty search strings are ignored
+    const omw::MultiReplacer dup({ { "", "#" }, { "ab", "1" }, { "ab", "2" } });
+    s = "abab";
+    dup.replaceAll(s, 0, &nReplacements, &nrv);
+    CHECK(s == "11");
+    CHECK(nReplacements == 2);
+    CHECK(nrv == std::vector<size_t>({ std::string::npos, 2, 0 }));
+
+    const omw::MultiReplacer empty;
+    s = "abc";
+    empty.replaceAll(s, 0, &nReplacements, &nrv);
+    CHECK(s == "abc");
+    CHECK(nReplacements == std::string::npos);
+    CHECK(nrv.empty());
+
+    s = "\xC3\x84pfel \xC3\xBC";
+    omw::MultiReplacer({ { omw::UTF8CP_Auml, omw::UTF8CP_auml }, { omw::UTF8CP_uuml, omw::UTF8CP_Uuml } }).replaceAll(s);
+    CHECK(s == "\xC3\xA4pfel \xC3\x9C");
+
+    TESTUTIL_TRYCATCH_OPEN_DECLARE_VAL(size_t, 123);
+    TESTUTIL_TRYCATCH_CHECK(omw::MultiReplacer(nullptr, 1).pairs().size(), std::invalid_argument);
+    TESTUTIL_TRYCATCH_CLOSE();
+
+    // random pairs over a small alphabet, against the reference
+    uint32_t x = 42;
+    const auto rnd = [&x](uint32_t max) {
+        x = x * 1103515245u + 12345u;
+        return ((x >> 16) % max);
+    };
+    const auto rndStr = [&rnd](size_t len) {
+        std::string r;
+        for (size_t i = 0; i < len; ++i) r += static_cast<char>('a' + rnd(3));
+        return r;
+    };
+
+    for (size_t t = 0; t < 300; ++t)
+    {
+        std::vector<omw::StringReplacePair> pairs;
+        const size_t nPairs = 1 + rnd(6);
+        for (size_t k = 0; k < nPairs; ++k) pairs.push_back(omw::StringReplacePair(rndStr(rnd(5)), rndStr(rnd(3)) + "_"));
+
+        const omw::MultiReplacer replacer(pairs);
+
+        for (size_t u = 0; u < 5; ++u)
+        {
+            const std::string str = rndStr(rnd(60));
+            const size_t startPos = rnd(8);
+            std::vector<size_t> expectedCnt;
+            const std::string expected = multiReplaceRef(str, pairs, startPos, expectedCnt);
+
+            s = str;
+            replacer.replaceAll(s, startPos, nullptr, &nrv);
+            CHECK(s == expected);
+            CHECK(nrv == expectedCnt);
+        }
+    }
+}
+
+TEST_CASE("string.h omw::Searcher")
+{
+    CHECK(omw::Searcher("abc").algorithm() == omw::Searcher::ALGO_SIMD);
+    CHECK(omw::Searcher(std::string(33, 'a')).algorithm() == omw::Searcher::ALGO_BMH);
+    CHECK(omw::Searcher(std::string(257, 'a')).algorithm() == omw::Searcher::ALGO_TWOWAY);
+    CHECK(omw::Searcher("abc", omw::Searcher::ALGO_TWOWAY).algorithm() == omw::Searcher::ALGO_TWOWAY);
+
+    const omw::Searcher empty;
+    CHECK(empty.empty());
+    CHECK(empty.find("abc") == 0);
+    CHECK(empty.find("abc", 3) == 3);
+    CHECK(empty.find("abc", 4) == std::string::npos);
+
+    const omw::Searcher::ALGO algos[] = { omw::Searcher::ALGO_AUTO, omw::Searcher::ALGO_SIMD, omw::Searcher::ALGO_BMH, omw::Searcher::ALGO_TWOWAY };
+
+    // small alphabets to get many partial matches and periodic needles
+    uint32_t x = 99;
+    const auto rnd = [&x](uint32_t max) {
+        x = x * 1103515245u + 12345u;
+        return ((x >> 16) % max);
+    };
+    const auto rndStr = [&rnd](size_t len, uint32_t alphabet) {
+        std::string r;
+        for (size_t i = 0; i < len; ++i) r += static_cast<char>('a' + rnd(alphabet));
+        return r;
+    };
+
+    for (size_t t = 0; t < 1500; ++t)
+    {
+        const uint32_t alphabet = 2 + rnd(3);
+        const size_t m = ((t % 10) == 0 ? (250 + rnd(20)) : (1 + rnd(40)));
+        const std::string needle = rndStr(m, alphabet);
+
+        // embed the needle to get some hits
+        std::string str = rndStr(rnd(400), alphabet);
+        if (rnd(2)) str.insert(rnd(static_cast<uint32_t>(str.size() + 1)), needle);
+
+        const size_t pos = rnd(20);
+
+        for (const auto algo : algos)
+        {
+            const omw::Searcher searcher(needle, algo);
+            CHECK(searcher.find(str, pos) == str.find(needle, pos));
+        }
+    }
+
+    // periodic needles
+    for (const std::string needle : { "aaaa", "abab", "abaaba", "aabaabaab", "abcabcabcab" })
+    {
+        const std::string str = std::string("abaabaabaaabababababcabcabcabcabcaaaaa") + needle;
+        for (const auto algo : algos)
+        {
+            const omw::Searcher searcher(needle, algo);
+            for (size_t pos = 0; pos <= str.size(); ++pos) { CHECK(searcher.find(str, pos) == str.find(needle, pos)); }
+        }
+    }
+
+    const char data[] = "abc";
+    using cstr_t = const char*;
+    TESTUTIL_TRYCATCH_OPEN_DECLARE_VAL(cstr_t, data);
+    TESTUTIL_TRYCATCH_CHECK(omw::Searcher("b").find(nullptr, data), std::invalid_argument);
+    TESTUTIL_TRYCATCH_CHECK(omw::Searcher("b").find(data + 1, data), std::invalid_argument);
+    TESTUTIL_TRYCATCH_CLOSE();
+
+    TESTUTIL_TRYCATCH_OPEN_DECLARE_VAL(size_t, 123);
+    TESTUTIL_TRYCATCH_CHECK(omw::Searcher(nullptr, 1).size(), std::invalid_argument);
+    TESTUTIL_TRYCATCH_CLOSE();
+}
+
+TEST_CASE("string.h omw::Searcher overloads")
+{
+    const std::string str = "The, quick, brown, fox, jumps, over, the, lazy, dog";
+    std::string s;
+    size_t nReplacements;
+    size_t nExpected;
+
+    CHECK(omw::contains(str, omw::Searcher("fox")));
+    CHECK_FALSE(omw::contains(str, omw::Searcher("cat")));
+    CHECK(omw::contains(str, omw::Searcher()));
+
+    for (const std::string search : { "", ", ", "o", "the", "dog", "The", "xyz" })
+    {
+        const omw::Searcher searcher(search);
+
+        for (const size_t startPos : { 0, 5, 60 })
+        {
+            s = str;
+            std::string expected = str;
+            omw::replaceFirst(s, searcher, "#", startPos);
+            omw::replaceFirst(expected, search, "#", startPos);
+            CHECK(s == expected);
+
+            s = str;
+            expected = str;
+            omw::replaceAll(s, searcher, "<>", startPos, &nReplacements);
+            omw::replaceAll(expected, search, "<>", startPos, &nExpected);
+            CHECK(s == expected);
+            CHECK(nReplacements == nExpected);
+        }
+
+        if (!search.empty())
+        {
+            for (const size_t max : { omw::StringVector_npos, size_t(0), size_t(1), size_t(3) }) { CHECK(omw::split(str, searcher, max) == omw::split(str, search, max)); }
+        }
+    }
+
+    CHECK(omw::split(str, omw::Searcher()) == omw::StringVector{ str });
+
+    s = "abc";
+    omw::replaceAll(s, omw::Searcher("b"), s, 0, &nReplacements);
+    CHECK(s == "aabcc");
+    CHECK(nReplacements == 1);
+}
+
 TEST_CASE("string.h omw::reverse()")
 {
     std::string s;
@@ -469,6 +775,83 @@ TEST_CASE("string.h omw::split() by string")
     CHECK(t[1] == "");
 }
 
+#if (OMW_CPPSTD >= OMW_CPPSTD_17)
+namespace {
+
+template <typename Delim> std::vector<std::string> splitViewTokens(std::string_view str, const Delim& delimiter, size_t maxTokenCount = omw::StringVector_npos)
+{
+    std::vector<std::string> r;
+    for (const auto& token : omw::splitView(str, delimiter, maxTokenCount)) { r.push_back(std::string(token)); }
+    return r;
+}
+
+template <typename Delim> std::vector<std::string> splitIntoTokens(std::string_view str, const Delim& delimiter, size_t maxTokenCount = omw::StringVector_npos)
+{
+    std::vector<std::string_view> tokens(3, std::string_view("garbage"));
+    const size_t n = omw::splitInto(str, delimiter, tokens, maxTokenCount);
+    CHECK(n == tokens.size());
+    return std::vector<std::string>(tokens.begin(), tokens.end());
+}
+
+} // namespace
+
+TEST_CASE("string.h omw::splitView() omw::splitInto()")
+{
+    const std::vector<std::string> strings = {
+        "The quick brown fox jumps over the lazy dog",
+        "The, quick, brown, fox, jumps, over, the, lazy, dog",
+        "",
+        " ",
+        ", ",
+        "  a  b  ",
+        ",,, ,, ,",
+    };
+    const std::vector<char> charDelims = { ' ', 'o', 'T', 'g', ',', 'x' };
+    const std::vector<std::string> strDelims = { ", ", "e, ", "The", "dog", " ", ",,", "xyz" };
+    const std::vector<size_t> maxCounts = { omw::StringVector_npos, 0, 1, 2, 5, 100 };
+
+    for (const auto& str : strings)
+    {
+        for (const auto max : maxCounts)
+        {
+            for (const auto delim : charDelims)
+            {
+                const omw::StringVector expected = omw::split(str, delim, max);
+                CHECK(splitViewTokens(str, delim, max) == expected);
+                CHECK(splitIntoTokens(str, delim, max) == expected);
+            }
+
+            for (const auto& delim : strDelims)
+            {
+                const omw::StringVector expected = omw::split(str, delim, max);
+                CHECK(splitViewTokens(str, std::string_view(delim), max) == expected);
+                CHECK(splitIntoTokens(str, std::string_view(delim), max) == expected);
+            }
+        }
+    }
+
+    // empty delimiter does not split
+    CHECK(splitViewTokens("a b", std::string_view()) == std::vector<std::string>{ "a b" });
+    CHECK(splitIntoTokens("a b", std::string_view()) == std::vector<std::string>{ "a b" });
+
+    // tokens point into the source
+    const std::string s = "ab:cd";
+    const auto view = omw::splitView(s, ':');
+    auto it = view.begin();
+    REQUIRE(it != view.end());
+    CHECK(it->data() == s.data());
+    CHECK(*it == "ab");
+    const auto prev = it++;
+    CHECK(*prev == "ab");
+    REQUIRE(it != view.end());
+    CHECK(it->data() == s.data() + 3);
+    CHECK(*it == "cd");
+    ++it;
+    CHECK(it == view.end());
+    CHECK(std::distance(view.begin(), view.end()) == 2);
+}
+#endif // C++17
+
 TEST_CASE("string.h omw::splitLen()")
 {
     const std::string s("The quick brown fox jumps over the lazy dog");
@@ -879,6 +1262,141 @@ TEST_CASE("string.h hexstoui128()")
     TESTUTIL_TRYCATCH_CHECK(omw::hexstoui128("0x100000000000000000000000000000000"), std::invalid_argument);
 }
 
+TEST_CASE("string.h stoi128()")
+{
+    CHECK(omw::stoi128("0") == omw::int128_t(0));
+    CHECK(omw::stoi128("-0") == omw::int128_t(0));
+    CHECK(omw::stoi128("000123") == omw::int128_t(123));
+    CHECK(omw::stoi128("-1234567890123456") == omw::int128_t(-1234567890123456));
+    CHECK(omw::stoi128("18446744073709551616") == omw::int128_t(1, 0));
+    CHECK(omw::stoi128("170141183460469231731687303715884105727") == OMW_INT128_MAX);
+    CHECK(omw::stoi128("-170141183460469231731687303715884105728") == OMW_INT128_MIN);
+    CHECK(omw::stoi128("-0000000000000000000000000000000000000000000000000000000012") == omw::int128_t(-12));
+
+    TESTUTIL_TRYCATCH_DECLARE_VAL(omw::int128_t, 0x11112);
+    TESTUTIL_TRYCATCH_CHECK(omw::stoi128(""), std::invalid_argument);
+    TESTUTIL_TRYCATCH_CHECK(omw::stoi128("-"), std::invalid_argument);
+    TESTUTIL_TRYCATCH_CHECK(omw::stoi128("+1"), std::invalid_argument);
+    TESTUTIL_TRYCATCH_CHECK(omw::stoi128(" 1"), std::invalid_argument);
+    TESTUTIL_TRYCATCH_CHECK(omw::stoi128("12a"), std::invalid_argument);
+    TESTUTIL_TRYCATCH_CHECK(omw::stoi128("170141183460469231731687303715884105728"), std::out_of_range);
+    TESTUTIL_TRYCATCH_CHECK(omw::stoi128("-170141183460469231731687303715884105729"), std::out_of_range);
+    TESTUTIL_TRYCATCH_CHECK(omw::stoi128("1000000000000000000000000000000000000000000000"), std::out_of_range);
+}
+
+TEST_CASE("string.h stoui128()")
+{
+    CHECK(omw::stoui128("0") == omw::uint128_t(0));
+    CHECK(omw::stoui128("18446744073709551615") == omw::uint128_t(0, 0xFFFFFFFFFFFFFFFF));
+    CHECK(omw::stoui128("10000000000000000000") == omw::uint128_t(0, 10000000000000000000u));
+    CHECK(omw::stoui128("100000000000000000000000000000000000000") == omw::uint128_t(0x4B3B4CA85A86C47A, 0x098A224000000000));
+    CHECK(omw::stoui128("340282366920938463463374607431768211455") == OMW_UINT128_MAX);
+
+    TESTUTIL_TRYCATCH_DECLARE_VAL(omw::uint128_t, 0x11112);
+    TESTUTIL_TRYCATCH_CHECK(omw::stoui128(""), std::invalid_argument);
+    TESTUTIL_TRYCATCH_CHECK(omw::stoui128("-1"), std::invalid_argument);
+    TESTUTIL_TRYCATCH_CHECK(omw::stoui128("1 "), std::invalid_argument);
+    TESTUTIL_TRYCATCH_CHECK(omw::stoui128("340282366920938463463374607431768211456"), std::out_of_range);
+    TESTUTIL_TRYCATCH_CHECK(omw::stoui128("3402823669209384634633746074317682114550"), std::out_of_range);
+}
+
+TEST_CASE("string.h toChars() fromChars()")
+{
+    char buffer[omw::toChars128_maxLength + 1];
+    char* const bufferEnd = buffer + sizeof(buffer);
+
+    omw::ToCharsResult tr = omw::toChars(buffer, bufferEnd, OMW_INT128_MIN);
+    CHECK(tr.ec == std::errc());
+    CHECK(std::string(buffer, tr.ptr) == "-170141183460469231731687303715884105728");
+    CHECK((size_t)(tr.ptr - buffer) == omw::toChars128_maxLength);
+
+    tr = omw::toChars(buffer, buffer + 3, omw::uint128_t(123));
+    CHECK(tr.ec == std::errc());
+    CHECK(tr.ptr == (buffer + 3));
+    CHECK(std::string(buffer, tr.ptr) == "123");
+
+    tr = omw::toChars(buffer, buffer + 3, omw::int128_t(-123));
+    CHECK(tr.ec == std::errc::value_too_large);
+    CHECK(tr.ptr == (buffer + 3));
+
+    tr = omw::toChars(buffer, buffer, omw::uint128_t(0));
+    CHECK(tr.ec == std::errc::value_too_large);
+
+    const char str[] = "-12345678901234567890123x";
+    omw::int128_t i = 5;
+    omw::FromCharsResult fr = omw::fromChars(str, str + sizeof(str) - 1, i);
+    CHECK(fr.ec == std::errc());
+    CHECK(fr.ptr == (str + 24));
+    CHECK(i == omw::int128_t(0xFFFFFFFFFFFFFD62, 0xBD49B1898EBDBB35));
+    CHECK(omw::toString(i) == "-12345678901234567890123");
+
+    omw::uint128_t u = 5;
+    fr = omw::fromChars(str, str + sizeof(str) - 1, u);
+    CHECK(fr.ec == std::errc::invalid_argument);
+    CHECK(fr.ptr == str);
+    CHECK(u == omw::uint128_t(5));
+
+    fr = omw::fromChars(str + 1, str + 6, u);
+    CHECK(fr.ec == std::errc());
+    CHECK(fr.ptr == (str + 6));
+    CHECK(u == omw::uint128_t(12345));
+
+    const char big[] = "999999999999999999999999999999999999999999";
+    fr = omw::fromChars(big, big + sizeof(big) - 1, u);
+    CHECK(fr.ec == std::errc::result_out_of_range);
+    CHECK(fr.ptr == (big + sizeof(big) - 1));
+    CHECK(u == omw::uint128_t(12345));
+
+    // round trip
+    tu::Rng64 rng;
+    for (unsigned int n = 0; n < 2000; ++n)
+    {
+        const omw::uint128_t value = omw::uint128_t(rng(), rng()) >> (n % 128);
+
+        tr = omw::toChars(buffer, bufferEnd, value);
+        REQUIRE(tr.ec == std::errc());
+
+        omw::uint128_t parsed;
+        fr = omw::fromChars(buffer, tr.ptr, parsed);
+        REQUIRE(fr.ec == std::errc());
+        REQUIRE(fr.ptr == tr.ptr);
+        REQUIRE(parsed == value);
+
+        const omw::int128_t sValue(value);
+        tr = omw::toChars(buffer, bufferEnd, sValue);
+        REQUIRE(tr.ec == std::errc());
+        REQUIRE((buffer[0] == '-') == sValue.isNegative());
+
+        omw::int128_t sParsed;
+        fr = omw::fromChars(buffer, tr.ptr, sParsed);
+        REQUIRE(fr.ec == std::errc());
+        REQUIRE(sParsed == sValue);
+
+        if (value.hi() == 0)
+        {
+            REQUIRE(std::string(buffer, tr.ptr) == (sValue.isNegative() ? omw::toString(sValue) : std::to_string(value.lo())));
+        }
+    }
+
+#if (OMW_CPPSTD >= OMW_CPPSTD_14)
+    tr = omw::toChars(buffer, bufferEnd, omw::i128::min());
+    CHECK(std::string(buffer, tr.ptr) == "-170141183460469231731687303715884105728");
+    tr = omw::toChars(buffer, bufferEnd, omw::u128::max());
+    CHECK(std::string(buffer, tr.ptr) == "340282366920938463463374607431768211455");
+
+    omw::u128 u128 = 0;
+    const char u128Str[] = "340282366920938463463374607431768211455";
+    fr = omw::fromChars(u128Str, u128Str + sizeof(u128Str) - 1, u128);
+    CHECK(fr.ec == std::errc());
+    CHECK(u128 == omw::u128::max());
+
+    omw::i128 i128 = 0;
+    fr = omw::fromChars(str, str + 24, i128);
+    CHECK(fr.ec == std::errc());
+    CHECK(omw::int128_t(i128) == i);
+#endif
+}
+
 TEST_CASE("string.h hexstovector()")
 {
     const std::vector<uint8_t> vector = { 0x00, 0x05, 0xA5, 'c', 'B' };
@@ -1320,6 +1838,135 @@ TEST_CASE("string.h peekNewLine()")
 
 
 
+TEST_CASE("string.h omw::CharSet")
+{
+    omw::CharSet set;
+    CHECK(set.empty());
+    CHECK(set.size() == 0);
+
+    const char data[] = "0123456789";
+    CHECK(set.find(data, data + 10) == data + 10);
+    CHECK(set.findNot(data, data + 10) == data);
+    CHECK(set.find(nullptr, nullptr) == nullptr);
+
+    set.add('a').add('a').add("bc", 2).addRange('x', 'z');
+    CHECK(set.size() == 6);
+    CHECK(set.contains('a'));
+    CHECK(set.contains('y'));
+    CHECK_FALSE(set.contains('d'));
+
+    CHECK(omw::CharSet(static_cast<char>(0xFF)).contains(static_cast<char>(0xFF)));
+    CHECK(omw::CharSet().addRange(static_cast<char>(0x00), static_cast<char>(0xFF)).size() == 256);
+    CHECK(omw::CharSet(std::string("\0a", 2)).size() == 2);
+
+    TESTUTIL_TRYCATCH_OPEN_DECLARE_VAL(size_t, 123);
+    TESTUTIL_TRYCATCH_CHECK(omw::CharSet(nullptr).size(), std::invalid_argument);
+    TESTUTIL_TRYCATCH_CHECK(omw::CharSet(nullptr, 1).size(), std::invalid_argument);
+    TESTUTIL_TRYCATCH_CLOSE();
+
+    using cstr_t = const char*;
+    TESTUTIL_TRYCATCH_OPEN_DECLARE_VAL(cstr_t, data);
+    TESTUTIL_TRYCATCH_CHECK(set.find(nullptr, data), std::invalid_argument);
+    TESTUTIL_TRYCATCH_CHECK(set.findNot(data + 1, data), std::invalid_argument);
+    TESTUTIL_TRYCATCH_CLOSE();
+}
+
+TEST_CASE("string.h omw::findFirstOf() omw::findFirstNotOf()")
+{
+    // random bytes and sets of different sizes, to cover the compare and the lookup table kernels
+    uint32_t x = 12345;
+    const auto rnd = [&x]() {
+        x = x * 1103515245u + 12345u;
+        return static_cast<char>(x >> 23);
+    };
+
+    std::string data(300, 0);
+    for (auto& c : data) c = rnd();
+
+    for (size_t setSize : { 1, 2, 3, 4, 5, 8, 30, 200 })
+    {
+        std::string chars;
+        for (size_t i = 0; i < setSize; ++i) chars += rnd();
+        const omw::CharSet set(chars);
+
+        for (size_t pos = 0; pos < 40; pos += 3)
+        {
+            for (size_t len : { 0, 1, 15, 16, 17, 31, 32, 33, 64, 200 })
+            {
+                const std::string str = data.substr(pos, len);
+                CHECK(omw::findFirstOf(str, set) == str.find_first_of(chars));
+                CHECK(omw::findFirstNotOf(str, set) == str.find_first_not_of(chars));
+                CHECK(omw::findFirstOf(str, set, 7) == str.find_first_of(chars, 7));
+                CHECK(omw::findFirstNotOf(str, set, 7) == str.find_first_not_of(chars, 7));
+            }
+        }
+    }
+
+    const std::string s(100, 'a');
+    CHECK(omw::findFirstOf(s + "b", omw::CharSet("xb")) == 100);
+    CHECK(omw::findFirstNotOf(s + "b", omw::CharSet('a')) == 100);
+    CHECK(omw::findFirstOf(s, omw::CharSet('b')) == std::string::npos);
+    CHECK(omw::findFirstOf(s, omw::CharSet('a'), 100) == std::string::npos);
+}
+
+TEST_CASE("string.h omw::countLines() omw::splitLines()")
+{
+    CHECK(omw::countLines("") == 0);
+    CHECK(omw::countLines("a") == 1);
+    CHECK(omw::countLines("\n") == 1);
+    CHECK(omw::countLines("\r") == 1);
+    CHECK(omw::countLines("\r\n") == 1);
+    CHECK(omw::countLines("\n\r") == 2);
+    CHECK(omw::countLines("a\nb") == 2);
+    CHECK(omw::countLines("a\r\nb\r\n") == 2);
+    CHECK(omw::countLines("a\r\rb\n\n") == 4);
+
+    CHECK(omw::splitLines("").empty());
+    CHECK(omw::splitLines("a") == omw::StringVector{ "a" });
+    CHECK(omw::splitLines("\n") == omw::StringVector{ "" });
+    CHECK(omw::splitLines("a\r\nb\r\n") == omw::StringVector{ "a", "b" });
+    CHECK(omw::splitLines("a\r\rb\n\nc") == omw::StringVector{ "a", "", "b", "", "c" });
+
+    // line breaks at every position around the block boundaries
+    const char* const breaks[] = { "\n", "\r", "\r\n" };
+    for (const char* br : breaks)
+    {
+        for (size_t pos = 0; pos < 70; ++pos)
+        {
+            std::string str(pos, 'x');
+            str += br;
+            str += std::string(70 - pos, 'y');
+            str += br;
+            str += "\r\r\n\n";
+
+            const omw::StringVector expected = { std::string(pos, 'x'), std::string(70 - pos, 'y'), "", "", "" };
+            CHECK(omw::countLines(str) == 5);
+            CHECK(omw::splitLines(str) == expected);
+            CHECK(omw::findNewLine(str.data(), str.data() + str.size()) == str.data() + pos);
+#if (OMW_CPPSTD >= OMW_CPPSTD_17)
+            std::vector<std::string_view> lines;
+            CHECK(omw::splitLinesInto(str, lines) == 5);
+            CHECK(std::vector<std::string>(lines.begin(), lines.end()) == expected);
+#endif
+        }
+    }
+
+    const char data[] = "a\nb";
+    CHECK(omw::findNewLine(data, data + 1) == data + 1);
+
+    TESTUTIL_TRYCATCH_OPEN_DECLARE_VAL(size_t, 123);
+    TESTUTIL_TRYCATCH_CHECK(omw::countLines(nullptr, data), std::invalid_argument);
+    TESTUTIL_TRYCATCH_CHECK(omw::countLines(data + 1, data), std::invalid_argument);
+    TESTUTIL_TRYCATCH_CLOSE();
+
+    using cstr_t = const char*;
+    TESTUTIL_TRYCATCH_OPEN_DECLARE_VAL(cstr_t, data);
+    TESTUTIL_TRYCATCH_CHECK(omw::findNewLine(data + 1, data), std::invalid_argument);
+    TESTUTIL_TRYCATCH_CLOSE();
+}
+
+
+
 TEST_CASE("string.h readString()")
 {
     // "The quick brown fox jumps over the lazy dog."
@@ -1429,3 +2076,253 @@ TEST_CASE("string.h writeString() vector")
     TESTUTIL_TRYCATCH_SE_CHECK((omw::writeString(*p_tcv, p_tcv->size(), "a")), std::out_of_range);
     TESTUTIL_TRYCATCH_SE_CHECK((omw::writeString(*p_tcv, p_tcv->size() - 1, "ab")), std::out_of_range);
 }
+
+#ifdef CATCH_CONFIG_ENABLE_BENCHMARKING
+TEST_CASE("string.h 128-bit decimal conversion benchmark", "[.][benchmark]")
+{
+    constexpr size_t n = 64 * 1024;
+    std::vector<omw::uint128_t> values(n);
+    tu::Rng64 rng(12345);
+    for (size_t i = 0; i < n; ++i)
+    {
+        const uint64_t x = rng();
+        values[i] = omw::uint128_t(x >> (i % 64), x ^ (x >> 29));
+    }
+
+    std::vector<char> text(n * omw::toChars128_maxLength);
+    std::vector<const char*> ends(n);
+
+    BENCHMARK("toString() 64Ki")
+    {
+        size_t r = 0;
+        for (size_t i = 0; i < n; ++i) r += omw::toString(values[i]).length();
+        return r;
+    };
+
+    BENCHMARK("toChars() 64Ki")
+    {
+        char* p = text.data();
+        for (size_t i = 0; i < n; ++i)
+        {
+            p = omw::toChars(p, text.data() + text.size(), values[i]).ptr;
+            ends[i] = p;
+        }
+        return p;
+    };
+
+    BENCHMARK("fromChars() 64Ki")
+    {
+        omw::uint128_t r = 0;
+        const char* p = text.data();
+        for (size_t i = 0; i < n; ++i)
+        {
+            omw::uint128_t value;
+            omw::fromChars(p, ends[i], value);
+            r ^= value;
+            p = ends[i];
+        }
+        return r;
+    };
+}
+
+#if (OMW_CPPSTD >= OMW_CPPSTD_17)
+TEST_CASE("string.h split benchmark", "[.][benchmark]")
+{
+    std::string csv;
+    for (size_t line = 0; line < 1000; ++line)
+    {
+        for (size_t field = 0; field < 16; ++field)
+        {
+            if (field > 0) csv += ',';
+            csv += "field" + std::to_string(line * 16 + field);
+        }
+        csv += '\n';
+    }
+
+    std::vector<std::string_view> tokens;
+
+    BENCHMARK("split()")
+    {
+        size_t r = 0;
+        for (const auto& line : omw::split(csv, '\n')) r += omw::split(line, ',').size();
+        return r;
+    };
+
+    BENCHMARK("splitView()")
+    {
+        size_t r = 0;
+        for (const auto line : omw::splitView(csv, '\n'))
+        {
+            for (const auto field : omw::splitView(line, ',')) r += field.size();
+        }
+        return r;
+    };
+
+    BENCHMARK("splitInto()")
+    {
+        size_t r = 0;
+        std::vector<std::string_view> lines;
+        omw::splitInto(csv, '\n', lines);
+        for (const auto line : lines) r += omw::splitInto(line, ',', tokens);
+        return r;
+    };
+}
+#endif // C++17
+
+TEST_CASE("string.h scanning benchmark", "[.][benchmark]")
+{
+    std::string log;
+    uint32_t x = 1;
+    while (log.size() < 8 * 1024 * 1024)
+    {
+        x = x * 1103515245u + 12345u;
+        log += "2026-10-18 12:00:00.000 [info] request " + std::to_string(x) + " handled in " + std::to_string(x % 977) + " ms\n";
+    }
+
+    std::string hexNoise(1024 * 1024, 0);
+    for (size_t i = 0; i < hexNoise.size(); ++i) hexNoise[i] = ((i % 5) == 4 ? ':' : omw::hexStrDigitsLower[i % 16]);
+
+    BENCHMARK("countLines() naive")
+    {
+        size_t r = 0;
+        for (const char c : log) r += (c == '\n');
+        return r;
+    };
+
+    BENCHMARK("countLines()") { return omw::countLines(log); };
+
+    BENCHMARK("split(str, '\\n')") { return omw::split(log, '\n').size(); };
+
+    BENCHMARK("splitLines()") { return omw::splitLines(log).size(); };
+
+#if (OMW_CPPSTD >= OMW_CPPSTD_17)
+    std::vector<std::string_view> lines;
+    BENCHMARK("splitLinesInto()") { return omw::splitLinesInto(log, lines); };
+#endif
+
+    const std::string punct = "[]{}()<>";
+    const omw::CharSet punctSet(punct);
+
+    BENCHMARK("std::string::find_first_of()")
+    {
+        size_t r = 0;
+        for (size_t pos = log.find_first_of(punct); pos != std::string::npos; pos = log.find_first_of(punct, pos + 1)) ++r;
+        return r;
+    };
+
+    BENCHMARK("findFirstOf()")
+    {
+        size_t r = 0;
+        for (size_t pos = omw::findFirstOf(log, punctSet); pos != std::string::npos; pos = omw::findFirstOf(log, punctSet, pos + 1)) ++r;
+        return r;
+    };
+
+    BENCHMARK("rmNonHex() 1MiB")
+    {
+        std::string str = hexNoise;
+        omw::rmNonHex(str);
+        return str.size();
+    };
+}
+
+TEST_CASE("string.h omw::MultiReplacer benchmark", "[.][benchmark]")
+{
+    std::vector<omw::StringReplacePair> pairs;
+    for (size_t i = 0; i < 300; ++i) pairs.push_back(omw::StringReplacePair("${key" + std::to_string(i) + "}", "value_" + std::to_string(i * 7919)));
+
+    std::string blob;
+    for (size_t i = 0; blob.size() < 64 * 1024; ++i)
+    {
+        blob += "setting_" + std::to_string(i) + " = ${key" + std::to_string((i * 37) % 300) + "} # default: ${key" + std::to_string((i * 11) % 300) +
+                "}\n";
+    }
+
+    BENCHMARK("replaceAll() sequential")
+    {
+        std::string s = blob;
+        return omw::replaceAll(s, pairs).size();
+    };
+
+    const omw::MultiReplacer replacer(pairs);
+
+    BENCHMARK("MultiReplacer::replaceAll()")
+    {
+        std::string s = blob;
+        return replacer.replaceAll(s).size();
+    };
+
+    BENCHMARK("MultiReplacer construction") { return omw::MultiReplacer(pairs).pairs().size(); };
+}
+
+TEST_CASE("string.h omw::replaceAll() benchmark", "[.][benchmark]")
+{
+    std::string text;
+    for (size_t i = 0; text.size() < 1024 * 1024; ++i) text += "lorem ipsum dolor sit amet, " + std::to_string(i) + " consectetur adipiscing elit\n";
+
+    BENCHMARK("replaceAll() shrink")
+    {
+        std::string s = text;
+        return omw::replaceAll(s, "ipsum", "ip").size();
+    };
+
+    BENCHMARK("replaceAll() grow")
+    {
+        std::string s = text;
+        return omw::replaceAll(s, "ipsum", "ipsum ipsum").size();
+    };
+
+    BENCHMARK("replaceAll() sparse")
+    {
+        std::string s = text;
+        return omw::replaceAll(s, "12345 consectetur", "-").size();
+    };
+}
+
+TEST_CASE("string.h omw::Searcher benchmark", "[.][benchmark]")
+{
+    std::vector<std::string> lines;
+    for (size_t i = 0; i < 20000; ++i)
+    {
+        lines.push_back("2026-10-18 12:00:00.000 [info] request_id=" + std::to_string(i * 7919) + " user_agent=client/1.0 path=/api/v1/items/" +
+                        std::to_string(i) + " status=200");
+    }
+
+    std::vector<std::string> keys;
+    for (const char* key : { "error", "warning", "timeout", "status=500", "status=404", "path=/admin", "user_agent=curl", "request_id=42 ",
+                             "[debug]", "exception", "panic", "retry" })
+    {
+        keys.push_back(key);
+    }
+
+    BENCHMARK("contains() std::string")
+    {
+        size_t r = 0;
+        for (const auto& line : lines)
+        {
+            for (const auto& key : keys) r += (omw::contains(line, key) ? 1 : 0);
+        }
+        return r;
+    };
+
+    std::vector<omw::Searcher> searchers;
+    for (const auto& key : keys) searchers.push_back(omw::Searcher(key));
+
+    BENCHMARK("contains() omw::Searcher")
+    {
+        size_t r = 0;
+        for (const auto& line : lines)
+        {
+            for (const auto& searcher : searchers) r += (omw::contains(line, searcher) ? 1 : 0);
+        }
+        return r;
+    };
+
+    const std::string text = omw::join(lines, '\n');
+    const std::string longNeedle = "path=/api/v1/items/19999 status=200" + std::string(300, '!');
+
+    BENCHMARK("find() long needle std::string") { return text.find(longNeedle); };
+
+    const omw::Searcher longSearcher(longNeedle);
+    BENCHMARK("find() long needle omw::Searcher") { return longSearcher.find(text); };
+}
+#endif // CATCH_CONFIG_ENABLE_BENCHMARKING
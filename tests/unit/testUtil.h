@@ -7,6 +7,7 @@ copyright       MIT - Copyright (c) 2022 Oliver Blaser
 #ifndef IG_TESTUTIL_H
 #define IG_TESTUTIL_H
 
+#include <cstdint>
 #include <cstring>
 #include <iostream>
 #include <stdexcept>
@@ -80,6 +81,24 @@ static inline int strcmp(const std::string& a, const char* b) { return std::strc
 static inline int strcmp(const char* a, const std::string& b) { return std::strcmp(a, b.c_str()); }
 static inline int strcmp(const std::string& a, const std::string& b) { return std::strcmp(a.c_str(), b.c_str()); }
 
+// seeded 64-bit pseudo random number generator (LCG with xorshift output), gives the same sequence on every platform
+class Rng64
+{
+public:
+    explicit Rng64(uint64_t seed = 0x0123456789ABCDEF)
+        : m_state(seed)
+    {}
+
+    uint64_t operator()()
+    {
+        m_state = m_state * 6364136223846793005ull + 1442695040888963407ull;
+        return (m_state ^ (m_state >> 29));
+    }
+
+private:
+    uint64_t m_state;
+};
+
 } // namespace tu
 
 
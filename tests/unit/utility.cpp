@@ -4,7 +4,10 @@ date            06.04.2022
 copyright       MIT - Copyright (c) 2022 Oliver Blaser
 */
 
+#include <climits>
+#include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include "catch2/catch.hpp"
@@ -1852,6 +1855,132 @@ TEST_CASE("utility.h shiftRight() 64-bit")
 
 #endif // ___OMWi_REGION_shift_functions
 
+namespace {
+
+template <typename T> T refShiftLeft(T value, unsigned int n)
+{
+    using U = typename std::make_unsigned<T>::type;
+    U r = static_cast<U>(value);
+    for (unsigned int i = 0; i < n; ++i) r = static_cast<U>(r << 1);
+    return static_cast<T>(r);
+}
+
+template <typename T> T refShiftRight(T value, unsigned int n)
+{
+    using U = typename std::make_unsigned<T>::type;
+    constexpr U msb = static_cast<U>(static_cast<U>(1) << (sizeof(T) * 8 - 1));
+    const U sign = ((std::is_signed<T>::value && (static_cast<U>(value) & msb)) ? msb : 0);
+    U r = static_cast<U>(value);
+    for (unsigned int i = 0; i < n; ++i) r = static_cast<U>((r >> 1) | sign);
+    return static_cast<T>(r);
+}
+
+template <typename T> void checkShift(T value)
+{
+    for (unsigned int n = 0; n <= (sizeof(T) * 8 + 3); ++n)
+    {
+        REQUIRE(omw::shiftLeft(value, n) == refShiftLeft(value, n));
+        REQUIRE(omw::shiftRight(value, n) == refShiftRight(value, n));
+    }
+    REQUIRE(omw::shiftLeft(value, UINT_MAX) == 0);
+    REQUIRE(omw::shiftRight(value, UINT_MAX) == refShiftRight(value, sizeof(T) * 8));
+}
+
+// bit `i` of the stream, bit 7 of data[0] is bit 0
+bool streamBit(const std::vector<uint8_t>& data, size_t i) { return ((data[i / 8] >> (7 - (i % 8))) & 0x01) != 0; }
+
+} // namespace
+
+TEST_CASE("utility.h shift function templates")
+{
+    static_assert(omw::shiftLeft(int8_t(-1), 7) == INT8_MIN, "");
+    static_assert(omw::shiftLeft(int8_t(-1), 8) == 0, "");
+    static_assert(omw::shiftRight(int8_t(-128), 7) == -1, "");
+    static_assert(omw::shiftRight(int16_t(-2), 100) == -1, "");
+    static_assert(omw::shiftRight(uint16_t(0x8000), 15) == 1, "");
+    static_assert(omw::shiftRight(uint16_t(0x8000), 16) == 0, "");
+    static_assert(omw::shiftLeft(uint32_t(1), 31) == 0x80000000, "");
+    static_assert(omw::shiftLeft(uint64_t(1), 64) == 0, "");
+    static_assert(omw::shiftRight(INT64_MIN, 63) == -1, "");
+    static_assert(omw::shiftRight(-5, 1) == -3, "");
+    static_assert(omw::shiftLeft('\x01', 3) == 8, "");
+
+    for (int v = INT8_MIN; v <= UINT8_MAX; ++v)
+    {
+        checkShift(static_cast<int8_t>(v));
+        checkShift(static_cast<uint8_t>(v));
+    }
+
+    for (int v = INT16_MIN; v <= INT16_MAX; v += 37)
+    {
+        checkShift(static_cast<int16_t>(v));
+        checkShift(static_cast<uint16_t>(v));
+    }
+
+    tu::Rng64 rng;
+    for (int i = 0; i < 1000; ++i)
+    {
+        const uint64_t x = rng();
+        checkShift(static_cast<int32_t>(x >> 32));
+        checkShift(static_cast<uint32_t>(x));
+        checkShift(static_cast<int64_t>(x));
+        checkShift(x);
+    }
+}
+
+TEST_CASE("utility.h byte buffer shift and rotate")
+{
+    tu::Rng64 rng;
+
+    for (size_t size = 0; size < 80; size += ((size < 40) ? 1 : 7))
+    {
+        std::vector<uint8_t> data(size);
+        for (size_t i = 0; i < size; ++i)
+        {
+            const uint64_t x = rng();
+            data[i] = static_cast<uint8_t>(x >> 56);
+        }
+
+        const size_t nBits = size * 8;
+        const size_t counts[] = { 0, 1, 3, 7, 8, 9, 15, 16, 17, 63, 64, 65, 130, 257, nBits - 1, nBits, nBits + 1, nBits + 13 };
+
+        for (size_t n : counts)
+        {
+            if (n > (nBits + 13)) continue; // underflow of `nBits - 1`
+
+            std::vector<uint8_t> sl = data, sr = data, rl = data, rr = data;
+            omw::shiftLeft(sl.data(), size, n);
+            omw::shiftRight(sr.data(), size, n);
+            omw::rotateLeft(rl.data(), size, n);
+            omw::rotateRight(rr.data(), size, n);
+
+            for (size_t i = 0; i < nBits; ++i)
+            {
+                REQUIRE(streamBit(sl, i) == (((i + n) < nBits) ? streamBit(data, i + n) : false));
+                REQUIRE(streamBit(sr, i) == ((i >= n) ? streamBit(data, i - n) : false));
+                REQUIRE(streamBit(rl, i) == streamBit(data, (i + n) % nBits));
+                REQUIRE(streamBit(rr, i) == streamBit(data, (i + nBits - (n % nBits)) % nBits));
+            }
+        }
+    }
+
+    uint8_t buffer[] = { 0x81, 0x42, 0x24 };
+    omw::shiftLeft(buffer, 3, 4);
+    CHECK(buffer[0] == 0x14);
+    CHECK(buffer[1] == 0x22);
+    CHECK(buffer[2] == 0x40);
+    omw::rotateRight(buffer, 3, 12);
+    CHECK(buffer[0] == 0x24);
+    CHECK(buffer[1] == 0x01);
+    CHECK(buffer[2] == 0x42);
+
+    omw::shiftLeft(nullptr, 0, 5);
+    CHECK_THROWS_AS(omw::shiftLeft(nullptr, 1, 5), std::invalid_argument);
+    CHECK_THROWS_AS(omw::shiftRight(nullptr, 1, 5), std::invalid_argument);
+    CHECK_THROWS_AS(omw::rotateLeft(nullptr, 1, 5), std::invalid_argument);
+    CHECK_THROWS_AS(omw::rotateRight(nullptr, 1, 5), std::invalid_argument);
+}
+
 
 
 TEST_CASE("utility.h toggle()")
@@ -1872,3 +2001,38 @@ TEST_CASE("utility.h toggle()")
     omw::toggle(i);
     CHECK(i == 0);
 }
+
+#ifdef CATCH_CONFIG_ENABLE_BENCHMARKING
+TEST_CASE("utility.h shift benchmark", "[.][benchmark]")
+{
+    constexpr size_t n = 1024 * 1024;
+    std::vector<uint8_t> buffer(n);
+    std::vector<int32_t> values(n / 4);
+    tu::Rng64 rng(12345);
+    for (size_t i = 0; i < n; ++i)
+    {
+        const uint64_t x = rng();
+        buffer[i] = static_cast<uint8_t>(x >> 56);
+        if ((i % 4) == 0) values[i / 4] = static_cast<int32_t>(x >> 32);
+    }
+
+    BENCHMARK("omw::shiftRight() int32_t 256Ki")
+    {
+        int32_t r = 0;
+        for (size_t i = 0; i < values.size(); ++i) r ^= omw::shiftRight(values[i], static_cast<unsigned int>(i % 40));
+        return r;
+    };
+
+    BENCHMARK("omw::shiftLeft() buffer 1MiB")
+    {
+        omw::shiftLeft(buffer.data(), buffer.size(), 3);
+        return buffer[0];
+    };
+
+    BENCHMARK("omw::rotateRight() buffer 1MiB")
+    {
+        omw::rotateRight(buffer.data(), buffer.size(), 5);
+        return buffer[0];
+    };
+}
+#endif // CATCH_CONFIG_ENABLE_BENCHMARKING